@@ -5,6 +5,8 @@
  * @Version     :V1.0.0
  * @Brief       :平衡二叉搜索树（balanced binary search tree）
  * @Description :“节点高度”是指从该节点到它的最远叶节点的距离，即所经过的“边”的数量。规定叶节点的高度为 0 ，而空节点的高度为 -1
+ *               节点同时维护子树大小 size 与子树节点值之和 sum（updateAug），插入、删除与旋转时与高度一同更新，
+ *               排名与区间求和等查询见 avl_tree_augmented.c 。
  */
 
 #include "../utils/common.h"
@@ -13,18 +15,32 @@
 typedef struct
 {
     TreeNode *root;
+    TreeNodePool *pool; // 节点内存池，为 NULL 时逐个 malloc / free 节点
 } AVLTree;
 
 /* 构造函数 */
 AVLTree *newAVLTree() {
     AVLTree *avl = malloc(sizeof(AVLTree));
     avl->root = NULL;
+    avl->pool = NULL;
+    return avl;
+}
+
+/* 构造函数：节点从树独占的内存池分配 */
+AVLTree *newAVLTreePooled() {
+    AVLTree *avl = newAVLTree();
+    avl->pool = newTreeNodePool();
     return avl;
 }
 
 /* 析构函数 */
 void delAVLTree(AVLTree *avl) {
-    free(avl->root);
+    if (avl->pool != NULL) {
+        // 整块释放，无需遍历树
+        delTreeNodePool(avl->pool);
+    } else {
+        freeMemoryTree(avl->root);
+    }
     free(avl);
 }
 
@@ -48,6 +64,30 @@ void updateHeight(TreeNode *node) {
     }
 }
 
+/* 获取子树大小 */
+int nodeSize(TreeNode *node) {
+    // 空节点大小为 0
+    if (node == NULL) {
+        return 0;
+    }
+    return node->size;
+}
+
+/* 获取子树节点值之和 */
+long long nodeSum(TreeNode *node) {
+    // 空节点之和为 0
+    if (node == NULL) {
+        return 0;
+    }
+    return node->sum;
+}
+
+/* 更新子树大小与节点值之和 */
+void updateAug(TreeNode *node) {
+    node->size = nodeSize(node->left) + 1 + nodeSize(node->right);
+    node->sum = nodeSum(node->left) + node->val + nodeSum(node->right);
+}
+
 /* 获取平衡因子 */
 int balanceFactor(TreeNode *node) {
     // 空节点平衡因子为 0
@@ -66,9 +106,11 @@ TreeNode *rightRotator(TreeNode *node) {
     // 以 child 为原点，将 node 向右旋转
     child->right = node;
     node->left = grandchild;
-    // 更新节点高度
+    // 更新节点高度与子树聚合值（node 已成为 child 的子节点，先更新 node）
     updateHeight(node);
     updateHeight(child);
+    updateAug(node);
+    updateAug(child);
     // 返回旋转后子树的根节点
     return child;
 }
@@ -81,9 +123,11 @@ TreeNode *leftRotate(TreeNode *node) {
     // 以 child 为原点，将 node 向左旋转
     child->left = node;
     node->right = grandchild;
-    // 更新节点高度
+    // 更新节点高度与子树聚合值（node 已成为 child 的子节点，先更新 node）
     updateHeight(node);
     updateHeight(child);
+    updateAug(node);
+    updateAug(child);
     // 返回旋转后子树的根节点
     return child;
 }
@@ -120,21 +164,22 @@ TreeNode *rotate(TreeNode *node) {
 
 /* 递归插入节点（辅助函数） */
 // 从插入节点开始，自底向上执行旋转操作，使所有失衡节点恢复平衡（递归实现）
-TreeNode *insertHelper(TreeNode *node, int val) {
+TreeNode *insertHelper(TreeNodePool *pool, TreeNode *node, int val) {
     if (node == NULL) {
-        return newTreeNode(val);
+        return treeNodeAlloc(pool, val);
     }
     /* 1. 查找插入位置并插入节点 */
     if (node->val > val) {
-        node->left = insertHelper(node->left, val);
+        node->left = insertHelper(pool, node->left, val);
     } else if (node->val < val) {
-        node->right = insertHelper(node->right, val);
+        node->right = insertHelper(pool, node->right, val);
     } else {
         // 重复节点不插入，直接返回
         return node;
     }
-    // 更新节点高度
+    // 更新节点高度与子树聚合值
     updateHeight(node);
+    updateAug(node);
     /* 2. 执行旋转操作，使该子树重新恢复平衡 */
     node = rotate(node);
     // 返回子树的根节点
@@ -143,27 +188,28 @@ TreeNode *insertHelper(TreeNode *node, int val) {
 
 /* 插入节点 */
 void insert(AVLTree *avl, int val) {
-    avl->root = insertHelper(avl->root, val);
+    avl->root = insertHelper(avl->pool, avl->root, val);
 }
 
 /* 递归删除节点（辅助函数） */
 // 从底至顶执行旋转操作，使所有失衡节点恢复平衡
-TreeNode *removeHelper(TreeNode *node, int val) {
+TreeNode *removeHelper(TreeNodePool *pool, TreeNode *node, int val) {
     if (node == NULL) {
         return NULL;
     }
     TreeNode *child, *grandchild;
     /* 1. 查找节点并删除 */
     if (node->val > val) {
-        node->left = removeHelper(node->left, val);
+        node->left = removeHelper(pool, node->left, val);
     } else if (node->val < val) {
-        node->right = removeHelper(node->right, val);
+        node->right = removeHelper(pool, node->right, val);
     } else if (node->left == NULL || node->right == NULL) {
         child = node->left;
         if (node->right != NULL) {
             child = node->right;
         }
         // 子节点数量 = 0 ，直接删除 node 并返回
+        treeNodeFree(pool, node);
         if (child == NULL) {
             return NULL;
         } else {
@@ -177,11 +223,12 @@ TreeNode *removeHelper(TreeNode *node, int val) {
             temp = temp->left;
         }
         int tempVal = temp->val;
-        node->right = removeHelper(node->right, temp->val);
+        node->right = removeHelper(pool, node->right, temp->val);
         node->val = tempVal;
     }
-    // 更新节点高度
+    // 更新节点高度与子树聚合值
     updateHeight(node);
+    updateAug(node);
     /* 2. 执行旋转操作，使该子树重新恢复平衡 */
     node = rotate(node);
     // 返回子树的根节点
@@ -190,7 +237,7 @@ TreeNode *removeHelper(TreeNode *node, int val) {
 
 /* 删除节点 */
 void removeItem(AVLTree *avl, int val) {
-    avl->root = removeHelper(avl->root, val);
+    avl->root = removeHelper(avl->pool, avl->root, val);
 }
 
 /* 查找节点 */
@@ -212,50 +259,3 @@ TreeNode *search(AVLTree *tree, int val) {
     // 找到目标节点，跳出循环
     return cur;
 }
-
-void testInsert(AVLTree *tree, int val) {
-    insert(tree, val);
-    printf("\n插入节点 %d 后，AVL 树为 \n", val);
-    printTree(tree->root);
-}
-
-void testRemove(AVLTree *tree, int val) {
-    removeItem(tree, val);
-    printf("\n删除节点 %d 后，AVL 树为 \n", val);
-    printTree(tree->root);
-}
-
-/* Driver Code */
-int main() {
-    /* 初始化空 AVL 树 */
-    AVLTree *tree = (AVLTree *)newAVLTree();
-    /* 插入节点 */
-    // 请关注插入节点后，AVL 树是如何保持平衡的
-    testInsert(tree, 1);
-    testInsert(tree, 2);
-    testInsert(tree, 3);
-    testInsert(tree, 4);
-    testInsert(tree, 5);
-    testInsert(tree, 8);
-    testInsert(tree, 7);
-    testInsert(tree, 9);
-    testInsert(tree, 10);
-    testInsert(tree, 6);
-
-    /* 插入重复节点 */
-    testInsert(tree, 7);
-
-    /* 删除节点 */
-    // 请关注删除节点后，AVL 树是如何保持平衡的
-    testRemove(tree, 8); // 删除度为 0 的节点
-    testRemove(tree, 5); // 删除度为 1 的节点
-    testRemove(tree, 4); // 删除度为 2 的节点
-
-    /* 查询节点 */
-    TreeNode *node = search(tree, 7);
-    printf("\n查找到的节点对象节点值 = %d \n", node->val);
-
-    // 释放内存
-    delAVLTree(tree);
-    return 0;
-}
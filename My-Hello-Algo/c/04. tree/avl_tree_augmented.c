@@ -0,0 +1,118 @@
+/**
+ * @FileName    :avl_tree_augmented.c
+ * @Date        :2026-10-20 05:40:12
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :AVL 树的顺序统计与区间求和
+ * @Description :avl_tree.c 的节点维护子树大小 size 与子树节点值之和 sum（插入、删除与旋转时由 updateAug 更新），
+ *               借助它们可将排名类查询由 O(n) 遍历降为 O(log n) 。
+ *               1. rank(x) ：小于 x 的键数量，沿查找路径累加左子树大小；
+ *               2. select(k) ：第 k 小的键（k 从 0 开始），根据左子树大小决定向左或向右；
+ *               3. rangeCount(a, b) ：[a, b] 内的键数量 = rank(b + 1) - rank(a) ；
+ *               4. rangeSum(a, b) ：[a, b] 内的键之和 = 小于 b + 1 的键之和 - 小于 a 的键之和，
+ *                  前者沿查找路径累加左子树的和与路径上的键，与 rank 相同。
+ *               与 AVLTree 相同，键不重复，重复插入会被忽略。
+ */
+
+#include "avl_tree.c"
+
+/* 键的数量 */
+int avlCount(AVLTree *avl) {
+    return nodeSize(avl->root);
+}
+
+/* 排名：小于 val 的键数量 */
+int avlRank(AVLTree *avl, int val) {
+    TreeNode *cur = avl->root;
+    int rank = 0;
+    while (cur != NULL) {
+        if (cur->val < val) {
+            // cur 及其左子树都小于 val
+            rank += nodeSize(cur->left) + 1;
+            cur = cur->right;
+        } else {
+            cur = cur->left;
+        }
+    }
+    return rank;
+}
+
+/* 选择：第 k 小的键（k 从 0 开始），k 越界时返回 NULL */
+TreeNode *avlSelect(AVLTree *avl, int k) {
+    TreeNode *cur = avl->root;
+    if (k < 0 || k >= nodeSize(cur)) {
+        return NULL;
+    }
+    while (cur != NULL) {
+        int leftSize = nodeSize(cur->left);
+        if (k < leftSize) {
+            cur = cur->left;
+        } else if (k == leftSize) {
+            return cur;
+        } else {
+            k -= leftSize + 1;
+            cur = cur->right;
+        }
+    }
+    return NULL;
+}
+
+/* 区间 [lo, hi] 内的键数量 */
+int avlRangeCount(AVLTree *avl, int lo, int hi) {
+    if (lo > hi) {
+        return 0;
+    }
+    int upper = hi == INT_MAX ? avlCount(avl) : avlRank(avl, hi + 1);
+    return upper - avlRank(avl, lo);
+}
+
+/* 小于 val 的键之和 */
+long long avlPrefixSum(AVLTree *avl, int val) {
+    TreeNode *cur = avl->root;
+    long long sum = 0;
+    while (cur != NULL) {
+        if (cur->val < val) {
+            // cur 及其左子树都小于 val
+            sum += nodeSum(cur->left) + cur->val;
+            cur = cur->right;
+        } else {
+            cur = cur->left;
+        }
+    }
+    return sum;
+}
+
+/* 区间 [lo, hi] 内的键之和 */
+long long avlRangeSum(AVLTree *avl, int lo, int hi) {
+    if (lo > hi) {
+        return 0;
+    }
+    long long upper = hi == INT_MAX ? nodeSum(avl->root) : avlPrefixSum(avl, hi + 1);
+    return upper - avlPrefixSum(avl, lo);
+}
+
+/* 检查子树的平衡性、有序性以及高度、大小、和是否正确，返回子树大小，不合法时返回 -1 */
+int avlAugValidateNode(TreeNode *node, long long lo, long long hi) {
+    if (node == NULL) {
+        return 0;
+    }
+    if (node->val < lo || node->val > hi) {
+        return -1;
+    }
+    int ls = avlAugValidateNode(node->left, lo, (long long)node->val - 1);
+    int rs = avlAugValidateNode(node->right, (long long)node->val + 1, hi);
+    if (ls < 0 || rs < 0 || abs(balanceFactor(node)) > 1) {
+        return -1;
+    }
+    int lh = height(node->left), rh = height(node->right);
+    long long sum = nodeSum(node->left) + node->val + nodeSum(node->right);
+    if (node->height != (lh > rh ? lh : rh) + 1 || node->size != ls + 1 + rs || node->sum != sum) {
+        return -1;
+    }
+    return node->size;
+}
+
+/* 检查整棵树是否合法 */
+bool avlAugValidate(AVLTree *avl) {
+    return avlAugValidateNode(avl->root, INT_MIN, INT_MAX) >= 0;
+}
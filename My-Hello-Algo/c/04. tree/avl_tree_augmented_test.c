@@ -0,0 +1,265 @@
+/**
+ * @FileName    :avl_tree_augmented_test.c
+ * @Date        :2026-10-20 06:05:37
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :增强 AVL 树测试程序
+ * @Description :1. 基本测试：rank / select / rangeCount / rangeSum
+ *               2. 正确性：随机插入 / 删除后，各查询与暴力计算的结果一致，并检查高度、子树大小与和
+ *               3. 性能：随机键（默认 10^6 个），对比 AVL 树与“排序快照 + 二分查找 + 前缀和”的建立耗时、
+ *                  各查询的耗时，以及插入新键后维护的耗时（快照需要移动元素并重算前缀和）。
+ */
+
+#include "../utils/bench_util.h"
+#include "avl_tree_augmented.c"
+#include "../07. searching/simd_search.c"
+#include "../08. sorting/heap_sort.c"
+
+#ifndef BENCH_KEYS
+#define BENCH_KEYS 1000000
+#endif
+// 每种查询的次数与更新次数
+#define BENCH_QUERIES 1000000
+#define BENCH_UPDATES 1000
+
+/* 排序快照：有序去重数组与前缀和 prefix[i] = keys[0] + ... + keys[i - 1] */
+typedef struct {
+    int *keys;
+    long long *prefix;
+    int size;
+} SortedSnapshot;
+
+/* 由无序数组建立快照：排序、去重、计算前缀和 */
+void buildSnapshot(SortedSnapshot *snap, const int *nums, int n) {
+    memcpy(snap->keys, nums, sizeof(int) * n);
+    heapSortBottomUp(snap->keys, n);
+    int size = 0;
+    for (int i = 0; i < n; i++) {
+        if (size == 0 || snap->keys[size - 1] != snap->keys[i]) {
+            snap->keys[size++] = snap->keys[i];
+        }
+    }
+    snap->size = size;
+    snap->prefix[0] = 0;
+    for (int i = 0; i < size; i++) {
+        snap->prefix[i + 1] = snap->prefix[i] + snap->keys[i];
+    }
+}
+
+/* 向快照插入新键：移动元素并重算插入点之后的前缀和 */
+void snapshotInsert(SortedSnapshot *snap, int val) {
+    int i = simdLowerBound(snap->keys, snap->size, val);
+    if (i < snap->size && snap->keys[i] == val) {
+        return;
+    }
+    memmove(snap->keys + i + 1, snap->keys + i, sizeof(int) * (snap->size - i));
+    snap->keys[i] = val;
+    snap->size++;
+    for (int j = i; j < snap->size; j++) {
+        snap->prefix[j + 1] = snap->prefix[j] + snap->keys[j];
+    }
+}
+
+/* 快照上 [lo, hi] 内的键数量（下标区间 [a, b)） */
+void snapshotRange(SortedSnapshot *snap, int lo, int hi, int *a, int *b) {
+    *a = simdLowerBound(snap->keys, snap->size, lo);
+    *b = hi == INT_MAX ? snap->size : simdLowerBound(snap->keys, snap->size, hi + 1);
+}
+
+/* 基本测试 */
+void testBasic() {
+    int nums[] = {50, 20, 80, 10, 30, 70, 90, 60, 40};
+    int n = sizeof(nums) / sizeof(nums[0]);
+    AVLTree *avl = newAVLTree();
+    for (int i = 0; i < n; i++) {
+        insert(avl, nums[i]);
+    }
+    printf("键：10 20 30 40 50 60 70 80 90\n");
+    printf("rank(45) = %d ，rank(50) = %d\n", avlRank(avl, 45), avlRank(avl, 50));
+    printf("select(0) = %d ，select(4) = %d ，select(8) = %d\n", avlSelect(avl, 0)->val, avlSelect(avl, 4)->val,
+           avlSelect(avl, 8)->val);
+    printf("rangeCount(25, 75) = %d ，rangeSum(25, 75) = %lld\n", avlRangeCount(avl, 25, 75),
+           avlRangeSum(avl, 25, 75));
+    assert(avlRank(avl, 45) == 4 && avlRank(avl, 50) == 4 && avlSelect(avl, 4)->val == 50);
+    assert(avlSelect(avl, 9) == NULL && avlSelect(avl, -1) == NULL);
+    assert(avlRangeCount(avl, 25, 75) == 5 && avlRangeSum(avl, 25, 75) == 250);
+    assert(avlRangeCount(avl, 91, 100) == 0 && avlRangeSum(avl, 91, 100) == 0);
+
+    removeItem(avl, 50);
+    printf("删除 50 后：select(4) = %d ，rangeSum(25, 75) = %lld\n", avlSelect(avl, 4)->val,
+           avlRangeSum(avl, 25, 75));
+    assert(avlSelect(avl, 4)->val == 60 && avlRangeSum(avl, 25, 75) == 200 && avlAugValidate(avl));
+    delAVLTree(avl);
+}
+
+/* 正确性 */
+void testValidate() {
+    int range = 4000, ops = 100000;
+    AVLTree *avl = newAVLTree();
+    // 键取值 [-range / 2, range / 2) ，exist 以 key + range / 2 为下标
+    bool *exist = calloc(range, sizeof(bool));
+    int *sorted = malloc(sizeof(int) * range);
+    unsigned long long x = 2026;
+    for (int op = 0; op < ops; op++) {
+        int key = (int)(randU32(&x) % range) - range / 2;
+        bool ins = randU32(&x) % 3 != 0;
+        if (ins) {
+            insert(avl, key);
+        } else {
+            removeItem(avl, key);
+        }
+        exist[key + range / 2] = ins;
+        if (op % 1000 != 0) {
+            continue;
+        }
+        int size = 0;
+        for (int i = 0; i < range; i++) {
+            if (exist[i]) {
+                sorted[size++] = i - range / 2;
+            }
+        }
+        assert(avlCount(avl) == size && avlAugValidate(avl));
+        for (int q = 0; q < 50; q++) {
+            int lo = (int)(randU32(&x) % (range + 20)) - range / 2 - 10;
+            int hi = lo + (int)(randU32(&x) % 600) - 50;
+            int k = (int)(randU32(&x) % (size + 2)) - 1;
+            int rank = 0, cnt = 0;
+            long long sum = 0;
+            for (int i = 0; i < size; i++) {
+                rank += sorted[i] < lo;
+                if (sorted[i] >= lo && sorted[i] <= hi) {
+                    cnt++;
+                    sum += sorted[i];
+                }
+            }
+            TreeNode *sel = avlSelect(avl, k);
+            assert(k < 0 || k >= size ? sel == NULL : sel->val == sorted[k]);
+            assert(avlRank(avl, lo) == rank && avlRangeCount(avl, lo, hi) == cnt);
+            assert(avlRangeSum(avl, lo, hi) == sum);
+        }
+    }
+    // 极值边界
+    long long total = nodeSum(avl->root);
+    insert(avl, INT_MAX);
+    insert(avl, INT_MIN);
+    assert(avlRangeCount(avl, INT_MIN, INT_MAX) == avlCount(avl));
+    assert(avlRangeSum(avl, INT_MIN, INT_MAX) == total + INT_MAX + INT_MIN);
+    assert(avlRank(avl, INT_MIN) == 0 && avlSelect(avl, avlCount(avl) - 1)->val == INT_MAX);
+    printf("%d 次随机操作后，rank / select / rangeCount / rangeSum 与暴力计算一致\n", ops);
+    delAVLTree(avl);
+    free(exist);
+    free(sorted);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_KEYS;
+    int *nums = malloc(sizeof(int) * n);
+    int *lo = malloc(sizeof(int) * BENCH_QUERIES), *hi = malloc(sizeof(int) * BENCH_QUERIES);
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < n; i++) {
+        nums[i] = (int)(randU32(&x) >> 2);
+    }
+    // 查询区间平均覆盖约 0.5% 的键
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        lo[q] = (int)(randU32(&x) >> 2);
+        hi[q] = lo[q] + (int)(randU32(&x) % (INT_MAX / 4 / 50));
+    }
+    printf("%d 个随机键，每种查询 %d 次（耗时单位：s）\n", n, BENCH_QUERIES);
+    printf("%-20s %10s %10s %10s %12s %12s %16s\n", "", "建立", "rank", "select", "rangeCount", "rangeSum",
+           "插入 (每次)");
+
+    /* AVL 树 */
+    double start = wallSeconds();
+    AVLTree *tree = newAVLTree();
+    for (int i = 0; i < n; i++) {
+        insert(tree, nums[i]);
+    }
+    double tBuild = wallSeconds() - start;
+    long long checkRank = 0, checkSelect = 0, checkCount = 0, checkSum = 0;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        checkRank += avlRank(tree, lo[q]);
+    }
+    double tRank = wallSeconds() - start;
+    int size = avlCount(tree);
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        checkSelect += avlSelect(tree, lo[q] % size)->val;
+    }
+    double tSelect = wallSeconds() - start;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        checkCount += avlRangeCount(tree, lo[q], hi[q]);
+    }
+    double tCount = wallSeconds() - start;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        checkSum += avlRangeSum(tree, lo[q], hi[q]);
+    }
+    double tSum = wallSeconds() - start;
+    start = wallSeconds();
+    for (int u = 0; u < BENCH_UPDATES; u++) {
+        insert(tree, (int)(randU32(&x) >> 2));
+    }
+    double tUpdate = (wallSeconds() - start) / BENCH_UPDATES;
+    printf("%-20s %10.3f %10.3f %10.3f %12.3f %12.3f %13.2f us\n", "AVL 树", tBuild, tRank, tSelect, tCount,
+           tSum, tUpdate * 1e6);
+    delAVLTree(tree);
+
+    /* 排序快照 */
+    SortedSnapshot snap;
+    snap.keys = malloc(sizeof(int) * (n + BENCH_UPDATES));
+    snap.prefix = malloc(sizeof(long long) * (n + BENCH_UPDATES + 1));
+    start = wallSeconds();
+    buildSnapshot(&snap, nums, n);
+    tBuild = wallSeconds() - start;
+    assert(snap.size == size);
+    long long rankSum = 0, selectSum = 0, countSum = 0, sumSum = 0;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        rankSum += simdLowerBound(snap.keys, snap.size, lo[q]);
+    }
+    tRank = wallSeconds() - start;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        selectSum += snap.keys[lo[q] % size];
+    }
+    tSelect = wallSeconds() - start;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        int a, b;
+        snapshotRange(&snap, lo[q], hi[q], &a, &b);
+        countSum += b - a;
+    }
+    tCount = wallSeconds() - start;
+    start = wallSeconds();
+    for (int q = 0; q < BENCH_QUERIES; q++) {
+        int a, b;
+        snapshotRange(&snap, lo[q], hi[q], &a, &b);
+        sumSum += snap.prefix[b] - snap.prefix[a];
+    }
+    tSum = wallSeconds() - start;
+    start = wallSeconds();
+    for (int u = 0; u < BENCH_UPDATES; u++) {
+        snapshotInsert(&snap, (int)(randU32(&x) >> 2));
+    }
+    tUpdate = (wallSeconds() - start) / BENCH_UPDATES;
+    printf("%-20s %10.3f %10.3f %10.3f %12.3f %12.3f %13.2f us\n", "排序快照 + 二分查找", tBuild, tRank, tSelect,
+           tCount, tSum, tUpdate * 1e6);
+    assert(rankSum == checkRank && selectSum == checkSelect && countSum == checkCount && sumSum == checkSum);
+
+    free(snap.keys);
+    free(snap.prefix);
+    free(nums);
+    free(lo);
+    free(hi);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
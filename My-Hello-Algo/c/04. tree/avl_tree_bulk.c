@@ -0,0 +1,276 @@
+/**
+ * @FileName    :avl_tree_bulk.c
+ * @Date        :2026-10-20 06:48:55
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :AVL 树的批量构建与基于 join 的集合运算
+ * @Description :一、批量构建
+ *               从严格递增的数组构建 AVL 树：取中点为根，递归构建左右两半，O(n) 时间，无需任何旋转；
+ *               左右子树的节点数量之差不超过 1 ，因此得到的是完全平衡的树。
+ *
+ *               二、join 与 split
+ *               1. join(l, k, r) ：l 中的键都小于 k ，r 中的键都大于 k ，返回合并后的 AVL 树。
+ *                  若两棵树高度相差不超过 1 ，直接以 k 为根；否则沿较高树的右（左）脊下降到高度与另一棵树接近的位置，
+ *                  以 k 连接，再沿下降路径向上执行 rotate 恢复平衡。耗时 O(|h(l) - h(r)| + 1) 。
+ *               2. split(t, key) ：按 key 将 t 拆分为小于 key 的 l 、等于 key 的节点（可能不存在）与大于 key 的 r ，
+ *                  沿查找路径递归，回溯时用 join 拼接路径两侧的子树，耗时 O(log n) 。
+ *               3. join2(l, r) ：不带中间键的合并，先取出 l 的最大节点作为中间键，再调用 join 。
+ *               join 与 split 修改子树后与 avl_tree.c 相同，同时更新高度与子树大小、和（updateAug）。
+ *
+ *               三、集合运算（并集、交集、差集）
+ *               以 b 的根为界拆分 a ，递归处理两侧后再用 join 拼接：
+ *                   union(a, b) = join(union(a.l, b.left), b.root, union(a.r, b.right))
+ *               当 |b| = m <= |a| = n 时耗时 O(m log(n / m + 1)) ，两棵树大小接近时为 O(n) ，
+ *               远优于把 b 的键逐个插入 a 的 O(m log n) 次旋转与查找。
+ *               运算直接复用两棵树的节点：结果写入 a ，b 变为空树，多余的节点被释放。
+ *               两棵树须同为逐个 malloc 的树，或同为使用内存池的树（此时 b 的内存池并入 a）。
+ */
+
+#include "avl_tree.c"
+
+/* 由严格递增数组 nums[lo, hi) 构建完全平衡的子树 */
+TreeNode *avlBuildSorted(TreeNodePool *pool, const int *nums, int lo, int hi) {
+    if (lo >= hi) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    TreeNode *node = treeNodeAlloc(pool, nums[mid]);
+    node->left = avlBuildSorted(pool, nums, lo, mid);
+    node->right = avlBuildSorted(pool, nums, mid + 1, hi);
+    updateHeight(node);
+    updateAug(node);
+    return node;
+}
+
+/* 批量构建：用严格递增数组 nums 替换树中原有的节点 */
+void avlBulkLoad(AVLTree *avl, const int *nums, int n) {
+    if (avl->pool != NULL) {
+        delTreeNodePool(avl->pool);
+        avl->pool = newTreeNodePool();
+    } else {
+        freeMemoryTree(avl->root);
+    }
+    avl->root = avlBuildSorted(avl->pool, nums, 0, n);
+}
+
+/* join 的辅助函数：l 比 r 高 2 层以上，沿 l 的右脊下降 */
+TreeNode *avlJoinRight(TreeNode *l, TreeNode *k, TreeNode *r) {
+    if (height(l) <= height(r) + 1) {
+        k->left = l;
+        k->right = r;
+        updateHeight(k);
+        updateAug(k);
+        return k;
+    }
+    l->right = avlJoinRight(l->right, k, r);
+    updateHeight(l);
+    updateAug(l);
+    return rotate(l);
+}
+
+/* join 的辅助函数：r 比 l 高 2 层以上，沿 r 的左脊下降 */
+TreeNode *avlJoinLeft(TreeNode *l, TreeNode *k, TreeNode *r) {
+    if (height(r) <= height(l) + 1) {
+        k->left = l;
+        k->right = r;
+        updateHeight(k);
+        updateAug(k);
+        return k;
+    }
+    r->left = avlJoinLeft(l, k, r->left);
+    updateHeight(r);
+    updateAug(r);
+    return rotate(r);
+}
+
+/* 以 k 为中间键合并 l 与 r（l < k < r） */
+TreeNode *avlJoin(TreeNode *l, TreeNode *k, TreeNode *r) {
+    if (height(l) > height(r) + 1) {
+        return avlJoinRight(l, k, r);
+    }
+    if (height(r) > height(l) + 1) {
+        return avlJoinLeft(l, k, r);
+    }
+    k->left = l;
+    k->right = r;
+    updateHeight(k);
+    updateAug(k);
+    return k;
+}
+
+/* 取出子树中的最大节点，返回剩余子树的根 */
+TreeNode *avlSplitLast(TreeNode *node, TreeNode **last) {
+    if (node->right == NULL) {
+        *last = node;
+        return node->left;
+    }
+    node->right = avlSplitLast(node->right, last);
+    updateHeight(node);
+    updateAug(node);
+    return rotate(node);
+}
+
+/* 不带中间键合并 l 与 r（l < r） */
+TreeNode *avlJoin2(TreeNode *l, TreeNode *r) {
+    if (l == NULL) {
+        return r;
+    }
+    TreeNode *last;
+    l = avlSplitLast(l, &last);
+    return avlJoin(l, last, r);
+}
+
+/* 按 key 拆分子树：*l 为小于 key 的部分，*r 为大于 key 的部分，*mid 为等于 key 的节点（不存在时为 NULL） */
+void avlSplit(TreeNode *node, int key, TreeNode **l, TreeNode **mid, TreeNode **r) {
+    if (node == NULL) {
+        *l = *mid = *r = NULL;
+        return;
+    }
+    TreeNode *left = node->left, *right = node->right;
+    if (key < node->val) {
+        TreeNode *rl;
+        avlSplit(left, key, l, mid, &rl);
+        *r = avlJoin(rl, node, right);
+    } else if (key > node->val) {
+        TreeNode *lr;
+        avlSplit(right, key, &lr, mid, r);
+        *l = avlJoin(left, node, lr);
+    } else {
+        *l = left;
+        *r = right;
+        node->left = node->right = NULL;
+        node->height = 0;
+        updateAug(node);
+        *mid = node;
+    }
+}
+
+/* 释放子树的所有节点 */
+void avlFreeNodes(TreeNodePool *pool, TreeNode *node) {
+    if (node == NULL) {
+        return;
+    }
+    avlFreeNodes(pool, node->left);
+    avlFreeNodes(pool, node->right);
+    treeNodeFree(pool, node);
+}
+
+/* 并集（辅助函数） */
+TreeNode *avlUnionNodes(TreeNodePool *pool, TreeNode *a, TreeNode *b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    TreeNode *l, *mid, *r, *bl = b->left, *br = b->right;
+    avlSplit(a, b->val, &l, &mid, &r);
+    if (mid != NULL) {
+        // 重复的键只保留 b 中的节点
+        treeNodeFree(pool, mid);
+    }
+    l = avlUnionNodes(pool, l, bl);
+    r = avlUnionNodes(pool, r, br);
+    return avlJoin(l, b, r);
+}
+
+/* 交集（辅助函数） */
+TreeNode *avlIntersectNodes(TreeNodePool *pool, TreeNode *a, TreeNode *b) {
+    if (a == NULL || b == NULL) {
+        avlFreeNodes(pool, a);
+        avlFreeNodes(pool, b);
+        return NULL;
+    }
+    TreeNode *l, *mid, *r, *bl = b->left, *br = b->right;
+    avlSplit(a, b->val, &l, &mid, &r);
+    l = avlIntersectNodes(pool, l, bl);
+    r = avlIntersectNodes(pool, r, br);
+    if (mid != NULL) {
+        treeNodeFree(pool, mid);
+        return avlJoin(l, b, r);
+    }
+    treeNodeFree(pool, b);
+    return avlJoin2(l, r);
+}
+
+/* 差集 a - b（辅助函数） */
+TreeNode *avlDifferenceNodes(TreeNodePool *pool, TreeNode *a, TreeNode *b) {
+    if (a == NULL || b == NULL) {
+        avlFreeNodes(pool, b);
+        return a;
+    }
+    TreeNode *l, *mid, *r, *bl = b->left, *br = b->right;
+    avlSplit(a, b->val, &l, &mid, &r);
+    if (mid != NULL) {
+        treeNodeFree(pool, mid);
+    }
+    treeNodeFree(pool, b);
+    l = avlDifferenceNodes(pool, l, bl);
+    r = avlDifferenceNodes(pool, r, br);
+    return avlJoin2(l, r);
+}
+
+/* 集合运算前将 b 的内存池并入 a ，两棵树的分配方式不同时返回 false */
+bool avlAdoptPool(AVLTree *a, AVLTree *b) {
+    if ((a->pool == NULL) != (b->pool == NULL)) {
+        fprintf(stderr, "集合运算的两棵树须同为逐个 malloc 或同为使用内存池\n");
+        return false;
+    }
+    if (b->pool != NULL) {
+        treeNodePoolMerge(a->pool, b->pool);
+        b->pool = newTreeNodePool();
+    }
+    return true;
+}
+
+/* 并集：a = a ∪ b ，b 变为空树 */
+void avlUnion(AVLTree *a, AVLTree *b) {
+    if (!avlAdoptPool(a, b)) {
+        return;
+    }
+    a->root = avlUnionNodes(a->pool, a->root, b->root);
+    b->root = NULL;
+}
+
+/* 交集：a = a ∩ b ，b 变为空树 */
+void avlIntersect(AVLTree *a, AVLTree *b) {
+    if (!avlAdoptPool(a, b)) {
+        return;
+    }
+    a->root = avlIntersectNodes(a->pool, a->root, b->root);
+    b->root = NULL;
+}
+
+/* 差集：a = a - b ，b 变为空树 */
+void avlDifference(AVLTree *a, AVLTree *b) {
+    if (!avlAdoptPool(a, b)) {
+        return;
+    }
+    a->root = avlDifferenceNodes(a->pool, a->root, b->root);
+    b->root = NULL;
+}
+
+/* 检查子树是否为合法的 AVL 树（键在 (lo, hi) 内、高度与子树大小、和正确、平衡因子不超过 1），合法时返回节点数量，否则返回 -1 */
+long long avlValidateNode(TreeNode *node, long long lo, long long hi) {
+    if (node == NULL) {
+        return 0;
+    }
+    if (node->val <= lo || node->val >= hi) {
+        return -1;
+    }
+    long long ls = avlValidateNode(node->left, lo, node->val);
+    long long rs = avlValidateNode(node->right, node->val, hi);
+    int lh = height(node->left), rh = height(node->right);
+    if (ls < 0 || rs < 0 || node->height != (lh > rh ? lh : rh) + 1 || abs(lh - rh) > 1) {
+        return -1;
+    }
+    if (node->size != ls + rs + 1 || node->sum != nodeSum(node->left) + node->val + nodeSum(node->right)) {
+        return -1;
+    }
+    return ls + rs + 1;
+}
+
+/* 检查整棵树，合法时返回节点数量，否则返回 -1 */
+long long avlValidate(AVLTree *avl) {
+    return avlValidateNode(avl->root, (long long)INT_MIN - 1, (long long)INT_MAX + 1);
+}
@@ -0,0 +1,241 @@
+/**
+ * @FileName    :avl_tree_bulk_test.c
+ * @Date        :2026-10-20 07:20:31
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :AVL 树批量构建与集合运算测试程序
+ * @Description :1. 基本测试：从有序数组构建 AVL 树，并集、交集、差集
+ *               2. 正确性：随机集合（含空集、大小悬殊的集合，逐个 malloc 与内存池两种分配方式）的集合运算结果
+ *                  与有序数组归并的结果一致，结果是合法的 AVL 树，内存池中正在使用的节点数量正确
+ *               3. 性能：有序键（默认 10^6 个，-DBENCH_KEYS=10000000 可测试 10^7 个）逐个插入与批量构建的耗时；
+ *                  |a| = n ，|b| = n / 1000 ~ n 时，基于 join 的集合运算与逐个插入 / 查找 / 删除 b 中键的耗时。
+ */
+
+#include "../utils/bench_util.h"
+#include "avl_tree_bulk.c"
+
+#ifndef BENCH_KEYS
+#define BENCH_KEYS 1000000
+#endif
+
+/* 中序遍历，将节点值写入 res ，返回写入的数量 */
+int treeInorder(TreeNode *node, int *res, int size) {
+    if (node == NULL) {
+        return size;
+    }
+    size = treeInorder(node->left, res, size);
+    res[size++] = node->val;
+    return treeInorder(node->right, res, size);
+}
+
+/* 从 [0, range) 中随机选取 n 个不同的键，升序写入 res ，返回实际数量 */
+int randomSortedSet(unsigned long long *x, int range, int n, int *res) {
+    // 依次决定每个键是否选中（选择抽样），结果天然有序
+    int size = 0;
+    for (int k = 0; k < range && size < n; k++) {
+        if (randU32(x) % (range - k) < (unsigned int)(n - size)) {
+            res[size++] = k;
+        }
+    }
+    return size;
+}
+
+/* 有序数组的集合运算：op 为 0 / 1 / 2 分别表示并集 / 交集 / 差集，返回结果的数量 */
+int mergeSorted(const int *a, int na, const int *b, int nb, int op, int *res) {
+    int i = 0, j = 0, size = 0;
+    while (i < na || j < nb) {
+        if (j == nb || (i < na && a[i] < b[j])) {
+            if (op != 1) {
+                res[size++] = a[i];
+            }
+            i++;
+        } else if (i == na || b[j] < a[i]) {
+            if (op == 0) {
+                res[size++] = b[j];
+            }
+            j++;
+        } else {
+            if (op != 2) {
+                res[size++] = a[i];
+            }
+            i++;
+            j++;
+        }
+    }
+    return size;
+}
+
+/* 基本测试 */
+void testBasic() {
+    int nums[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    AVLTree *a = newAVLTree(), *b = newAVLTree();
+    avlBulkLoad(a, nums, 12);
+    printf("由有序数组 1 ~ 12 构建的 AVL 树：\n");
+    printTree(a->root);
+    assert(avlValidate(a) == 12);
+
+    int evens[] = {0, 2, 4, 6, 8, 10, 12, 14, 16};
+    const char *names[] = {"并集", "交集", "差集"};
+    for (int op = 0; op < 3; op++) {
+        avlBulkLoad(a, nums, 12);
+        avlBulkLoad(b, evens, 9);
+        if (op == 0) {
+            avlUnion(a, b);
+        } else if (op == 1) {
+            avlIntersect(a, b);
+        } else {
+            avlDifference(a, b);
+        }
+        int res[32], expect[32];
+        int size = treeInorder(a->root, res, 0), expectSize = mergeSorted(nums, 12, evens, 9, op, expect);
+        printf("\n{1 ~ 12} 与 {0, 2, ..., 16} 的%s：", names[op]);
+        printArray(res, size);
+        assert(b->root == NULL && size == expectSize && memcmp(res, expect, sizeof(int) * size) == 0);
+        assert(avlValidate(a) == size);
+    }
+    printTree(a->root);
+    delAVLTree(a);
+    delAVLTree(b);
+}
+
+/* 正确性 */
+void testValidate() {
+    int range = 20000;
+    int *numsA = malloc(sizeof(int) * range), *numsB = malloc(sizeof(int) * range);
+    int *res = malloc(sizeof(int) * range * 2), *expect = malloc(sizeof(int) * range * 2);
+    int sizes[] = {0, 1, 2, 10, 100, 1000, 10000};
+    unsigned long long x = 2026;
+    int cases = 0;
+    for (int pooled = 0; pooled < 2; pooled++) {
+        for (int i = 0; i < 7; i++) {
+            for (int j = 0; j < 7; j++) {
+                for (int op = 0; op < 3; op++) {
+                    int na = randomSortedSet(&x, range, sizes[i], numsA);
+                    int nb = randomSortedSet(&x, range, sizes[j], numsB);
+                    AVLTree *a = pooled ? newAVLTreePooled() : newAVLTree();
+                    AVLTree *b = pooled ? newAVLTreePooled() : newAVLTree();
+                    // a 由批量构建，b 由逐个插入构建，形状不同
+                    avlBulkLoad(a, numsA, na);
+                    for (int k = 0; k < nb; k++) {
+                        insert(b, numsB[(k * 7919) % nb]);
+                    }
+                    if (op == 0) {
+                        avlUnion(a, b);
+                    } else if (op == 1) {
+                        avlIntersect(a, b);
+                    } else {
+                        avlDifference(a, b);
+                    }
+                    int expectSize = mergeSorted(numsA, na, numsB, nb, op, expect);
+                    assert(avlValidate(a) == expectSize && b->root == NULL);
+                    assert(treeInorder(a->root, res, 0) == expectSize);
+                    assert(memcmp(res, expect, sizeof(int) * expectSize) == 0);
+                    assert(!pooled || (a->pool->live == expectSize && b->pool->live == 0));
+                    delAVLTree(a);
+                    delAVLTree(b);
+                    cases++;
+                }
+            }
+        }
+    }
+
+    /* split 与 join 的往返 */
+    int n = randomSortedSet(&x, range, 5000, numsA);
+    AVLTree *t = newAVLTree();
+    avlBulkLoad(t, numsA, n);
+    for (int q = 0; q < 200; q++) {
+        int key = randU32(&x) % range;
+        TreeNode *l, *mid, *r;
+        avlSplit(t->root, key, &l, &mid, &r);
+        AVLTree left = {l, NULL}, right = {r, NULL};
+        long long ls = avlValidate(&left), rs = avlValidate(&right);
+        assert(ls >= 0 && rs >= 0 && ls + rs + (mid != NULL) == n);
+        assert((l == NULL || treeInorder(l, res, 0) == ls) && (ls == 0 || res[ls - 1] < key));
+        t->root = mid != NULL ? avlJoin(l, mid, r) : avlJoin2(l, r);
+        assert(avlValidate(t) == n);
+    }
+    delAVLTree(t);
+    printf("%d 组随机集合运算与有序数组归并的结果一致，split / join 往返正确\n", cases);
+    free(numsA);
+    free(numsB);
+    free(res);
+    free(expect);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_KEYS;
+    int *nums = malloc(sizeof(int) * n), *other = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        nums[i] = 2 * i;
+    }
+    printf("%d 个有序键\n", n);
+
+    /* 构建 */
+    AVLTree *a = newAVLTree();
+    double start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        insert(a, nums[i]);
+    }
+    double tInsert = wallSeconds() - start;
+    int h = height(a->root);
+    start = wallSeconds();
+    avlBulkLoad(a, nums, n);
+    double tBulk = wallSeconds() - start;
+    printf("逐个插入 %.3f s（树高 %d），批量构建 %.3f s（树高 %d，不含释放原有节点）\n", tInsert, h, tBulk,
+           height(a->root));
+
+    /* 集合运算：a 为全部偶数键，b 从 [0, 2n) 中随机选取 m 个键，约一半与 a 重复 */
+    printf("%-10s %12s %12s %12s %12s %12s %12s\n", "|b|", "并集 join", "逐个插入", "交集 join", "逐个查找",
+           "差集 join", "逐个删除");
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    for (int m = n / 1000; m <= n; m *= 10) {
+        int nb = randomSortedSet(&x, 2 * n, m, other);
+        double t[6];
+        for (int op = 0; op < 3; op++) {
+            AVLTree *b = newAVLTree();
+            avlBulkLoad(a, nums, n);
+            avlBulkLoad(b, other, nb);
+            start = wallSeconds();
+            if (op == 0) {
+                avlUnion(a, b);
+            } else if (op == 1) {
+                avlIntersect(a, b);
+            } else {
+                avlDifference(a, b);
+            }
+            t[2 * op] = wallSeconds() - start;
+            delAVLTree(b);
+
+            /* 逐个处理 b 中的键 */
+            avlBulkLoad(a, nums, n);
+            AVLTree *c = newAVLTree();
+            start = wallSeconds();
+            for (int k = 0; k < nb; k++) {
+                if (op == 0) {
+                    insert(a, other[k]);
+                } else if (op == 1) {
+                    if (search(a, other[k]) != NULL) {
+                        insert(c, other[k]);
+                    }
+                } else {
+                    removeItem(a, other[k]);
+                }
+            }
+            t[2 * op + 1] = wallSeconds() - start;
+            delAVLTree(c);
+        }
+        printf("%-10d %12.4f %12.4f %12.4f %12.4f %12.4f %12.4f\n", nb, t[0], t[1], t[2], t[3], t[4], t[5]);
+    }
+    delAVLTree(a);
+    free(nums);
+    free(other);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,215 @@
+/**
+ * @FileName    :avl_tree_compact.c
+ * @Date        :2026-10-20 04:30:26
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :紧凑 AVL 树（32 位下标代替子节点指针）
+ * @Description :TreeNode 的两个子节点指针在 64 位平台上共占 16 字节，加上子树大小与和，节点大小为 40 字节（malloc 后约 48 字节）。
+ *               本文件的 AVL 树将所有节点存放在一个连续的数组中，子节点用 32 位下标表示，节点缩小为 16 字节，
+ *               同样的缓存与内存可以容纳更多节点。
+ *               1. 下标 0 为空节点哨兵，其高度为 -1 ，求高度时无需判断空节点。
+ *               2. 数组容量不足时按 2 倍扩容；下标在扩容后保持有效，因此递归调用返回后需重新通过 tree->nodes 访问节点。
+ *               3. 删除的节点通过 left 下标串成空闲链表，插入时优先复用。
+ *               旋转与插入、删除的逻辑与 avl_tree.c 相同。
+ */
+
+#include "../utils/common.h"
+#include <stdint.h>
+
+/* 紧凑节点：16 字节 */
+typedef struct {
+    int val;        // 节点值
+    int height;     // 节点高度
+    uint32_t left;  // 左子节点下标，0 表示空
+    uint32_t right; // 右子节点下标，0 表示空
+} TreeNode32;
+
+/* 紧凑 AVL 树结构体 */
+typedef struct {
+    TreeNode32 *nodes;  // 节点数组，nodes[0] 为空节点哨兵
+    uint32_t capacity;  // 数组容量
+    uint32_t used;      // 已使用过的下标数量（含哨兵）
+    uint32_t freeList;  // 空闲节点链表头，0 表示空
+    uint32_t root;      // 根节点下标
+    long long size;     // 节点数量
+} AVLTreeCompact;
+
+/* 构造函数，capacity 为预留的节点数量 */
+AVLTreeCompact *newAVLTreeCompact(uint32_t capacity) {
+    AVLTreeCompact *tree = malloc(sizeof(AVLTreeCompact));
+    tree->capacity = capacity < 16 ? 16 : capacity + 1;
+    tree->nodes = malloc(sizeof(TreeNode32) * tree->capacity);
+    tree->nodes[0] = (TreeNode32){0, -1, 0, 0};
+    tree->used = 1;
+    tree->freeList = 0;
+    tree->root = 0;
+    tree->size = 0;
+    return tree;
+}
+
+/* 析构函数 */
+void delAVLTreeCompact(AVLTreeCompact *tree) {
+    free(tree->nodes);
+    free(tree);
+}
+
+/* 分配节点，返回下标 */
+uint32_t avlcAlloc(AVLTreeCompact *tree, int val) {
+    uint32_t idx = tree->freeList;
+    if (idx != 0) {
+        tree->freeList = tree->nodes[idx].left;
+    } else {
+        if (tree->used == tree->capacity) {
+            if (tree->capacity > UINT32_MAX / 2) {
+                fprintf(stderr, "紧凑 AVL 树的节点数量超过 32 位下标范围\n");
+                exit(1);
+            }
+            tree->capacity *= 2;
+            tree->nodes = realloc(tree->nodes, sizeof(TreeNode32) * tree->capacity);
+        }
+        idx = tree->used++;
+    }
+    tree->nodes[idx] = (TreeNode32){val, 0, 0, 0};
+    tree->size++;
+    return idx;
+}
+
+/* 回收节点 */
+void avlcFree(AVLTreeCompact *tree, uint32_t idx) {
+    tree->nodes[idx].left = tree->freeList;
+    tree->freeList = idx;
+    tree->size--;
+}
+
+/* 更新节点高度 */
+void avlcUpdateHeight(TreeNode32 *nodes, uint32_t node) {
+    int lh = nodes[nodes[node].left].height, rh = nodes[nodes[node].right].height;
+    nodes[node].height = (lh > rh ? lh : rh) + 1;
+}
+
+/* 获取平衡因子 */
+int avlcBalanceFactor(TreeNode32 *nodes, uint32_t node) {
+    return nodes[nodes[node].left].height - nodes[nodes[node].right].height;
+}
+
+/* 右旋操作 */
+uint32_t avlcRightRotate(TreeNode32 *nodes, uint32_t node) {
+    uint32_t child = nodes[node].left, grandChild = nodes[child].right;
+    nodes[child].right = node;
+    nodes[node].left = grandChild;
+    avlcUpdateHeight(nodes, node);
+    avlcUpdateHeight(nodes, child);
+    return child;
+}
+
+/* 左旋操作 */
+uint32_t avlcLeftRotate(TreeNode32 *nodes, uint32_t node) {
+    uint32_t child = nodes[node].right, grandChild = nodes[child].left;
+    nodes[child].left = node;
+    nodes[node].right = grandChild;
+    avlcUpdateHeight(nodes, node);
+    avlcUpdateHeight(nodes, child);
+    return child;
+}
+
+/* 执行旋转操作，使该子树重新恢复平衡 */
+uint32_t avlcRotate(TreeNode32 *nodes, uint32_t node) {
+    int bf = avlcBalanceFactor(nodes, node);
+    if (bf > 1) {
+        if (avlcBalanceFactor(nodes, nodes[node].left) < 0) {
+            // 先左旋后右旋
+            nodes[node].left = avlcLeftRotate(nodes, nodes[node].left);
+        }
+        return avlcRightRotate(nodes, node);
+    }
+    if (bf < -1) {
+        if (avlcBalanceFactor(nodes, nodes[node].right) > 0) {
+            // 先右旋后左旋
+            nodes[node].right = avlcRightRotate(nodes, nodes[node].right);
+        }
+        return avlcLeftRotate(nodes, node);
+    }
+    return node;
+}
+
+/* 递归插入节点（辅助函数） */
+uint32_t avlcInsertHelper(AVLTreeCompact *tree, uint32_t node, int val) {
+    if (node == 0) {
+        return avlcAlloc(tree, val);
+    }
+    // 递归调用可能扩容节点数组，返回后再写入
+    uint32_t child;
+    if (tree->nodes[node].val > val) {
+        child = avlcInsertHelper(tree, tree->nodes[node].left, val);
+        tree->nodes[node].left = child;
+    } else if (tree->nodes[node].val < val) {
+        child = avlcInsertHelper(tree, tree->nodes[node].right, val);
+        tree->nodes[node].right = child;
+    } else {
+        return node;
+    }
+    avlcUpdateHeight(tree->nodes, node);
+    return avlcRotate(tree->nodes, node);
+}
+
+/* 插入节点 */
+void avlcInsert(AVLTreeCompact *tree, int val) {
+    tree->root = avlcInsertHelper(tree, tree->root, val);
+}
+
+/* 递归删除节点（辅助函数），删除不会扩容，可以直接使用 nodes */
+uint32_t avlcRemoveHelper(AVLTreeCompact *tree, uint32_t node, int val) {
+    TreeNode32 *nodes = tree->nodes;
+    if (node == 0) {
+        return 0;
+    }
+    if (nodes[node].val > val) {
+        nodes[node].left = avlcRemoveHelper(tree, nodes[node].left, val);
+    } else if (nodes[node].val < val) {
+        nodes[node].right = avlcRemoveHelper(tree, nodes[node].right, val);
+    } else if (nodes[node].left == 0 || nodes[node].right == 0) {
+        // 子节点数量 = 0 或 1 ，用子节点（可能为空）替换 node
+        uint32_t child = nodes[node].left != 0 ? nodes[node].left : nodes[node].right;
+        avlcFree(tree, node);
+        if (child == 0) {
+            return 0;
+        }
+        node = child;
+    } else {
+        // 子节点数量 = 2 ，用中序遍历的下个节点替换当前节点
+        uint32_t temp = nodes[node].right;
+        while (nodes[temp].left != 0) {
+            temp = nodes[temp].left;
+        }
+        int tempVal = nodes[temp].val;
+        nodes[node].right = avlcRemoveHelper(tree, nodes[node].right, tempVal);
+        nodes[node].val = tempVal;
+    }
+    avlcUpdateHeight(nodes, node);
+    return avlcRotate(nodes, node);
+}
+
+/* 删除节点 */
+void avlcRemove(AVLTreeCompact *tree, int val) {
+    tree->root = avlcRemoveHelper(tree, tree->root, val);
+}
+
+/* 查找节点，返回下标，未找到时返回 0 */
+uint32_t avlcSearch(AVLTreeCompact *tree, int val) {
+    TreeNode32 *nodes = tree->nodes;
+    uint32_t cur = tree->root;
+    while (cur != 0 && nodes[cur].val != val) {
+        cur = nodes[cur].val < val ? nodes[cur].right : nodes[cur].left;
+    }
+    return cur;
+}
+
+/* 中序遍历，将节点值写入 res ，返回写入的数量 */
+int avlcInorder(AVLTreeCompact *tree, uint32_t node, int *res, int size) {
+    if (node == 0) {
+        return size;
+    }
+    size = avlcInorder(tree, tree->nodes[node].left, res, size);
+    res[size++] = tree->nodes[node].val;
+    return avlcInorder(tree, tree->nodes[node].right, res, size);
+}
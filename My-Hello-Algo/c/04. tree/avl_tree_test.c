@@ -0,0 +1,61 @@
+/**
+ * @FileName    :avl_tree_test.c
+ * @Date        :2026-10-20 02:05:18
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :平衡二叉搜索树测试程序
+ * @Description :1. 插入：依次插入 1 ~ 10 ，每次插入后打印 AVL 树，观察旋转如何保持平衡；重复插入 7 时树不变
+ *               2. 删除：分别删除度为 0 、1 、2 的节点，删除后打印 AVL 树
+ *               3. 查找：查找节点 7 并打印节点值
+ */
+
+#include "avl_tree.c"
+
+/* 插入节点并打印 AVL 树 */
+void testInsert(AVLTree *tree, int val) {
+    insert(tree, val);
+    printf("\n插入节点 %d 后，AVL 树为 \n", val);
+    printTree(tree->root);
+}
+
+/* 删除节点并打印 AVL 树 */
+void testRemove(AVLTree *tree, int val) {
+    removeItem(tree, val);
+    printf("\n删除节点 %d 后，AVL 树为 \n", val);
+    printTree(tree->root);
+}
+
+/* Driver Code */
+int main() {
+    /* 初始化空 AVL 树 */
+    AVLTree *tree = (AVLTree *)newAVLTree();
+    /* 插入节点 */
+    // 请关注插入节点后，AVL 树是如何保持平衡的
+    testInsert(tree, 1);
+    testInsert(tree, 2);
+    testInsert(tree, 3);
+    testInsert(tree, 4);
+    testInsert(tree, 5);
+    testInsert(tree, 8);
+    testInsert(tree, 7);
+    testInsert(tree, 9);
+    testInsert(tree, 10);
+    testInsert(tree, 6);
+
+    /* 插入重复节点 */
+    testInsert(tree, 7);
+
+    /* 删除节点 */
+    // 请关注删除节点后，AVL 树是如何保持平衡的
+    testRemove(tree, 8); // 删除度为 0 的节点
+    testRemove(tree, 5); // 删除度为 1 的节点
+    testRemove(tree, 4); // 删除度为 2 的节点
+
+    /* 查询节点 */
+    TreeNode *node = search(tree, 7);
+    printf("\n查找到的节点对象节点值 = %d \n", node->val);
+
+    // 释放内存
+    delAVLTree(tree);
+    return 0;
+}
@@ -0,0 +1,599 @@
+/**
+ * @FileName    :b_plus_tree.c
+ * @Date        :2026-10-20 02:18:44
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :缓存友好的 B+ 树（有序索引，int 键 -> int 值）
+ * @Description :AVL 树每个键一个节点，查找时每层一次缓存失效，10^8 个键约需 27 次相互依赖的访存。
+ *               B+ 树每个节点占 BPT_NODE_LINES 个缓存行（默认 4 ，可通过 -DBPT_NODE_LINES=1 ~ 16 调整），
+ *               一个节点容纳数十个键，树高只有 log_B(n) ，节点内的键连续存放，顺序访问对硬件预取友好。
+ *               1. 内部节点：keys[0..count) 与 children[0..count] 分开存放，查找时只扫描键数组；
+ *                  children[i] 中的键 k 满足 keys[i - 1] <= k < keys[i] 。
+ *               2. 叶节点：存放键值对，并通过 next 串成有序链表，范围查询找到起点后沿链表顺序扫描。
+ *               3. 插入：找到叶节点后插入，节点溢出时分裂为两半，将分隔键插入父节点，必要时逐层向上分裂。
+ *               4. 删除：从叶节点删除，键数少于一半时先向相邻兄弟借一个键，兄弟也不足一半时与其合并，
+ *                  并从父节点删除分隔键，必要时逐层向上调整；根节点只剩一个子节点时树高减一。
+ *               5. 批量构建：由有序数组按填充率依次装满叶节点，再自底向上逐层建立内部节点，O(n) 时间。
+ *               节点按缓存行对齐分配。查找与修改均为迭代实现，下降时记录路径，无需父指针。
+ *               节点内查找使用 simd_search.c 中的 nodeRank ，运行时选择 AVX2 / SSE4 / 无分支实现。
+ */
+
+#include "../utils/common.h"
+#include "../07. searching/simd_search.c"
+
+#ifdef _WIN32
+#include <malloc.h>
+#define bptAlignedAlloc(size) _aligned_malloc(size, 64)
+#define bptAlignedFree(ptr) _aligned_free(ptr)
+#else
+#define bptAlignedAlloc(size) aligned_alloc(64, size)
+#define bptAlignedFree(ptr) free(ptr)
+#endif
+
+// 每个节点占用的缓存行数量
+#ifndef BPT_NODE_LINES
+#define BPT_NODE_LINES 4
+#endif
+#define BPT_NODE_BYTES (64 * BPT_NODE_LINES)
+// 内部节点的最大键数量：8 字节头部 + K 个键 + (K + 1) 个子节点指针
+#define BPT_INNER_KEYS ((BPT_NODE_BYTES - 16) / 12)
+// 叶节点的最大键数量：8 字节头部 + 8 字节 next 指针 + L 个键值对
+#define BPT_LEAF_KEYS ((BPT_NODE_BYTES - 16) / 8)
+// 最大树高（每层至少一半满，32 层足以容纳任意 int 键集合）
+#define BPT_MAX_HEIGHT 32
+
+/* 节点公共头部 */
+typedef struct {
+    int count; // 键数量
+    int leaf;  // 是否为叶节点
+} BPTNode;
+
+/* 内部节点 */
+typedef struct {
+    int count;
+    int leaf;
+    int keys[BPT_INNER_KEYS];
+    BPTNode *children[BPT_INNER_KEYS + 1];
+} BPTInner;
+
+/* 叶节点 */
+typedef struct BPTLeaf {
+    int count;
+    int leaf;
+    struct BPTLeaf *next; // 右侧相邻叶节点
+    int keys[BPT_LEAF_KEYS];
+    int vals[BPT_LEAF_KEYS];
+} BPTLeaf;
+
+_Static_assert(sizeof(BPTInner) <= BPT_NODE_BYTES, "BPTInner exceeds node size");
+_Static_assert(sizeof(BPTLeaf) <= BPT_NODE_BYTES, "BPTLeaf exceeds node size");
+
+/* B+ 树 */
+typedef struct {
+    BPTNode *root;
+    int height;         // 树高，只有一个叶节点时为 1 ，空树为 0
+    long long size;     // 键数量
+    long long nodeNum;  // 节点数量
+} BPlusTree;
+
+/* 构造函数 */
+BPlusTree *newBPlusTree() {
+    BPlusTree *tree = malloc(sizeof(BPlusTree));
+    tree->root = NULL;
+    tree->height = 0;
+    tree->size = 0;
+    tree->nodeNum = 0;
+    return tree;
+}
+
+/* 释放子树 */
+void bptFreeNode(BPTNode *node) {
+    if (!node->leaf) {
+        BPTInner *inner = (BPTInner *)node;
+        for (int i = 0; i <= inner->count; i++) {
+            bptFreeNode(inner->children[i]);
+        }
+    }
+    bptAlignedFree(node);
+}
+
+/* 析构函数 */
+void delBPlusTree(BPlusTree *tree) {
+    if (tree->root != NULL) {
+        bptFreeNode(tree->root);
+    }
+    free(tree);
+}
+
+/* 分配叶节点 */
+BPTLeaf *bptNewLeaf(BPlusTree *tree) {
+    BPTLeaf *leaf = bptAlignedAlloc(BPT_NODE_BYTES);
+    leaf->count = 0;
+    leaf->leaf = 1;
+    leaf->next = NULL;
+    tree->nodeNum++;
+    return leaf;
+}
+
+/* 分配内部节点 */
+BPTInner *bptNewInner(BPlusTree *tree) {
+    BPTInner *inner = bptAlignedAlloc(BPT_NODE_BYTES);
+    inner->count = 0;
+    inner->leaf = 0;
+    tree->nodeNum++;
+    return inner;
+}
+
+/* 释放单个节点 */
+void bptDropNode(BPlusTree *tree, void *node) {
+    bptAlignedFree(node);
+    tree->nodeNum--;
+}
+
+/* 节点内查找：返回小于 key 的键数量 */
+int bptLowerBound(const int *keys, int count, int key) {
+    return nodeRank(keys, count, key);
+}
+
+/* 节点内查找：返回小于等于 key 的键数量，即下降时应进入的子节点下标 */
+int bptUpperBound(const int *keys, int count, int key) {
+    return nodeRankUpper(keys, count, key);
+}
+
+/* 查找 key 所在的叶节点 */
+BPTLeaf *bptFindLeaf(BPlusTree *tree, int key) {
+    BPTNode *node = tree->root;
+    if (node == NULL) {
+        return NULL;
+    }
+    while (!node->leaf) {
+        BPTInner *inner = (BPTInner *)node;
+        node = inner->children[bptUpperBound(inner->keys, inner->count, key)];
+    }
+    return (BPTLeaf *)node;
+}
+
+/* 查找键，找到时将值写入 val（可为 NULL）并返回 true */
+bool bptSearch(BPlusTree *tree, int key, int *val) {
+    BPTLeaf *leaf = bptFindLeaf(tree, key);
+    if (leaf == NULL) {
+        return false;
+    }
+    int pos = bptLowerBound(leaf->keys, leaf->count, key);
+    if (pos < leaf->count && leaf->keys[pos] == key) {
+        if (val != NULL) {
+            *val = leaf->vals[pos];
+        }
+        return true;
+    }
+    return false;
+}
+
+/* 插入键值对，键已存在时更新值并返回 false */
+bool bptInsert(BPlusTree *tree, int key, int val) {
+    if (tree->root == NULL) {
+        BPTLeaf *leaf = bptNewLeaf(tree);
+        leaf->keys[0] = key;
+        leaf->vals[0] = val;
+        leaf->count = 1;
+        tree->root = (BPTNode *)leaf;
+        tree->height = 1;
+        tree->size = 1;
+        return true;
+    }
+    /* 1. 下降到叶节点，记录路径 */
+    BPTInner *path[BPT_MAX_HEIGHT];
+    int idx[BPT_MAX_HEIGHT], depth = 0;
+    BPTNode *node = tree->root;
+    while (!node->leaf) {
+        BPTInner *inner = (BPTInner *)node;
+        int i = bptUpperBound(inner->keys, inner->count, key);
+        path[depth] = inner;
+        idx[depth++] = i;
+        node = inner->children[i];
+    }
+    BPTLeaf *leaf = (BPTLeaf *)node;
+    int pos = bptLowerBound(leaf->keys, leaf->count, key);
+    if (pos < leaf->count && leaf->keys[pos] == key) {
+        leaf->vals[pos] = val;
+        return false;
+    }
+    tree->size++;
+
+    /* 2. 插入叶节点，未满时直接插入 */
+    if (leaf->count < BPT_LEAF_KEYS) {
+        memmove(leaf->keys + pos + 1, leaf->keys + pos, sizeof(int) * (leaf->count - pos));
+        memmove(leaf->vals + pos + 1, leaf->vals + pos, sizeof(int) * (leaf->count - pos));
+        leaf->keys[pos] = key;
+        leaf->vals[pos] = val;
+        leaf->count++;
+        return true;
+    }
+    // 叶节点已满：合并为 BPT_LEAF_KEYS + 1 个键值对后对半分裂
+    int tk[BPT_LEAF_KEYS + 1], tv[BPT_LEAF_KEYS + 1];
+    memcpy(tk, leaf->keys, sizeof(int) * pos);
+    memcpy(tv, leaf->vals, sizeof(int) * pos);
+    tk[pos] = key;
+    tv[pos] = val;
+    memcpy(tk + pos + 1, leaf->keys + pos, sizeof(int) * (BPT_LEAF_KEYS - pos));
+    memcpy(tv + pos + 1, leaf->vals + pos, sizeof(int) * (BPT_LEAF_KEYS - pos));
+    int mid = (BPT_LEAF_KEYS + 1) / 2;
+    BPTLeaf *right = bptNewLeaf(tree);
+    memcpy(leaf->keys, tk, sizeof(int) * mid);
+    memcpy(leaf->vals, tv, sizeof(int) * mid);
+    leaf->count = mid;
+    right->count = BPT_LEAF_KEYS + 1 - mid;
+    memcpy(right->keys, tk + mid, sizeof(int) * right->count);
+    memcpy(right->vals, tv + mid, sizeof(int) * right->count);
+    right->next = leaf->next;
+    leaf->next = right;
+    int sep = right->keys[0];
+    BPTNode *newChild = (BPTNode *)right;
+
+    /* 3. 将分隔键与新节点插入父节点，父节点溢出时继续分裂 */
+    while (depth > 0) {
+        BPTInner *parent = path[--depth];
+        int i = idx[depth];
+        if (parent->count < BPT_INNER_KEYS) {
+            memmove(parent->keys + i + 1, parent->keys + i, sizeof(int) * (parent->count - i));
+            memmove(parent->children + i + 2, parent->children + i + 1, sizeof(BPTNode *) * (parent->count - i));
+            parent->keys[i] = sep;
+            parent->children[i + 1] = newChild;
+            parent->count++;
+            return true;
+        }
+        int ik[BPT_INNER_KEYS + 1];
+        BPTNode *ic[BPT_INNER_KEYS + 2];
+        memcpy(ik, parent->keys, sizeof(int) * i);
+        ik[i] = sep;
+        memcpy(ik + i + 1, parent->keys + i, sizeof(int) * (BPT_INNER_KEYS - i));
+        memcpy(ic, parent->children, sizeof(BPTNode *) * (i + 1));
+        ic[i + 1] = newChild;
+        memcpy(ic + i + 2, parent->children + i + 1, sizeof(BPTNode *) * (BPT_INNER_KEYS - i));
+        // 左半保留 mid 个键，第 mid 个键上移到父节点，其余进入右半
+        mid = (BPT_INNER_KEYS + 1) / 2;
+        BPTInner *rightInner = bptNewInner(tree);
+        memcpy(parent->keys, ik, sizeof(int) * mid);
+        memcpy(parent->children, ic, sizeof(BPTNode *) * (mid + 1));
+        parent->count = mid;
+        rightInner->count = BPT_INNER_KEYS - mid;
+        memcpy(rightInner->keys, ik + mid + 1, sizeof(int) * rightInner->count);
+        memcpy(rightInner->children, ic + mid + 1, sizeof(BPTNode *) * (rightInner->count + 1));
+        sep = ik[mid];
+        newChild = (BPTNode *)rightInner;
+    }
+    /* 4. 根节点分裂，树高加一 */
+    BPTInner *root = bptNewInner(tree);
+    root->count = 1;
+    root->keys[0] = sep;
+    root->children[0] = tree->root;
+    root->children[1] = newChild;
+    tree->root = (BPTNode *)root;
+    tree->height++;
+    return true;
+}
+
+/* 从内部节点删除第 i 个键及其右侧子节点 */
+void bptInnerErase(BPTInner *inner, int i) {
+    memmove(inner->keys + i, inner->keys + i + 1, sizeof(int) * (inner->count - i - 1));
+    memmove(inner->children + i + 1, inner->children + i + 2, sizeof(BPTNode *) * (inner->count - i - 1));
+    inner->count--;
+}
+
+/* 调整下溢的叶节点 node（父节点中下标为 i），返回 false 表示父节点无需继续调整 */
+bool bptFixLeaf(BPlusTree *tree, BPTInner *parent, int i, BPTLeaf *node) {
+    int minKeys = BPT_LEAF_KEYS / 2;
+    BPTLeaf *left = i > 0 ? (BPTLeaf *)parent->children[i - 1] : NULL;
+    BPTLeaf *right = i < parent->count ? (BPTLeaf *)parent->children[i + 1] : NULL;
+    if (left != NULL && left->count > minKeys) {
+        // 向左兄弟借最大的键
+        memmove(node->keys + 1, node->keys, sizeof(int) * node->count);
+        memmove(node->vals + 1, node->vals, sizeof(int) * node->count);
+        left->count--;
+        node->keys[0] = left->keys[left->count];
+        node->vals[0] = left->vals[left->count];
+        node->count++;
+        parent->keys[i - 1] = node->keys[0];
+        return false;
+    }
+    if (right != NULL && right->count > minKeys) {
+        // 向右兄弟借最小的键
+        node->keys[node->count] = right->keys[0];
+        node->vals[node->count] = right->vals[0];
+        node->count++;
+        right->count--;
+        memmove(right->keys, right->keys + 1, sizeof(int) * right->count);
+        memmove(right->vals, right->vals + 1, sizeof(int) * right->count);
+        parent->keys[i] = right->keys[0];
+        return false;
+    }
+    // 与兄弟合并：统一将右侧节点并入左侧节点
+    if (left == NULL) {
+        left = node;
+        node = right;
+        i++;
+    }
+    memcpy(left->keys + left->count, node->keys, sizeof(int) * node->count);
+    memcpy(left->vals + left->count, node->vals, sizeof(int) * node->count);
+    left->count += node->count;
+    left->next = node->next;
+    bptDropNode(tree, node);
+    bptInnerErase(parent, i - 1);
+    return parent->count < BPT_INNER_KEYS / 2;
+}
+
+/* 调整下溢的内部节点 node（父节点中下标为 i），返回 false 表示父节点无需继续调整 */
+bool bptFixInner(BPlusTree *tree, BPTInner *parent, int i, BPTInner *node) {
+    int minKeys = BPT_INNER_KEYS / 2;
+    BPTInner *left = i > 0 ? (BPTInner *)parent->children[i - 1] : NULL;
+    BPTInner *right = i < parent->count ? (BPTInner *)parent->children[i + 1] : NULL;
+    if (left != NULL && left->count > minKeys) {
+        // 父节点的分隔键下移到 node 最前，左兄弟最大的键上移到父节点
+        memmove(node->keys + 1, node->keys, sizeof(int) * node->count);
+        memmove(node->children + 1, node->children, sizeof(BPTNode *) * (node->count + 1));
+        node->keys[0] = parent->keys[i - 1];
+        node->children[0] = left->children[left->count];
+        node->count++;
+        parent->keys[i - 1] = left->keys[left->count - 1];
+        left->count--;
+        return false;
+    }
+    if (right != NULL && right->count > minKeys) {
+        // 父节点的分隔键下移到 node 末尾，右兄弟最小的键上移到父节点
+        node->keys[node->count] = parent->keys[i];
+        node->children[node->count + 1] = right->children[0];
+        node->count++;
+        parent->keys[i] = right->keys[0];
+        memmove(right->keys, right->keys + 1, sizeof(int) * (right->count - 1));
+        memmove(right->children, right->children + 1, sizeof(BPTNode *) * right->count);
+        right->count--;
+        return false;
+    }
+    // 与兄弟合并：左节点 + 分隔键 + 右节点
+    if (left == NULL) {
+        left = node;
+        node = right;
+        i++;
+    }
+    left->keys[left->count] = parent->keys[i - 1];
+    memcpy(left->keys + left->count + 1, node->keys, sizeof(int) * node->count);
+    memcpy(left->children + left->count + 1, node->children, sizeof(BPTNode *) * (node->count + 1));
+    left->count += node->count + 1;
+    bptDropNode(tree, node);
+    bptInnerErase(parent, i - 1);
+    return parent->count < minKeys;
+}
+
+/* 删除键，键不存在时返回 false */
+bool bptRemove(BPlusTree *tree, int key) {
+    if (tree->root == NULL) {
+        return false;
+    }
+    BPTInner *path[BPT_MAX_HEIGHT];
+    int idx[BPT_MAX_HEIGHT], depth = 0;
+    BPTNode *node = tree->root;
+    while (!node->leaf) {
+        BPTInner *inner = (BPTInner *)node;
+        int i = bptUpperBound(inner->keys, inner->count, key);
+        path[depth] = inner;
+        idx[depth++] = i;
+        node = inner->children[i];
+    }
+    BPTLeaf *leaf = (BPTLeaf *)node;
+    int pos = bptLowerBound(leaf->keys, leaf->count, key);
+    if (pos >= leaf->count || leaf->keys[pos] != key) {
+        return false;
+    }
+    leaf->count--;
+    memmove(leaf->keys + pos, leaf->keys + pos + 1, sizeof(int) * (leaf->count - pos));
+    memmove(leaf->vals + pos, leaf->vals + pos + 1, sizeof(int) * (leaf->count - pos));
+    tree->size--;
+
+    /* 自底向上调整下溢的节点 */
+    if (depth > 0 && leaf->count < BPT_LEAF_KEYS / 2) {
+        depth--;
+        bool underflow = bptFixLeaf(tree, path[depth], idx[depth], leaf);
+        while (underflow && depth > 0) {
+            depth--;
+            underflow = bptFixInner(tree, path[depth], idx[depth], path[depth + 1]);
+        }
+    }
+    /* 根节点为空时降低树高 */
+    BPTNode *root = tree->root;
+    if (!root->leaf && root->count == 0) {
+        tree->root = ((BPTInner *)root)->children[0];
+        bptDropNode(tree, root);
+        tree->height--;
+    } else if (root->leaf && root->count == 0) {
+        bptDropNode(tree, root);
+        tree->root = NULL;
+        tree->height = 0;
+    }
+    return true;
+}
+
+/* 批量构建时的分组数量：m 个元素均分为若干组，每组不超过 cap 个，且只有一组以外时不少于 per 个 */
+long long bptBulkGroups(long long m, int cap, int per) {
+    long long groups = (m + cap - 1) / cap, byFill = m / per;
+    if (byFill > groups) {
+        groups = byFill;
+    }
+    return groups < 1 ? 1 : groups;
+}
+
+/* 批量构建：由严格递增的键 keys 与对应的值 vals（为 NULL 时值取下标）构建 B+ 树，替换树中原有的内容 */
+// 先将键值对依次装入叶节点（每个节点约填充 fill 比例，取值 0.5 ~ 1 ，1 为装满），
+// 再自底向上逐层为相邻的节点建立父节点，分隔键取右侧子树的最小键，O(n) 时间，无需分裂。
+// 最后一组若不足半满会拖累查找，因此每层按组数均分，保证每个节点都满足最小键数量。
+void bptBulkLoad(BPlusTree *tree, const int *keys, const int *vals, long long n, double fill) {
+    if (tree->root != NULL) {
+        bptFreeNode(tree->root);
+    }
+    tree->root = NULL;
+    tree->height = 0;
+    tree->size = 0;
+    tree->nodeNum = 0;
+    if (n <= 0) {
+        return;
+    }
+    fill = fill < 0.5 ? 0.5 : fill > 1 ? 1 : fill;
+    int leafPer = (int)(BPT_LEAF_KEYS * fill), innerPer = (int)((BPT_INNER_KEYS + 1) * fill);
+    leafPer = leafPer < BPT_LEAF_KEYS / 2 ? BPT_LEAF_KEYS / 2 : leafPer;
+    innerPer = innerPer < BPT_INNER_KEYS / 2 + 1 ? BPT_INNER_KEYS / 2 + 1 : innerPer;
+
+    /* 1. 装入叶节点，并串成链表 */
+    long long cnt = bptBulkGroups(n, BPT_LEAF_KEYS, leafPer), pos = 0;
+    BPTNode **level = malloc(sizeof(BPTNode *) * cnt);
+    int *minKeys = malloc(sizeof(int) * cnt);
+    BPTLeaf *prev = NULL;
+    for (long long g = 0; g < cnt; g++) {
+        BPTLeaf *leaf = bptNewLeaf(tree);
+        leaf->count = (int)(n / cnt + (g < n % cnt));
+        memcpy(leaf->keys, keys + pos, sizeof(int) * leaf->count);
+        for (int i = 0; i < leaf->count; i++) {
+            leaf->vals[i] = vals != NULL ? vals[pos + i] : (int)(pos + i);
+        }
+        if (prev != NULL) {
+            prev->next = leaf;
+        }
+        prev = leaf;
+        level[g] = (BPTNode *)leaf;
+        minKeys[g] = keys[pos];
+        pos += leaf->count;
+    }
+    tree->height = 1;
+
+    /* 2. 自底向上逐层建立内部节点，新一层原地写入 level 的前部 */
+    while (cnt > 1) {
+        long long parents = bptBulkGroups(cnt, BPT_INNER_KEYS + 1, innerPer);
+        pos = 0;
+        for (long long p = 0; p < parents; p++) {
+            int c = (int)(cnt / parents + (p < cnt % parents));
+            BPTInner *inner = bptNewInner(tree);
+            inner->count = c - 1;
+            for (int i = 0; i < c; i++) {
+                inner->children[i] = level[pos + i];
+                if (i > 0) {
+                    inner->keys[i - 1] = minKeys[pos + i];
+                }
+            }
+            level[p] = (BPTNode *)inner;
+            minKeys[p] = minKeys[pos];
+            pos += c;
+        }
+        cnt = parents;
+        tree->height++;
+    }
+    tree->root = level[0];
+    tree->size = n;
+    free(level);
+    free(minKeys);
+}
+
+/* 范围查询：按升序输出 [lo, hi] 内的键值对（至多 capacity 个，vals 可为 NULL），返回输出的数量 */
+int bptRange(BPlusTree *tree, int lo, int hi, int *keys, int *vals, int capacity) {
+    BPTLeaf *leaf = bptFindLeaf(tree, lo);
+    int cnt = 0;
+    if (leaf == NULL) {
+        return 0;
+    }
+    int pos = bptLowerBound(leaf->keys, leaf->count, lo);
+    while (leaf != NULL && cnt < capacity) {
+        for (; pos < leaf->count && cnt < capacity; pos++) {
+            if (leaf->keys[pos] > hi) {
+                return cnt;
+            }
+            keys[cnt] = leaf->keys[pos];
+            if (vals != NULL) {
+                vals[cnt] = leaf->vals[pos];
+            }
+            cnt++;
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    return cnt;
+}
+
+/* 检查子树：键有序且位于 [lo, hi) ，节点键数量合法，所有叶节点深度相同；返回子树的键数量，不合法时返回 -1 */
+long long bptValidateNode(BPTNode *node, long long lo, long long hi, int depth, int height, bool isRoot,
+                          BPTLeaf **prevLeaf) {
+    int minKeys = isRoot ? 1 : (node->leaf ? BPT_LEAF_KEYS / 2 : BPT_INNER_KEYS / 2);
+    int maxKeys = node->leaf ? BPT_LEAF_KEYS : BPT_INNER_KEYS;
+    const int *keys = node->leaf ? ((BPTLeaf *)node)->keys : ((BPTInner *)node)->keys;
+    if (node->count < minKeys || node->count > maxKeys) {
+        return -1;
+    }
+    for (int i = 0; i < node->count; i++) {
+        if (keys[i] < lo || keys[i] >= hi || (i > 0 && keys[i - 1] >= keys[i])) {
+            return -1;
+        }
+    }
+    if (node->leaf) {
+        // 叶节点深度一致，且叶链表按从左到右的顺序连接
+        if (depth != height || (*prevLeaf != NULL && (*prevLeaf)->next != (BPTLeaf *)node)) {
+            return -1;
+        }
+        *prevLeaf = (BPTLeaf *)node;
+        return node->count;
+    }
+    BPTInner *inner = (BPTInner *)node;
+    long long total = 0;
+    for (int i = 0; i <= inner->count; i++) {
+        long long clo = i == 0 ? lo : inner->keys[i - 1];
+        long long chi = i == inner->count ? hi : inner->keys[i];
+        long long cnt = bptValidateNode(inner->children[i], clo, chi, depth + 1, height, false, prevLeaf);
+        if (cnt < 0) {
+            return -1;
+        }
+        total += cnt;
+    }
+    return total;
+}
+
+/* 检查整棵树的结构是否合法 */
+bool bptValidate(BPlusTree *tree) {
+    if (tree->root == NULL) {
+        return tree->size == 0 && tree->height == 0;
+    }
+    BPTLeaf *prevLeaf = NULL;
+    long long cnt = bptValidateNode(tree->root, INT_MIN, (long long)INT_MAX + 1, 1, tree->height, true, &prevLeaf);
+    return cnt == tree->size && prevLeaf->next == NULL;
+}
+
+/* 按层打印 B+ 树的键 */
+void printBPlusTree(BPlusTree *tree) {
+    if (tree->root == NULL) {
+        printf("（空树）\n");
+        return;
+    }
+    // 每层最左侧节点，逐层展开
+    BPTNode **level = malloc(sizeof(BPTNode *) * (tree->nodeNum + 1));
+    BPTNode **next = malloc(sizeof(BPTNode *) * (tree->nodeNum + 1));
+    int size = 1;
+    level[0] = tree->root;
+    while (size > 0) {
+        int nextSize = 0;
+        for (int j = 0; j < size; j++) {
+            BPTNode *node = level[j];
+            const int *keys = node->leaf ? ((BPTLeaf *)node)->keys : ((BPTInner *)node)->keys;
+            printf("[");
+            for (int i = 0; i < node->count; i++) {
+                printf(i == 0 ? "%d" : " %d", keys[i]);
+            }
+            printf("] ");
+            if (!node->leaf) {
+                for (int i = 0; i <= node->count; i++) {
+                    next[nextSize++] = ((BPTInner *)node)->children[i];
+                }
+            }
+        }
+        printf("\n");
+        BPTNode **tmp = level;
+        level = next;
+        next = tmp;
+        size = nextSize;
+    }
+    free(level);
+    free(next);
+}
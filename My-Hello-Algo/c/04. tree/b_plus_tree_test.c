@@ -0,0 +1,307 @@
+/**
+ * @FileName    :b_plus_tree_test.c
+ * @Date        :2026-10-20 02:46:30
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :B+ 树测试程序
+ * @Description :1. 基本测试：插入、查找、范围查询、删除，并打印树的结构
+ *               2. 正确性：随机插入 / 删除 / 查找 / 范围查询，与有序数组的结果对比，并检查树结构；
+ *                  不同规模与填充率下批量构建的树结构合法
+ *               3. 性能：随机键（默认 10^6 个，-DBENCH_KEYS=100000000 可测试 10^8 个）的插入、点查询、范围查询，
+ *                  与 AVL 树、二叉搜索树对比；AVL 树与二叉搜索树的范围查询为中序遍历剪枝。
+ *                  另外给出由有序数组批量构建的耗时，并对比节点内查找的各实现（朴素 / 无分支 / SSE4 / AVX2）下的点查询耗时。
+ */
+
+#include "../utils/bench_util.h"
+
+// 二叉搜索树与 AVL 树的函数同名，包含前先重命名
+#define search bstSearch
+#define insert bstInsert
+#define removeItem bstRemoveItem
+#include "binary_search_tree.c"
+#undef search
+#undef insert
+#undef removeItem
+#include "avl_tree.c"
+#include "b_plus_tree.c"
+
+#ifndef BENCH_KEYS
+#define BENCH_KEYS 1000000
+#endif
+// 范围查询的次数与每次查询的键数量
+#define BENCH_RANGES 10000
+#define BENCH_RANGE_LEN 100
+
+/* 中序遍历统计 [lo, hi] 内的键数量，跳过范围外的子树 */
+int treeRangeCount(TreeNode *node, int lo, int hi) {
+    int cnt = 0;
+    while (node != NULL) {
+        if (node->val < lo) {
+            node = node->right;
+        } else if (node->val > hi) {
+            node = node->left;
+        } else {
+            cnt += 1 + treeRangeCount(node->left, lo, hi);
+            node = node->right;
+        }
+    }
+    return cnt;
+}
+
+/* 基本测试 */
+void testBasic() {
+    BPlusTree *tree = newBPlusTree();
+    printf("节点大小 %d 字节：内部节点最多 %d 个键，叶节点最多 %d 个键值对\n", BPT_NODE_BYTES, BPT_INNER_KEYS,
+           BPT_LEAF_KEYS);
+    for (int i = 0; i < 200; i++) {
+        bptInsert(tree, (i * 37) % 200, i);
+    }
+    printf("插入 200 个键后，树高 %d ，节点数 %lld ：\n", tree->height, tree->nodeNum);
+    printBPlusTree(tree);
+    assert(bptValidate(tree));
+
+    int val;
+    assert(bptSearch(tree, 74, &val) && val == 2);
+    assert(!bptSearch(tree, 200, NULL));
+    assert(!bptInsert(tree, 74, -1) && bptSearch(tree, 74, &val) && val == -1);
+
+    int keys[16];
+    int cnt = bptRange(tree, 95, 105, keys, NULL, 16);
+    printf("范围 [95, 105] 内的键：");
+    for (int i = 0; i < cnt; i++) {
+        printf("%d ", keys[i]);
+        assert(keys[i] == 95 + i);
+    }
+    printf("\n");
+    assert(cnt == 11);
+
+    for (int i = 0; i < 200; i += 2) {
+        assert(bptRemove(tree, i));
+    }
+    assert(!bptRemove(tree, 0));
+    printf("删除所有偶数键后，树高 %d ，节点数 %lld ：\n", tree->height, tree->nodeNum);
+    printBPlusTree(tree);
+    assert(bptValidate(tree) && tree->size == 100);
+    for (int i = 1; i < 200; i += 2) {
+        assert(bptRemove(tree, i));
+    }
+    assert(tree->root == NULL && tree->nodeNum == 0 && bptValidate(tree));
+    delBPlusTree(tree);
+}
+
+/* 正确性 */
+void testValidate() {
+    int range = 20000, ops = 400000;
+    // exist[k] 为键 k 当前的值，-1 表示不存在
+    int *exist = malloc(sizeof(int) * range);
+    int *keys = malloc(sizeof(int) * range), *vals = malloc(sizeof(int) * range);
+    for (int k = 0; k < range; k++) {
+        exist[k] = -1;
+    }
+    BPlusTree *tree = newBPlusTree();
+    unsigned long long x = 2026;
+    long long size = 0;
+    for (int op = 0; op < ops; op++) {
+        // 前半段插入较多，后半段删除较多，使树先增高再降低
+        int k = randU32(&x) % range, r = randU32(&x) % 10;
+        int insertRatio = op < ops / 2 ? 6 : 3;
+        if (r < insertRatio) {
+            assert(bptInsert(tree, k, op) == (exist[k] < 0));
+            size += exist[k] < 0;
+            exist[k] = op;
+        } else if (r < 9) {
+            assert(bptRemove(tree, k) == (exist[k] >= 0));
+            size -= exist[k] >= 0;
+            exist[k] = -1;
+        } else {
+            int lo = k, hi = k + randU32(&x) % 200, cnt = bptRange(tree, lo, hi, keys, vals, range);
+            int expect = 0;
+            for (int j = lo; j <= hi && j < range; j++) {
+                if (exist[j] >= 0) {
+                    assert(keys[expect] == j && vals[expect] == exist[j]);
+                    expect++;
+                }
+            }
+            assert(cnt == expect);
+        }
+        int val;
+        k = randU32(&x) % range;
+        assert(bptSearch(tree, k, &val) == (exist[k] >= 0) && (exist[k] < 0 || val == exist[k]));
+        if (op % 20000 == 0) {
+            assert(bptValidate(tree) && tree->size == size);
+        }
+    }
+    assert(bptValidate(tree) && tree->size == size);
+    // 删除剩余的键
+    for (int k = 0; k < range; k++) {
+        assert(bptRemove(tree, k) == (exist[k] >= 0));
+    }
+    assert(tree->root == NULL && tree->nodeNum == 0);
+    printf("%d 次随机操作与有序数组的结果一致，树结构合法\n", ops);
+
+    /* 批量构建：各种规模与填充率下结构合法，之后仍可正常插入与删除 */
+    for (int k = 0; k < range; k++) {
+        keys[k] = 3 * k;
+    }
+    double fills[] = {0.5, 0.7, 1.0};
+    for (int n = 0; n <= range; n = n < 100 ? n + 1 : n * 3) {
+        for (int f = 0; f < 3; f++) {
+            bptBulkLoad(tree, keys, NULL, n, fills[f]);
+            assert(bptValidate(tree) && tree->size == n);
+            int val;
+            for (int k = 0; k < n; k += 7) {
+                assert(bptSearch(tree, 3 * k, &val) && val == k && !bptSearch(tree, 3 * k + 1, NULL));
+            }
+            bptInsert(tree, 1, -1);
+            bptRemove(tree, 0);
+            assert(bptValidate(tree));
+        }
+    }
+    printf("批量构建的树结构合法\n");
+    delBPlusTree(tree);
+    free(exist);
+    free(keys);
+    free(vals);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_KEYS;
+    int *keys = malloc(sizeof(int) * n), *probes = malloc(sizeof(int) * n);
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(randU32(&x) >> 1);
+    }
+    // 查询序列：一半命中，一半随机
+    for (int i = 0; i < n; i++) {
+        probes[i] = i % 2 == 0 ? keys[randU32(&x) % n] : (int)(randU32(&x) >> 1);
+    }
+    int *rangeOut = malloc(sizeof(int) * BENCH_RANGE_LEN);
+    // 每次范围查询覆盖约 BENCH_RANGE_LEN 个键
+    int rangeWidth = (int)((double)INT_MAX / n * BENCH_RANGE_LEN);
+    printf("\n%d 个随机键，节点 %d 字节\n", n, BPT_NODE_BYTES);
+    printf("%-12s %10s %10s %12s %10s\n", "", "插入 (s)", "查询 (s)", "范围查询 (s)", "内存 (MB)");
+
+    /* B+ 树 */
+    BPlusTree *bpt = newBPlusTree();
+    double start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        bptInsert(bpt, keys[i], i);
+    }
+    double tInsert = wallSeconds() - start;
+    long long hit = 0;
+    start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        hit += bptSearch(bpt, probes[i], NULL);
+    }
+    double tSearch = wallSeconds() - start;
+    long long ranged = 0;
+    start = wallSeconds();
+    for (int i = 0; i < BENCH_RANGES; i++) {
+        int lo = probes[i] & 0x3FFFFFFF;
+        ranged += bptRange(bpt, lo, lo + rangeWidth, rangeOut, NULL, BENCH_RANGE_LEN);
+    }
+    double tRange = wallSeconds() - start;
+    printf("%-12s %10.3f %10.3f %12.3f %10.1f （树高 %d）\n", "B+ 树", tInsert, tSearch, tRange,
+           bpt->nodeNum * BPT_NODE_BYTES / 1e6, bpt->height);
+    assert(bptValidate(bpt));
+
+    /* 批量构建：由排序去重后的键直接构建 */
+    int *sorted = malloc(sizeof(int) * n);
+    memcpy(sorted, keys, sizeof(int) * n);
+    qsort(sorted, n, sizeof(int), cmpInt);
+    int unique = 0;
+    for (int i = 0; i < n; i++) {
+        if (unique == 0 || sorted[unique - 1] != sorted[i]) {
+            sorted[unique++] = sorted[i];
+        }
+    }
+    BPlusTree *bulk = newBPlusTree();
+    start = wallSeconds();
+    bptBulkLoad(bulk, sorted, NULL, unique, 1.0);
+    printf("%-12s %10.3f %10s %12s %10.1f （树高 %d ，不含排序）\n", "B+ 树批量", wallSeconds() - start, "-", "-",
+           bulk->nodeNum * BPT_NODE_BYTES / 1e6, bulk->height);
+    assert(bptValidate(bulk) && bulk->size == bpt->size);
+    delBPlusTree(bulk);
+    free(sorted);
+
+    /* 节点内查找的各实现 */
+    NodeRankKernel kernels[4];
+    int kernelNum = nodeRankKernels(kernels);
+    printf("B+ 树点查询（节点内查找实现）：");
+    for (int k = 0; k < kernelNum; k++) {
+        nodeRank = kernels[k].func;
+        long long kernelHit = 0;
+        start = wallSeconds();
+        for (int i = 0; i < n; i++) {
+            kernelHit += bptSearch(bpt, probes[i], NULL);
+        }
+        printf(" %s %.3f s", kernels[k].name, wallSeconds() - start);
+        assert(kernelHit == hit);
+    }
+    printf("\n");
+    nodeRank = nodeRankSelect();
+
+    /* AVL 树 */
+    AVLTree *avl = newAVLTree();
+    start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        insert(avl, keys[i]);
+    }
+    tInsert = wallSeconds() - start;
+    long long avlHit = 0;
+    start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        avlHit += search(avl, probes[i]) != NULL;
+    }
+    tSearch = wallSeconds() - start;
+    long long avlRanged = 0;
+    start = wallSeconds();
+    for (int i = 0; i < BENCH_RANGES; i++) {
+        int lo = probes[i] & 0x3FFFFFFF, cnt = treeRangeCount(avl->root, lo, lo + rangeWidth);
+        avlRanged += cnt < BENCH_RANGE_LEN ? cnt : BENCH_RANGE_LEN;
+    }
+    tRange = wallSeconds() - start;
+    printf("%-12s %10.3f %10.3f %12.3f %10.1f （树高 %d）\n", "AVL 树", tInsert, tSearch, tRange,
+           bpt->size * sizeof(TreeNode) / 1e6, height(avl->root) + 1);
+    assert(avlHit == hit && avlRanged == ranged);
+    delAVLTree(avl);
+
+    /* 二叉搜索树 */
+    BinarySearchTree *bst = newBinarySearchTree();
+    start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        bstInsert(bst, keys[i]);
+    }
+    tInsert = wallSeconds() - start;
+    long long bstHit = 0;
+    start = wallSeconds();
+    for (int i = 0; i < n; i++) {
+        bstHit += bstSearch(bst, probes[i]) != NULL;
+    }
+    tSearch = wallSeconds() - start;
+    long long bstRanged = 0;
+    start = wallSeconds();
+    for (int i = 0; i < BENCH_RANGES; i++) {
+        int lo = probes[i] & 0x3FFFFFFF, cnt = treeRangeCount(bst->root, lo, lo + rangeWidth);
+        bstRanged += cnt < BENCH_RANGE_LEN ? cnt : BENCH_RANGE_LEN;
+    }
+    tRange = wallSeconds() - start;
+    printf("%-12s %10.3f %10.3f %12.3f %10.1f\n", "二叉搜索树", tInsert, tSearch, tRange,
+           bpt->size * sizeof(TreeNode) / 1e6);
+    assert(bstHit == hit && bstRanged == ranged);
+    delBinarySearchTree(bst);
+
+    delBPlusTree(bpt);
+    free(keys);
+    free(probes);
+    free(rangeOut);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
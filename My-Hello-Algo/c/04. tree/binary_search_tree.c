@@ -16,6 +16,7 @@
 typedef struct
 {
     TreeNode *root;
+    TreeNodePool *pool; // 节点内存池，为 NULL 时逐个 malloc / free 节点
 } BinarySearchTree;
 
 /* 构造函数 */
@@ -23,12 +24,25 @@ BinarySearchTree *newBinarySearchTree() {
     // 初始化空树
     BinarySearchTree *bst = malloc(sizeof(BinarySearchTree));
     bst->root = NULL;
+    bst->pool = NULL;
+    return bst;
+}
+
+/* 构造函数：节点从树独占的内存池分配 */
+BinarySearchTree *newBinarySearchTreePooled() {
+    BinarySearchTree *bst = newBinarySearchTree();
+    bst->pool = newTreeNodePool();
     return bst;
 }
 
 /* 析构函数 */
 void delBinarySearchTree(BinarySearchTree *bst) {
-    free(bst->root);
+    if (bst->pool != NULL) {
+        // 整块释放，无需遍历树
+        delTreeNodePool(bst->pool);
+    } else {
+        freeMemoryTree(bst->root);
+    }
     free(bst);
 }
 
@@ -61,7 +75,7 @@ TreeNode *search(BinarySearchTree *bst, int num) {
 void insert(BinarySearchTree *bst, int num) {
     // 若树为空，则初始化二叉搜索树根节点
     if (bst->root == NULL) {
-        bst->root = newTreeNode(num);
+        bst->root = treeNodeAlloc(bst->pool, num);
         return;
     }
 
@@ -84,7 +98,7 @@ void insert(BinarySearchTree *bst, int num) {
     }
 
     // 找到相应的叶子节点后，插入节点为叶子节点的子节点
-    TreeNode *node = newTreeNode(num);
+    TreeNode *node = treeNodeAlloc(bst->pool, num);
     if (pre->val < num) {
         pre->right = node;
     } else {
@@ -126,7 +140,10 @@ void removeItem(BinarySearchTree *bst, int num) {
         // 当子节点数量 = 0 或 1 时， child = nullptr 或 该非空子节点
         TreeNode *child = cur->left == NULL ? cur->right : cur->left;
         // 删除节点 cur
-        if (pre->left == cur) {
+        if (pre == NULL) {
+            // 要删除的节点为根节点时，child 成为新的根节点
+            bst->root = child;
+        } else if (pre->left == cur) {
             // 当要删除的节点时左节点时，更新父节点的左节点为child
             pre->left = child;
         } else {
@@ -134,7 +151,7 @@ void removeItem(BinarySearchTree *bst, int num) {
             pre->right = child;
         }
         // 释放要删除节点内存
-        free(cur);
+        treeNodeFree(bst->pool, cur);
     } else {
         // 当要删除节点的度为2时，子节点数量等于 2。我们无法直接删除它，而需要使用一个节点替换该节点。
         // 由于要保持二叉搜索树“左子树 < 根节点 < 右子树”的性质，因此这个节点可以是右子树的最小节点或左子树的最大节点。
@@ -151,39 +168,3 @@ void removeItem(BinarySearchTree *bst, int num) {
         cur->val = nextVal;
     }
 }
-
-/* Driver Code */
-int main() {
-    /* 初始化二叉搜索树 */
-    int nums[] = {8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15};
-    BinarySearchTree *bst = newBinarySearchTree();
-    for (int i = 0; i < sizeof(nums) / sizeof(int); i++) {
-        insert(bst, nums[i]);
-    }
-    printf("初始化的二叉树为\n");
-    printTree(getRoot(bst));
-
-    /* 查找节点 */
-    TreeNode *node = search(bst, 7);
-    printf("查找到的节点对象的节点值 = %d\n", node->val);
-
-    /* 插入节点 */
-    insert(bst, 16);
-    printf("插入节点 16 后，二叉树为\n");
-    printTree(getRoot(bst));
-
-    /* 删除节点 */
-    removeItem(bst, 1);
-    printf("删除节点 1 后，二叉树为\n");
-    printTree(getRoot(bst));
-    removeItem(bst, 2);
-    printf("删除节点 2 后，二叉树为\n");
-    printTree(getRoot(bst));
-    removeItem(bst, 4);
-    printf("删除节点 4 后，二叉树为\n");
-    printTree(getRoot(bst));
-
-    // 释放内存
-    delBinarySearchTree(bst);
-    return 0;
-}
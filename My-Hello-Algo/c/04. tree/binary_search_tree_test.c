@@ -0,0 +1,49 @@
+/**
+ * @FileName    :binary_search_tree_test.c
+ * @Date        :2026-10-20 02:05:18
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :二叉搜索树测试程序
+ * @Description :1. 由 15 个节点初始化一棵完美平衡的二叉搜索树并打印
+ *               2. 查找：查找节点 7 并打印节点值
+ *               3. 插入：插入节点 16 后打印二叉树
+ *               4. 删除：分别删除度为 0 、1 、2 的节点（1 、2 、4），删除后打印二叉树
+ */
+
+#include "binary_search_tree.c"
+
+/* Driver Code */
+int main() {
+    /* 初始化二叉搜索树 */
+    int nums[] = {8, 4, 12, 2, 6, 10, 14, 1, 3, 5, 7, 9, 11, 13, 15};
+    BinarySearchTree *bst = newBinarySearchTree();
+    for (int i = 0; i < sizeof(nums) / sizeof(int); i++) {
+        insert(bst, nums[i]);
+    }
+    printf("初始化的二叉树为\n");
+    printTree(getRoot(bst));
+
+    /* 查找节点 */
+    TreeNode *node = search(bst, 7);
+    printf("查找到的节点对象的节点值 = %d\n", node->val);
+
+    /* 插入节点 */
+    insert(bst, 16);
+    printf("插入节点 16 后，二叉树为\n");
+    printTree(getRoot(bst));
+
+    /* 删除节点 */
+    removeItem(bst, 1);
+    printf("删除节点 1 后，二叉树为\n");
+    printTree(getRoot(bst));
+    removeItem(bst, 2);
+    printf("删除节点 2 后，二叉树为\n");
+    printTree(getRoot(bst));
+    removeItem(bst, 4);
+    printf("删除节点 4 后，二叉树为\n");
+    printTree(getRoot(bst));
+
+    // 释放内存
+    delBinarySearchTree(bst);
+    return 0;
+}
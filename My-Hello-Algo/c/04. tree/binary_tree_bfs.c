@@ -10,29 +10,39 @@
 
 #include "../utils/common.h"
 
-#define MAX_SIZE 100
+// 辅助队列与结果数组的初始容量，不足时翻倍
+#define INIT_CAPACITY 100
 
 /* 层序遍历 */
 int *levelOrder(TreeNode *root, int *size) {
     /* 辅助队列 */
-    int front, rear;
+    int front, rear, capacity;
     TreeNode **queue;
     /* 辅助数组 */
     int index, *arr;
     TreeNode *node;
 
     /* 初始化辅助队列 */
-    queue = malloc(sizeof(TreeNode) * MAX_SIZE);
+    capacity = INIT_CAPACITY;
+    queue = malloc(sizeof(TreeNode *) * capacity);
     front = 0, rear = 0;
     // 加入根节点
-    queue[rear++] = root;
+    if (root != NULL) {
+        queue[rear++] = root;
+    }
 
     // 初始化一个列表，用于保存遍历序列
     /* 初始化辅助数组 */
-    arr = malloc(sizeof(int) * MAX_SIZE);
+    arr = malloc(sizeof(int) * capacity);
     index = 0;
 
     while (front < rear) {
+        // 队列（已入队的节点总数）将满时扩容，结果数组与之同步扩容
+        if (rear + 2 > capacity) {
+            capacity *= 2;
+            queue = realloc(queue, sizeof(TreeNode *) * capacity);
+            arr = realloc(arr, sizeof(int) * capacity);
+        }
         // 队列出队
         node = queue[front++];
         // 保存节点值
@@ -49,7 +59,7 @@ int *levelOrder(TreeNode *root, int *size) {
 
     // 更新数组长度的值，刨除初始化时的空值
     *size = index;
-    arr = realloc(arr, sizeof(int) * index);
+    arr = realloc(arr, sizeof(int) * (index > 0 ? index : 1));
 
     // 释放辅助队列数组空间
     free(queue);
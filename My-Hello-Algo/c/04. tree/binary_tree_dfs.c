@@ -5,63 +5,87 @@
  * @Version     :V1.0.0
  * @Brief       :二叉树遍历-前序、中序、后序遍历（深度优先搜索DFS）
  * @Description :基于递归实现深度优先搜索和基于迭代实现深度优先搜索（借助栈）
+ *               遍历结果写入调用者持有的 ValBuffer ，容量不足时翻倍；迭代实现的辅助栈同样按需扩容
  */
 
 #include "../utils/common.h"
 
-#define MAX_SIZE 100
+// 结果序列与辅助栈的初始容量，不足时翻倍
+#define INIT_CAPACITY 16
+
+/* 遍历结果序列：由调用者持有，初始化为 {NULL, 0, 0} ，使用后 free(vals) */
+typedef struct {
+    int *vals;    // 节点值
+    int size;     // 元素数量
+    int capacity; // 容量
+} ValBuffer;
+
+/* 向结果序列末尾添加元素，容量不足时翻倍 */
+void bufferPush(ValBuffer *buf, int val) {
+    if (buf->size == buf->capacity) {
+        buf->capacity = buf->capacity > 0 ? buf->capacity * 2 : INIT_CAPACITY;
+        buf->vals = realloc(buf->vals, sizeof(int) * buf->capacity);
+    }
+    buf->vals[buf->size++] = val;
+}
 
-// 辅助数组，用于存储遍历结果序列
-int result[MAX_SIZE];
+/* 节点入栈，容量不足时翻倍（栈扩容时地址可能改变，因此传入指针的地址） */
+void stackPush(TreeNode ***stack, int *top, int *capacity, TreeNode *node) {
+    if (*top + 1 == *capacity) {
+        *capacity *= 2;
+        *stack = realloc(*stack, sizeof(TreeNode *) * *capacity);
+    }
+    (*stack)[++*top] = node;
+}
 
 /* 递归实现：代码实现较为简单，效率较低 */
 /* 前序遍历 */
-void preOrder(TreeNode *root, int *size) {
+void preOrder(TreeNode *root, ValBuffer *buf) {
     if (root == NULL) {
         return;
     }
     // 访问优先级：根节点 -> 左子树 -> 右子树
-    result[(*size)++] = root->val;
-    preOrder(root->left, size);
-    preOrder(root->right, size);
+    bufferPush(buf, root->val);
+    preOrder(root->left, buf);
+    preOrder(root->right, buf);
 }
 
 /* 中序遍历 */
-void inOrder(TreeNode *root, int *size) {
+void inOrder(TreeNode *root, ValBuffer *buf) {
     if (root == NULL) {
         return;
     }
     // 访问优先级：左子树 -> 根节点 -> 右子树
-    inOrder(root->left, size);
-    result[(*size)++] = root->val;
-    inOrder(root->right, size);
+    inOrder(root->left, buf);
+    bufferPush(buf, root->val);
+    inOrder(root->right, buf);
 }
 
 /* 后序遍历 */
-void postOrder(TreeNode *root, int *size) {
+void postOrder(TreeNode *root, ValBuffer *buf) {
     if (root == NULL) {
         return;
     }
     // 访问优先级：左子树 -> 右子树 -> 根节点
-    postOrder(root->left, size);
-    postOrder(root->right, size);
-    result[(*size)++] = root->val;
+    postOrder(root->left, buf);
+    postOrder(root->right, buf);
+    bufferPush(buf, root->val);
 }
 
 /* 迭代实现：借助栈数据结构实现，代码较为复杂 */
 /* 前序遍历 */
-void preOrderStack(TreeNode *root, int size) {
+void preOrderStack(TreeNode *root, ValBuffer *buf) {
     if (root == NULL) {
         return;
     }
-    TreeNode **stack = malloc(sizeof(TreeNode *) * size);
+    int capacity = INIT_CAPACITY;
+    TreeNode **stack = malloc(sizeof(TreeNode *) * capacity);
     TreeNode *node = root;
     int top = -1;
-    int index = 0;
     while (top >= 0 || node != NULL) {
         if (node != NULL) {
-            result[index++] = node->val;
-            stack[++top] = node;
+            bufferPush(buf, node->val);
+            stackPush(&stack, &top, &capacity, node);
             node = node->left;
         } else {
             node = stack[top--];
@@ -69,39 +93,40 @@ void preOrderStack(TreeNode *root, int size) {
         }
     }
     /* 方法2 */
-    // stack[++top] = node;
+    // stackPush(&stack, &top, &capacity, node);
     // while (top >= 0)
     // {
     //     node = stack[top--];
-    //     result[index++] = node->val;
+    //     bufferPush(buf, node->val);
     //     if (node->right != NULL)
     //     {
-    //         stack[++top] = node->right;
+    //         stackPush(&stack, &top, &capacity, node->right);
     //     }
     //     if (node->left != NULL)
     //     {
-    //         stack[++top] = node->left;
+    //         stackPush(&stack, &top, &capacity, node->left);
     //     }
     // }
+    free(stack);
 }
 
 /* 中序遍历 */
-void inOrderStack(TreeNode *root, int size) {
+void inOrderStack(TreeNode *root, ValBuffer *buf) {
     if (root == NULL) {
         return;
     }
-    TreeNode **stack = malloc(sizeof(TreeNode *) * size);
+    int capacity = INIT_CAPACITY;
+    TreeNode **stack = malloc(sizeof(TreeNode *) * capacity);
     TreeNode *node = root;
     int top = -1;
-    int index = 0;
     /* 方法1 */
     while (top >= 0 || node != NULL) {
         if (node != NULL) {
-            stack[++top] = node;
+            stackPush(&stack, &top, &capacity, node);
             node = node->left;
         } else {
             node = stack[top--];
-            result[index++] = node->val;
+            bufferPush(buf, node->val);
             node = node->right;
         }
     }
@@ -116,42 +141,45 @@ void inOrderStack(TreeNode *root, int size) {
     // {
     //     while (node != NULL)
     //     {
-    //         stack[++top] = node;
+    //         stackPush(&stack, &top, &capacity, node);
     //         node = node->left;
     //     }
     //     node = stack[top--];
-    //     result[index++] = node->val;
+    //     bufferPush(buf, node->val);
     //     node = node->right;
     // }
+    free(stack);
 }
 
 /* 后序遍历:使用双栈 */
 // 栈1用于存储节点，栈2用于存储栈1出栈的节点。栈1出栈的顺序是根右左，栈2出栈的顺序是左右根。
-void postOrderStack(TreeNode *root, int size) {
+void postOrderStack(TreeNode *root, ValBuffer *buf) {
     if (root == NULL) {
         return;
     }
-    TreeNode **stack1 = malloc(sizeof(TreeNode *) * size);
-    TreeNode **stack2 = malloc(sizeof(TreeNode *) * size);
+    int capacity1 = INIT_CAPACITY, capacity2 = INIT_CAPACITY;
+    TreeNode **stack1 = malloc(sizeof(TreeNode *) * capacity1);
+    TreeNode **stack2 = malloc(sizeof(TreeNode *) * capacity2);
     TreeNode *node = root;
     int top1 = -1, top2 = -1;
-    int index = 0;
-    stack1[++top1] = node;
+    stackPush(&stack1, &top1, &capacity1, node);
     // 遍历栈1，将节点出栈，存入栈2， 入栈左右子节点。
     while (top1 >= 0) {
         node = stack1[top1--];
-        stack2[++top2] = node;
+        stackPush(&stack2, &top2, &capacity2, node);
         if (node->left != NULL) {
-            stack1[++top1] = node->left;
+            stackPush(&stack1, &top1, &capacity1, node->left);
         }
         if (node->right != NULL) {
-            stack1[++top1] = node->right;
+            stackPush(&stack1, &top1, &capacity1, node->right);
         }
     }
     // 遍历栈2，将节点出栈，存入结果数组。
     while (top2 >= 0) {
-        result[index++] = stack2[top2--]->val;
+        bufferPush(buf, stack2[top2--]->val);
     }
+    free(stack1);
+    free(stack2);
 }
 
 /* Driver Code */
@@ -164,40 +192,45 @@ int main() {
     printf("初始化二叉树\n");
     printTree(root);
 
+    // 结果序列，每次遍历前清空
+    ValBuffer buf = {NULL, 0, 0};
+
     /* 前序遍历 */
-    // 初始化辅助数组
-    size = 0;
-    preOrder(root, &size);
+    preOrder(root, &buf);
     printf("前序遍历的节点打印序列 = ");
-    printArray(result, size);
+    printArray(buf.vals, buf.size);
 
     /* 中序遍历 */
-    size = 0;
-    inOrder(root, &size);
+    buf.size = 0;
+    inOrder(root, &buf);
     printf("中序遍历的节点打印序列 = ");
-    printArray(result, size);
+    printArray(buf.vals, buf.size);
 
     /* 后序遍历 */
-    size = 0;
-    postOrder(root, &size);
+    buf.size = 0;
+    postOrder(root, &buf);
     printf("后序遍历的节点打印序列 = ");
-    printArray(result, size);
+    printArray(buf.vals, buf.size);
 
     /* 前序遍历 */
-    preOrderStack(root, size);
+    buf.size = 0;
+    preOrderStack(root, &buf);
     printf("迭代前序遍历的节点打印序列 = ");
-    printArray(result, size);
+    printArray(buf.vals, buf.size);
 
     /* 中序遍历 */
-    inOrderStack(root, size);
+    buf.size = 0;
+    inOrderStack(root, &buf);
     printf("迭代中序遍历的节点打印序列 = ");
-    printArray(result, size);
+    printArray(buf.vals, buf.size);
 
     /* 后序遍历 */
-    postOrderStack(root, size);
+    buf.size = 0;
+    postOrderStack(root, &buf);
     printf("迭代后序遍历的节点打印序列 = ");
-    printArray(result, size);
+    printArray(buf.vals, buf.size);
 
+    free(buf.vals);
     freeMemoryTree(root);
     return 0;
 }
@@ -0,0 +1,185 @@
+/**
+ * @FileName    :binary_tree_iter.c
+ * @Date        :2026-10-20 10:31:05
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :二叉树迭代器-前序、中序、后序、层序遍历与 Morris 中序遍历
+ * @Description :binary_tree_dfs.c 与 binary_tree_bfs.c 将整个遍历结果写入数组，需要 O(n) 额外空间；递归实现在很深的树上还会栈溢出。
+ *               迭代器按需逐个返回节点（treeIterInit 初始化，treeIterNext 返回下一个节点，遍历结束时返回 NULL ），
+ *               不需要保存整个遍历序列，可以对任意大的树做流式处理，也可以中途停止。
+ *               1. 前序、中序、后序遍历使用可增长的栈（容量不足时翻倍），空间为 O(树高) 。
+ *                  后序遍历只用一个栈：记录上一个访问的节点，栈顶节点的右子树已访问完毕时才访问栈顶节点。
+ *               2. 层序遍历使用可增长的循环队列，空间为 O(最宽一层的节点数量) 。
+ *               3. Morris 中序遍历：将左子树最右节点的右指针临时指向当前节点（线索），沿线索返回，不需要栈，O(1) 空间。
+ *                  遍历期间会修改树（遍历结束后恢复原状），因此遍历期间不能有其他线程读取这棵树；
+ *                  中途停止时须调用 treeIterFree ，它会走完剩余的遍历以删除所有线索。
+ */
+
+#include "../utils/common.h"
+
+// 栈与队列的初始容量
+#define TREE_ITER_INIT_CAPACITY 64
+
+/* 遍历顺序 */
+typedef enum {
+    TREE_PRE_ORDER,
+    TREE_IN_ORDER,
+    TREE_POST_ORDER,
+    TREE_LEVEL_ORDER,
+    TREE_MORRIS_IN_ORDER
+} TreeIterOrder;
+
+/* 二叉树迭代器 */
+typedef struct {
+    TreeIterOrder order;
+    TreeNode *node;     // 中序、后序、Morris ：下一个要下降的节点
+    TreeNode *last;     // 后序：上一个访问的节点
+    TreeNode **buf;     // 栈或循环队列
+    long long front;    // 队首下标（层序）
+    long long size;     // 栈或队列中的节点数量
+    long long capacity; // buf 的容量
+} TreeIter;
+
+/* 初始化迭代器 */
+void treeIterInit(TreeIter *it, TreeNode *root, TreeIterOrder order) {
+    it->order = order;
+    it->node = root;
+    it->last = NULL;
+    it->front = 0;
+    it->size = 0;
+    it->capacity = order == TREE_MORRIS_IN_ORDER ? 0 : TREE_ITER_INIT_CAPACITY;
+    it->buf = it->capacity > 0 ? malloc(sizeof(TreeNode *) * it->capacity) : NULL;
+    if ((order == TREE_PRE_ORDER || order == TREE_LEVEL_ORDER) && root != NULL) {
+        it->buf[it->size++] = root;
+        it->node = NULL;
+    }
+}
+
+/* 扩容：容量翻倍，循环队列按出队顺序重新排列 */
+void treeIterGrow(TreeIter *it) {
+    TreeNode **buf = malloc(sizeof(TreeNode *) * it->capacity * 2);
+    for (long long i = 0; i < it->size; i++) {
+        buf[i] = it->buf[(it->front + i) % it->capacity];
+    }
+    free(it->buf);
+    it->buf = buf;
+    it->front = 0;
+    it->capacity *= 2;
+}
+
+/* 入栈 */
+void treeIterPush(TreeIter *it, TreeNode *node) {
+    if (it->size == it->capacity) {
+        treeIterGrow(it);
+    }
+    it->buf[it->size++] = node;
+}
+
+/* 入队 */
+void treeIterEnqueue(TreeIter *it, TreeNode *node) {
+    if (it->size == it->capacity) {
+        treeIterGrow(it);
+    }
+    it->buf[(it->front + it->size++) % it->capacity] = node;
+}
+
+/* 返回下一个节点，遍历结束时返回 NULL */
+TreeNode *treeIterNext(TreeIter *it) {
+    TreeNode *node;
+    switch (it->order) {
+    case TREE_PRE_ORDER:
+        // 访问优先级：根节点 -> 左子树 -> 右子树，右子节点先入栈
+        if (it->size == 0) {
+            return NULL;
+        }
+        node = it->buf[--it->size];
+        if (node->right != NULL) {
+            treeIterPush(it, node->right);
+        }
+        if (node->left != NULL) {
+            treeIterPush(it, node->left);
+        }
+        return node;
+    case TREE_IN_ORDER:
+        // 沿左链入栈，出栈后转向右子树
+        while (it->node != NULL) {
+            treeIterPush(it, it->node);
+            it->node = it->node->left;
+        }
+        if (it->size == 0) {
+            return NULL;
+        }
+        node = it->buf[--it->size];
+        it->node = node->right;
+        return node;
+    case TREE_POST_ORDER:
+        for (;;) {
+            while (it->node != NULL) {
+                treeIterPush(it, it->node);
+                it->node = it->node->left;
+            }
+            if (it->size == 0) {
+                return NULL;
+            }
+            node = it->buf[it->size - 1];
+            if (node->right != NULL && node->right != it->last) {
+                // 右子树尚未访问
+                it->node = node->right;
+                continue;
+            }
+            it->size--;
+            it->last = node;
+            return node;
+        }
+    case TREE_LEVEL_ORDER:
+        if (it->size == 0) {
+            return NULL;
+        }
+        node = it->buf[it->front];
+        it->front = (it->front + 1) % it->capacity;
+        it->size--;
+        if (node->left != NULL) {
+            treeIterEnqueue(it, node->left);
+        }
+        if (node->right != NULL) {
+            treeIterEnqueue(it, node->right);
+        }
+        return node;
+    case TREE_MORRIS_IN_ORDER:
+        while (it->node != NULL) {
+            TreeNode *cur = it->node;
+            if (cur->left == NULL) {
+                it->node = cur->right;
+                return cur;
+            }
+            // 找到左子树的最右节点（当前节点的中序前驱）
+            TreeNode *pred = cur->left;
+            while (pred->right != NULL && pred->right != cur) {
+                pred = pred->right;
+            }
+            if (pred->right == NULL) {
+                // 第一次到达：建立线索，下降到左子树
+                pred->right = cur;
+                it->node = cur->left;
+            } else {
+                // 沿线索返回：左子树已访问完毕，删除线索
+                pred->right = NULL;
+                it->node = cur->right;
+                return cur;
+            }
+        }
+        return NULL;
+    }
+    return NULL;
+}
+
+/* 释放迭代器；Morris 遍历中途停止时先走完剩余的遍历，恢复树的原状 */
+void treeIterFree(TreeIter *it) {
+    if (it->order == TREE_MORRIS_IN_ORDER) {
+        while (treeIterNext(it) != NULL) {
+        }
+    }
+    free(it->buf);
+    it->buf = NULL;
+    it->size = 0;
+}
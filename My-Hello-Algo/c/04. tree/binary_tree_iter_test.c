@@ -0,0 +1,263 @@
+/**
+ * @FileName    :binary_tree_iter_test.c
+ * @Date        :2026-10-20 11:02:44
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :二叉树迭代器测试程序
+ * @Description :1. 基本测试：打印示例二叉树的五种遍历序列
+ *               2. 正确性：空树、单节点、左 / 右链、之字形链、完全二叉树与随机二叉搜索树上，迭代器的遍历序列与递归实现一致；
+ *                  Morris 遍历完整结束或中途停止（treeIterFree）后，所有节点的左右指针与遍历前相同。
+ *               3. 性能：BENCH_NODES 个节点（默认 10^7）的完全二叉树上，递归遍历写入数组与各迭代器逐个处理节点的耗时，
+ *                  以及迭代器占用的额外空间；同样节点数量的左链（树高为 BENCH_NODES ，递归实现会栈溢出）上各迭代器的耗时。
+ */
+
+#include "../utils/bench_util.h"
+#include "binary_tree_iter.c"
+
+#ifndef BENCH_NODES
+#define BENCH_NODES 10000000
+#endif
+
+/* 递归前序 / 中序 / 后序遍历，将节点写入 res ，返回写入的数量 */
+int dfsRecur(TreeNode *node, TreeIterOrder order, TreeNode **res, int size) {
+    if (node == NULL) {
+        return size;
+    }
+    if (order == TREE_PRE_ORDER) {
+        res[size++] = node;
+    }
+    size = dfsRecur(node->left, order, res, size);
+    if (order == TREE_IN_ORDER || order == TREE_MORRIS_IN_ORDER) {
+        res[size++] = node;
+    }
+    size = dfsRecur(node->right, order, res, size);
+    if (order == TREE_POST_ORDER) {
+        res[size++] = node;
+    }
+    return size;
+}
+
+/* 参照实现：按 order 将节点写入 res ，返回节点数量（层序使用数组模拟队列） */
+int traverseRef(TreeNode *root, TreeIterOrder order, TreeNode **res) {
+    if (order != TREE_LEVEL_ORDER) {
+        return dfsRecur(root, order, res, 0);
+    }
+    int front = 0, rear = 0;
+    if (root != NULL) {
+        res[rear++] = root;
+    }
+    while (front < rear) {
+        TreeNode *node = res[front++];
+        if (node->left != NULL) {
+            res[rear++] = node->left;
+        }
+        if (node->right != NULL) {
+            res[rear++] = node->right;
+        }
+    }
+    return rear;
+}
+
+/* 递归中序遍历，将节点值写入 res ，返回写入的数量 */
+long long inOrderRecur(TreeNode *node, int *res, long long size) {
+    if (node == NULL) {
+        return size;
+    }
+    size = inOrderRecur(node->left, res, size);
+    res[size++] = node->val;
+    return inOrderRecur(node->right, res, size);
+}
+
+/* 向二叉搜索树插入节点（迭代） */
+TreeNode *bstInsertIter(TreeNode *root, int val) {
+    TreeNode *node = newTreeNode(val);
+    if (root == NULL) {
+        return node;
+    }
+    TreeNode *cur = root;
+    for (;;) {
+        TreeNode **next = val < cur->val ? &cur->left : &cur->right;
+        if (*next == NULL) {
+            *next = node;
+            return root;
+        }
+        cur = *next;
+    }
+}
+
+/* 生成各种形状的测试树：0 左链，1 右链，2 之字形链，3 完全二叉树，4 随机二叉搜索树 */
+TreeNode *makeTree(int shape, int n, unsigned long long *x) {
+    TreeNode *root = NULL;
+    if (shape <= 2) {
+        for (int i = n - 1; i >= 0; i--) {
+            TreeNode *node = newTreeNode(i);
+            bool left = shape == 0 || (shape == 2 && i % 2 == 0);
+            if (left) {
+                node->left = root;
+            } else {
+                node->right = root;
+            }
+            root = node;
+        }
+    } else if (shape == 3) {
+        int *arr = malloc(sizeof(int) * (n > 0 ? n : 1));
+        for (int i = 0; i < n; i++) {
+            arr[i] = i;
+        }
+        root = arrayToTree(arr, n);
+        free(arr);
+    } else {
+        for (int i = 0; i < n; i++) {
+            root = bstInsertIter(root, (int)(randU32(x) % (4 * n)));
+        }
+    }
+    return root;
+}
+
+/* 基本测试 */
+void testBasic() {
+    int nums[] = {1, 2, 3, 4, INT_MAX, 6, 7, 8, 9, INT_MAX, INT_MAX, 12, INT_MAX, INT_MAX, 15};
+    TreeNode *root = arrayToTree(nums, sizeof(nums) / sizeof(int));
+    printf("初始化二叉树\n");
+    printTree(root);
+    const char *names[] = {"前序遍历", "中序遍历", "后序遍历", "层序遍历", "Morris 中序遍历"};
+    for (int order = TREE_PRE_ORDER; order <= TREE_MORRIS_IN_ORDER; order++) {
+        int res[16], size = 0;
+        TreeIter it;
+        treeIterInit(&it, root, order);
+        for (TreeNode *node = treeIterNext(&it); node != NULL; node = treeIterNext(&it)) {
+            res[size++] = node->val;
+        }
+        treeIterFree(&it);
+        printf("%s的节点序列 = ", names[order]);
+        printArray(res, size);
+    }
+    freeMemoryTree(root);
+}
+
+/* 正确性 */
+void testValidate() {
+    int sizes[] = {0, 1, 2, 3, 10, 100, 1000, 5000};
+    unsigned long long x = 2026;
+    int cases = 0;
+    TreeNode **expect = malloc(sizeof(TreeNode *) * 5000), **got = malloc(sizeof(TreeNode *) * 5000);
+    TreeNode **lefts = malloc(sizeof(TreeNode *) * 5000), **rights = malloc(sizeof(TreeNode *) * 5000);
+    for (int shape = 0; shape < 5; shape++) {
+        for (int s = 0; s < 8; s++) {
+            TreeNode *root = makeTree(shape, sizes[s], &x);
+            for (int order = TREE_PRE_ORDER; order <= TREE_MORRIS_IN_ORDER; order++) {
+                int n = traverseRef(root, order, expect), size = 0;
+                TreeIter it;
+                treeIterInit(&it, root, order);
+                for (TreeNode *node = treeIterNext(&it); node != NULL; node = treeIterNext(&it)) {
+                    assert(size < n);
+                    got[size++] = node;
+                }
+                assert(treeIterNext(&it) == NULL);
+                treeIterFree(&it);
+                assert(size == n && memcmp(got, expect, sizeof(TreeNode *) * n) == 0);
+                cases++;
+            }
+
+            /* Morris 遍历中途停止后树恢复原状 */
+            int n = traverseRef(root, TREE_PRE_ORDER, expect);
+            for (int i = 0; i < n; i++) {
+                lefts[i] = expect[i]->left;
+                rights[i] = expect[i]->right;
+            }
+            int stops[] = {0, 1, n / 3, n / 2, n - 1};
+            for (int k = 0; k < 5; k++) {
+                TreeIter it;
+                treeIterInit(&it, root, TREE_MORRIS_IN_ORDER);
+                for (int i = 0; i < stops[k]; i++) {
+                    treeIterNext(&it);
+                }
+                treeIterFree(&it);
+                for (int i = 0; i < n; i++) {
+                    assert(expect[i]->left == lefts[i] && expect[i]->right == rights[i]);
+                }
+            }
+            freeMemoryTree(root);
+        }
+    }
+    printf("%d 组遍历序列与递归实现一致，Morris 遍历结束或中途停止后树的结构不变\n", cases);
+    free(expect);
+    free(got);
+    free(lefts);
+    free(rights);
+}
+
+/* 用迭代器遍历整棵树，返回节点值之和，*peak 为栈或队列的最大容量 */
+long long iterSum(TreeNode *root, TreeIterOrder order, long long *peak) {
+    long long sum = 0;
+    TreeIter it;
+    treeIterInit(&it, root, order);
+    for (TreeNode *node = treeIterNext(&it); node != NULL; node = treeIterNext(&it)) {
+        sum += node->val;
+    }
+    *peak = it.capacity;
+    treeIterFree(&it);
+    return sum;
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_NODES;
+    long long expect = (long long)n * (n - 1) / 2, peak;
+    const char *names[] = {"前序迭代器", "中序迭代器", "后序迭代器", "层序迭代器", "Morris 中序"};
+
+    /* 完全二叉树 */
+    int *arr = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        arr[i] = i;
+    }
+    TreeNodePool *pool = newTreeNodePool();
+    TreeNode *root = arrayToTreePool(pool, arr, n);
+    printf("%d 个节点的完全二叉树\n", n);
+    printf("%-16s %10s %16s\n", "方法", "耗时 (s)", "额外空间 (字节)");
+    double start = wallSeconds();
+    long long size = inOrderRecur(root, arr, 0);
+    long long sum = 0;
+    for (long long i = 0; i < size; i++) {
+        sum += arr[i];
+    }
+    double t = wallSeconds() - start;
+    assert(size == n && sum == expect);
+    printf("%-16s %10.3f %16lld\n", "递归写入数组", t, (long long)sizeof(int) * n);
+    free(arr);
+    for (int order = TREE_PRE_ORDER; order <= TREE_MORRIS_IN_ORDER; order++) {
+        start = wallSeconds();
+        sum = iterSum(root, order, &peak);
+        t = wallSeconds() - start;
+        assert(sum == expect);
+        printf("%-16s %10.3f %16lld\n", names[order], t, peak * (long long)sizeof(TreeNode *));
+    }
+    delTreeNodePool(pool);
+
+    /* 左链：树高为 n */
+    pool = newTreeNodePool();
+    root = NULL;
+    for (int i = n - 1; i >= 0; i--) {
+        TreeNode *node = treeNodeAlloc(pool, i);
+        node->left = root;
+        root = node;
+    }
+    printf("\n%d 个节点的左链（树高 %d）\n", n, n);
+    printf("%-16s %10s %16s\n", "方法", "耗时 (s)", "额外空间 (字节)");
+    for (int order = TREE_PRE_ORDER; order <= TREE_MORRIS_IN_ORDER; order++) {
+        start = wallSeconds();
+        sum = iterSum(root, order, &peak);
+        t = wallSeconds() - start;
+        assert(sum == expect);
+        printf("%-16s %10.3f %16lld\n", names[order], t, peak * (long long)sizeof(TreeNode *));
+    }
+    delTreeNodePool(pool);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,418 @@
+/**
+ * @FileName    :concurrent_skip_list.c
+ * @Date        :2026-10-20 09:05:12
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :无锁跳表实现的并发有序映射（基于纪元的内存回收）
+ * @Description :一、结构
+ *               跳表的第 0 层是按键升序的链表，第 l 层是第 l - 1 层的子序列（每个节点以 1/2 的概率出现在上一层），
+ *               查找从最高层开始逐层下降，期望 O(log n) 。指针的最低位作为标记位，表示该层的后继指针所属的节点已被删除。
+ *               二、操作（线程 tid 调用，tid 在 [0, maxThreads) 内，每个线程使用自己的 tid）
+ *               1. 查找 find ：逐层找出 key 的前驱与后继，沿途用 CAS 摘除已标记的节点。
+ *               2. 插入 put ：键已存在时用 CAS 更新值；否则先用 CAS 链接第 0 层（线性化点），再逐层向上链接。
+ *               3. 删除 remove ：用 CAS 在值字段上置删除位（线性化点），再自顶向下标记各层的后继指针，最后调用 find 摘除。
+ *                  值与删除位放在同一个 64 位字中，并发的更新与删除只有一个能成功，不会出现更新了已删除节点的值的情况。
+ *               4. 读取 get ：不修改链表，找到第 0 层未标记的节点后读取值字段，wait-free 。
+ *               5. 范围扫描 rangeScan ：沿第 0 层顺序读取，跳过已删除的节点。扫描不是原子快照：
+ *                  扫描期间一直存在且未修改的键一定会被返回，返回的每个键在扫描期间的某一时刻存在。
+ *               三、内存回收（epoch-based reclamation）
+ *               1. 线程在每次操作前进入当前全局纪元，操作后退出。被摘除的节点不能立即释放（其他线程可能正在访问），
+ *                  而是放入线程在当前纪元的待回收链表。
+ *               2. 所有活跃线程都已进入全局纪元 e 时，全局纪元才能推进到 e + 1 。线程进入纪元 e 时，
+ *                  在纪元 e - 3 退休的节点已不可能被任何线程访问，可以安全释放（待回收链表按纪元模 3 轮换）。
+ *               3. 节点的插入线程可能在删除之后才链接上层，因此节点在插入与删除都结束后（引用计数从 2 降为 0）才退休。
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "../utils/common.h"
+
+// 跳表的最大层数
+#define CSL_MAX_LEVEL 24
+// 每个线程每隔多少次操作尝试推进全局纪元
+#define CSL_EPOCH_INTERVAL 64
+// 值字段中的删除位
+#define CSL_DELETED (1ULL << 32)
+
+/* 跳表节点 */
+typedef struct CslNode {
+    int key;
+    int topLevel;                // 节点的层数
+    unsigned long long vword;    // 低 32 位为值，第 32 位为删除位
+    int refs;                    // 插入与删除尚未结束的数量
+    struct CslNode *retireNext;  // 待回收链表
+    uintptr_t next[];            // 各层的后继指针，最低位为标记位
+} CslNode;
+
+/* 线程的纪元记录（每个记录独占一个缓存行） */
+typedef struct {
+    unsigned long long epoch;    // 线程最近进入的全局纪元
+    int active;                  // 是否在操作中
+    int ops;                     // 操作计数
+    unsigned long long seed;     // 随机层数的种子
+    CslNode *limbo[3];           // 按纪元模 3 存放的待回收节点
+    char padding[16];
+} CslThreadRecord;
+
+/* 并发跳表 */
+typedef struct {
+    CslNode *head;               // 头节点，键视为负无穷
+    unsigned long long epoch;    // 全局纪元
+    int maxThreads;
+    CslThreadRecord *records;
+} ConcurrentSkipList;
+
+/* 指针的标记位 */
+bool cslMarked(uintptr_t p) {
+    return (p & 1) != 0;
+}
+
+/* 去掉标记位 */
+CslNode *cslPtr(uintptr_t p) {
+    return (CslNode *)(p & ~(uintptr_t)1);
+}
+
+/* 新建节点 */
+CslNode *newCslNode(int key, int val, int topLevel) {
+    CslNode *node = malloc(sizeof(CslNode) + sizeof(uintptr_t) * topLevel);
+    node->key = key;
+    node->topLevel = topLevel;
+    node->vword = (unsigned int)val;
+    node->refs = 2;
+    node->retireNext = NULL;
+    return node;
+}
+
+/* 构造函数：maxThreads 为使用该跳表的线程数量上限 */
+ConcurrentSkipList *newConcurrentSkipList(int maxThreads) {
+    ConcurrentSkipList *map = malloc(sizeof(ConcurrentSkipList));
+    map->head = newCslNode(INT_MIN, 0, CSL_MAX_LEVEL);
+    for (int l = 0; l < CSL_MAX_LEVEL; l++) {
+        map->head->next[l] = 0;
+    }
+    map->epoch = 0;
+    map->maxThreads = maxThreads;
+    map->records = aligned_alloc(64, sizeof(CslThreadRecord) * maxThreads);
+    memset(map->records, 0, sizeof(CslThreadRecord) * maxThreads);
+    for (int i = 0; i < maxThreads; i++) {
+        map->records[i].seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+    }
+    return map;
+}
+
+/* 释放待回收链表 */
+void cslFreeLimbo(CslNode *node) {
+    while (node != NULL) {
+        CslNode *next = node->retireNext;
+        free(node);
+        node = next;
+    }
+}
+
+/* 析构函数（须在所有线程结束操作后调用） */
+void delConcurrentSkipList(ConcurrentSkipList *map) {
+    CslNode *node = map->head;
+    while (node != NULL) {
+        CslNode *next = cslPtr(node->next[0]);
+        free(node);
+        node = next;
+    }
+    for (int i = 0; i < map->maxThreads; i++) {
+        for (int j = 0; j < 3; j++) {
+            cslFreeLimbo(map->records[i].limbo[j]);
+        }
+    }
+    free(map->records);
+    free(map);
+}
+
+/* 尝试推进全局纪元：所有活跃线程都已进入当前纪元时加一 */
+void cslTryAdvance(ConcurrentSkipList *map) {
+    unsigned long long e = __atomic_load_n(&map->epoch, __ATOMIC_SEQ_CST);
+    for (int i = 0; i < map->maxThreads; i++) {
+        CslThreadRecord *r = &map->records[i];
+        if (__atomic_load_n(&r->active, __ATOMIC_SEQ_CST) && __atomic_load_n(&r->epoch, __ATOMIC_SEQ_CST) != e) {
+            return;
+        }
+    }
+    __atomic_compare_exchange_n(&map->epoch, &e, e + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/* 线程进入临界区 */
+void cslEnter(ConcurrentSkipList *map, int tid) {
+    CslThreadRecord *r = &map->records[tid];
+    if (++r->ops % CSL_EPOCH_INTERVAL == 0) {
+        cslTryAdvance(map);
+    }
+    __atomic_store_n(&r->active, 1, __ATOMIC_SEQ_CST);
+    unsigned long long e = __atomic_load_n(&map->epoch, __ATOMIC_SEQ_CST);
+    if (e != r->epoch) {
+        // 纪元 e - 3 （及更早）退休的节点已不可能被访问
+        cslFreeLimbo(r->limbo[e % 3]);
+        r->limbo[e % 3] = NULL;
+        __atomic_store_n(&r->epoch, e, __ATOMIC_SEQ_CST);
+    }
+}
+
+/* 线程退出临界区 */
+void cslExit(ConcurrentSkipList *map, int tid) {
+    __atomic_store_n(&map->records[tid].active, 0, __ATOMIC_RELEASE);
+}
+
+/* 插入或删除结束，两者都结束后节点退休 */
+void cslRelease(ConcurrentSkipList *map, int tid, CslNode *node) {
+    if (__atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        CslThreadRecord *r = &map->records[tid];
+        node->retireNext = r->limbo[r->epoch % 3];
+        r->limbo[r->epoch % 3] = node;
+    }
+}
+
+/* 随机层数：以 1/2 的概率增加一层 */
+int cslRandomLevel(ConcurrentSkipList *map, int tid) {
+    unsigned long long *x = &map->records[tid].seed;
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    int level = 1 + __builtin_ctzll(*x | (1ULL << (CSL_MAX_LEVEL - 1)));
+    return level;
+}
+
+/* 查找 key 在每一层的前驱与后继，沿途摘除已标记的节点；第 0 层的后继的键等于 key 时返回 true */
+bool cslFind(ConcurrentSkipList *map, int key, CslNode **preds, CslNode **succs) {
+retry:;
+    CslNode *pred = map->head;
+    for (int l = CSL_MAX_LEVEL - 1; l >= 0; l--) {
+        CslNode *curr = cslPtr(__atomic_load_n(&pred->next[l], __ATOMIC_ACQUIRE));
+        while (curr != NULL) {
+            uintptr_t succ = __atomic_load_n(&curr->next[l], __ATOMIC_ACQUIRE);
+            if (cslMarked(succ)) {
+                // curr 已被删除，将其从 pred 之后摘除
+                uintptr_t expected = (uintptr_t)curr;
+                if (!__atomic_compare_exchange_n(&pred->next[l], &expected, (uintptr_t)cslPtr(succ), false,
+                                                 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                    goto retry;
+                }
+                curr = cslPtr(succ);
+                continue;
+            }
+            if (curr->key >= key) {
+                break;
+            }
+            pred = curr;
+            curr = cslPtr(succ);
+        }
+        preds[l] = pred;
+        succs[l] = curr;
+    }
+    return succs[0] != NULL && succs[0]->key == key;
+}
+
+/* 自顶向下标记节点各层的后继指针 */
+void cslMarkNode(CslNode *node) {
+    for (int l = node->topLevel - 1; l >= 0; l--) {
+        uintptr_t next = __atomic_load_n(&node->next[l], __ATOMIC_ACQUIRE);
+        while (!cslMarked(next) &&
+               !__atomic_compare_exchange_n(&node->next[l], &next, next | 1, false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE)) {
+        }
+    }
+}
+
+/* 查找：键存在时将值写入 *val 并返回 true */
+bool cslGet(ConcurrentSkipList *map, int tid, int key, int *val) {
+    cslEnter(map, tid);
+    CslNode *pred = map->head, *curr = NULL;
+    for (int l = CSL_MAX_LEVEL - 1; l >= 0; l--) {
+        curr = cslPtr(__atomic_load_n(&pred->next[l], __ATOMIC_ACQUIRE));
+        while (curr != NULL) {
+            uintptr_t succ = __atomic_load_n(&curr->next[l], __ATOMIC_ACQUIRE);
+            if (!cslMarked(succ) && curr->key >= key) {
+                break;
+            }
+            if (!cslMarked(succ)) {
+                pred = curr;
+            }
+            curr = cslPtr(succ);
+        }
+    }
+    bool found = false;
+    if (curr != NULL && curr->key == key) {
+        unsigned long long v = __atomic_load_n(&curr->vword, __ATOMIC_ACQUIRE);
+        if (!(v & CSL_DELETED)) {
+            *val = (int)(unsigned int)v;
+            found = true;
+        }
+    }
+    cslExit(map, tid);
+    return found;
+}
+
+/* 插入键值对：键不存在时插入并返回 true ，已存在时更新值并返回 false */
+bool cslPut(ConcurrentSkipList *map, int tid, int key, int val) {
+    CslNode *preds[CSL_MAX_LEVEL], *succs[CSL_MAX_LEVEL], *node = NULL;
+    cslEnter(map, tid);
+    for (;;) {
+        if (cslFind(map, key, preds, succs)) {
+            CslNode *found = succs[0];
+            unsigned long long v = __atomic_load_n(&found->vword, __ATOMIC_ACQUIRE);
+            if (v & CSL_DELETED) {
+                // 已被逻辑删除，帮助标记后重新查找
+                cslMarkNode(found);
+                continue;
+            }
+            if (__atomic_compare_exchange_n(&found->vword, &v, (unsigned int)val, false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE)) {
+                free(node);
+                cslExit(map, tid);
+                return false;
+            }
+            continue;
+        }
+        if (node == NULL) {
+            node = newCslNode(key, val, cslRandomLevel(map, tid));
+        }
+        for (int l = 0; l < node->topLevel; l++) {
+            node->next[l] = (uintptr_t)succs[l];
+        }
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (__atomic_compare_exchange_n(&preds[0]->next[0], &expected, (uintptr_t)node, false, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE)) {
+            break;
+        }
+    }
+
+    /* 逐层向上链接，节点被并发删除时停止 */
+    for (int l = 1; l < node->topLevel; l++) {
+        for (;;) {
+            uintptr_t old = __atomic_load_n(&node->next[l], __ATOMIC_ACQUIRE);
+            if (cslMarked(old)) {
+                goto done;
+            }
+            if (succs[l] != NULL && succs[l]->key == key) {
+                // 该层还留有同键的已删除节点，重新查找将其摘除
+                cslFind(map, key, preds, succs);
+                if (succs[0] != node) {
+                    goto done;
+                }
+                continue;
+            }
+            if (old != (uintptr_t)succs[l] &&
+                !__atomic_compare_exchange_n(&node->next[l], &old, (uintptr_t)succs[l], false, __ATOMIC_ACQ_REL,
+                                             __ATOMIC_ACQUIRE)) {
+                goto done;
+            }
+            uintptr_t expected = (uintptr_t)succs[l];
+            if (__atomic_compare_exchange_n(&preds[l]->next[l], &expected, (uintptr_t)node, false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE)) {
+                break;
+            }
+            cslFind(map, key, preds, succs);
+            if (succs[0] != node) {
+                goto done;
+            }
+        }
+    }
+done:
+    if (cslMarked(__atomic_load_n(&node->next[0], __ATOMIC_SEQ_CST))) {
+        // 链接期间节点已被删除，上层可能是在删除线程摘除之后才链接的，再摘除一次
+        cslFind(map, key, preds, succs);
+    }
+    cslRelease(map, tid, node);
+    cslExit(map, tid);
+    return true;
+}
+
+/* 删除：键存在时将值写入 *val（可为 NULL）并返回 true */
+bool cslRemove(ConcurrentSkipList *map, int tid, int key, int *val) {
+    CslNode *preds[CSL_MAX_LEVEL], *succs[CSL_MAX_LEVEL];
+    cslEnter(map, tid);
+    for (;;) {
+        if (!cslFind(map, key, preds, succs)) {
+            cslExit(map, tid);
+            return false;
+        }
+        CslNode *node = succs[0];
+        unsigned long long v = __atomic_load_n(&node->vword, __ATOMIC_ACQUIRE);
+        if (v & CSL_DELETED) {
+            cslMarkNode(node);
+            continue;
+        }
+        if (__atomic_compare_exchange_n(&node->vword, &v, v | CSL_DELETED, false, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE)) {
+            if (val != NULL) {
+                *val = (int)(unsigned int)v;
+            }
+            cslMarkNode(node);
+            cslFind(map, key, preds, succs);
+            cslRelease(map, tid, node);
+            cslExit(map, tid);
+            return true;
+        }
+    }
+}
+
+/* 范围扫描：将 [lo, hi] 内的键值对按升序写入 keys 、vals（最多 cap 个），返回写入的数量 */
+int cslRangeScan(ConcurrentSkipList *map, int tid, int lo, int hi, int *keys, int *vals, int cap) {
+    cslEnter(map, tid);
+    CslNode *pred = map->head, *curr = NULL;
+    for (int l = CSL_MAX_LEVEL - 1; l >= 0; l--) {
+        curr = cslPtr(__atomic_load_n(&pred->next[l], __ATOMIC_ACQUIRE));
+        while (curr != NULL) {
+            uintptr_t succ = __atomic_load_n(&curr->next[l], __ATOMIC_ACQUIRE);
+            if (!cslMarked(succ) && curr->key >= lo) {
+                break;
+            }
+            if (!cslMarked(succ)) {
+                pred = curr;
+            }
+            curr = cslPtr(succ);
+        }
+    }
+    int size = 0;
+    while (curr != NULL && curr->key <= hi && size < cap) {
+        uintptr_t succ = __atomic_load_n(&curr->next[0], __ATOMIC_ACQUIRE);
+        unsigned long long v = __atomic_load_n(&curr->vword, __ATOMIC_ACQUIRE);
+        if (!cslMarked(succ) && !(v & CSL_DELETED) && (size == 0 || curr->key > keys[size - 1])) {
+            keys[size] = curr->key;
+            vals[size] = (int)(unsigned int)v;
+            size++;
+        }
+        curr = cslPtr(succ);
+    }
+    cslExit(map, tid);
+    return size;
+}
+
+/* 键的数量（须在没有并发修改时调用） */
+long long cslSize(ConcurrentSkipList *map) {
+    long long size = 0;
+    for (CslNode *node = cslPtr(map->head->next[0]); node != NULL; node = cslPtr(node->next[0])) {
+        size += !(node->vword & CSL_DELETED);
+    }
+    return size;
+}
+
+/* 检查结构（须在没有并发修改时调用）：各层严格递增、没有残留的已标记节点、上层是下层的子序列 */
+bool cslValidate(ConcurrentSkipList *map) {
+    for (int l = 0; l < CSL_MAX_LEVEL; l++) {
+        CslNode *lower = cslPtr(map->head->next[l > 0 ? l - 1 : 0]);
+        for (CslNode *node = cslPtr(map->head->next[l]); node != NULL; node = cslPtr(node->next[l])) {
+            CslNode *next = cslPtr(node->next[l]);
+            if (cslMarked(node->next[l]) || (node->vword & CSL_DELETED) || node->topLevel <= l ||
+                (next != NULL && next->key <= node->key)) {
+                return false;
+            }
+            if (l > 0) {
+                while (lower != NULL && lower != node) {
+                    lower = cslPtr(lower->next[l - 1]);
+                }
+                if (lower == NULL) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
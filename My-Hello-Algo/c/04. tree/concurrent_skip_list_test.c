@@ -0,0 +1,320 @@
+/**
+ * @FileName    :concurrent_skip_list_test.c
+ * @Date        :2026-10-20 09:48:27
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :并发跳表测试程序
+ * @Description :1. 基本测试：单线程插入、更新、查找、删除、范围扫描
+ *               2. 正确性：
+ *                  (1) 各线程修改互不相交的键（同时读取其他线程的键），结束后与各线程的本地记录一致；
+ *                  (2) 多个线程争用少量相同的键，插入成功次数减去删除成功次数等于最终的键数量，每次删除取出的值都曾被写入；
+ *                  (3) 修改线程运行期间，范围扫描的结果严格递增、位于范围内，且包含所有从未被修改的键。
+ *                  每组结束后检查跳表结构。
+ *               3. 性能：键的范围为 BENCH_KEYS（默认 10^6），预先插入一半；80% 查找、10% 插入、10% 删除，
+ *                  共 BENCH_OPS 次操作（默认 2 * 10^6）平均分给 1 ~ 64 个线程，与全局互斥锁保护的 AVLTree 比较吞吐量。
+ */
+
+#include "../utils/bench_util.h"
+#include "concurrent_skip_list.c"
+#include "avl_tree.c"
+
+#ifndef BENCH_KEYS
+#define BENCH_KEYS 1000000
+#endif
+
+#ifndef BENCH_OPS
+#define BENCH_OPS 2000000
+#endif
+
+/* 基本测试 */
+void testBasic() {
+    ConcurrentSkipList *map = newConcurrentSkipList(1);
+    int keys[] = {50, 20, 80, 10, 30, 70, 90, 60};
+    for (int i = 0; i < 8; i++) {
+        assert(cslPut(map, 0, keys[i], keys[i] * 10));
+    }
+    assert(!cslPut(map, 0, 30, 333));
+    int val, outKeys[16], outVals[16];
+    int size = cslRangeScan(map, 0, INT_MIN, INT_MAX, outKeys, outVals, 16);
+    printf("插入 8 个键并将 30 的值更新为 333 后：\n键：");
+    printArray(outKeys, size);
+    printf("值：");
+    printArray(outVals, size);
+    assert(size == 8 && cslGet(map, 0, 30, &val) && val == 333);
+
+    assert(cslRemove(map, 0, 50, &val) && val == 500);
+    assert(!cslRemove(map, 0, 50, NULL) && !cslGet(map, 0, 50, &val));
+    size = cslRangeScan(map, 0, 25, 75, outKeys, outVals, 16);
+    printf("删除 50 后，[25, 75] 内的键：");
+    printArray(outKeys, size);
+    assert(size == 3 && outKeys[0] == 30 && outKeys[2] == 70);
+    assert(cslSize(map) == 7 && cslValidate(map));
+    delConcurrentSkipList(map);
+}
+
+/* 正确性测试的线程参数 */
+typedef struct {
+    ConcurrentSkipList *map;
+    int tid, threadNum, keyRange, ops;
+    int *present, *value;               // 本地记录（互不相交的键）
+    long long inserted, removed;        // 成功次数（争用相同的键）
+    bool stop;                          // 扫描线程的结束标志（由主线程设置）
+    bool ok;
+} CslTestTask;
+
+/* 修改互不相交的键：线程 tid 只修改模 threadNum 余 tid 的键 */
+void *cslDisjointWorker(void *arg) {
+    CslTestTask *t = arg;
+    unsigned long long x = 1234567ULL * (t->tid + 1);
+    int val;
+    for (int i = 0; i < t->ops; i++) {
+        int r = randU32(&x);
+        int key = (int)(randU32(&x) % (t->keyRange / t->threadNum)) * t->threadNum + t->tid;
+        if (r % 4 == 0) {
+            bool existed = t->present[key];
+            t->ok &= cslRemove(t->map, t->tid, key, &val) == existed && (!existed || val == t->value[key]);
+            t->present[key] = 0;
+        } else if (r % 4 == 1) {
+            int v = (int)randU32(&x);
+            t->ok &= cslPut(t->map, t->tid, key, v) == !t->present[key];
+            t->present[key] = 1;
+            t->value[key] = v;
+        } else if (r % 4 == 2) {
+            bool found = cslGet(t->map, t->tid, key, &val);
+            t->ok &= found == t->present[key] && (!found || val == t->value[key]);
+        } else {
+            // 读取其他线程的键，只制造并发访问
+            cslGet(t->map, t->tid, (int)(randU32(&x) % t->keyRange), &val);
+        }
+    }
+    return NULL;
+}
+
+/* 争用少量相同的键：值为写入线程的 tid ，删除取出的值必须是某个线程写入的 */
+void *cslContendWorker(void *arg) {
+    CslTestTask *t = arg;
+    unsigned long long x = 7654321ULL * (t->tid + 1);
+    int val;
+    for (int i = 0; i < t->ops; i++) {
+        int key = (int)(randU32(&x) % t->keyRange);
+        if (randU32(&x) % 2 == 0) {
+            t->inserted += cslPut(t->map, t->tid, key, t->tid);
+        } else if (cslRemove(t->map, t->tid, key, &val)) {
+            t->removed++;
+            t->ok &= val >= 0 && val < t->threadNum;
+        }
+    }
+    return NULL;
+}
+
+/* 修改奇数键 */
+void *cslOddWorker(void *arg) {
+    CslTestTask *t = arg;
+    unsigned long long x = 998244353ULL * (t->tid + 1);
+    for (int i = 0; i < t->ops; i++) {
+        int key = (int)(randU32(&x) % (t->keyRange / 2)) * 2 + 1;
+        if (randU32(&x) % 2 == 0) {
+            cslPut(t->map, t->tid, key, key);
+        } else {
+            cslRemove(t->map, t->tid, key, NULL);
+        }
+    }
+    return NULL;
+}
+
+/* 反复扫描，检查偶数键（从未被修改）都在结果中 */
+void *cslScanWorker(void *arg) {
+    CslTestTask *t = arg;
+    int *keys = malloc(sizeof(int) * t->keyRange), *vals = malloc(sizeof(int) * t->keyRange);
+    unsigned long long x = 31337;
+    while (!__atomic_load_n(&t->stop, __ATOMIC_ACQUIRE)) {
+        int lo = (int)(randU32(&x) % t->keyRange), hi = lo + (int)(randU32(&x) % 2000);
+        int size = cslRangeScan(t->map, t->tid, lo, hi, keys, vals, t->keyRange);
+        int even = 0;
+        for (int i = 0; i < size; i++) {
+            t->ok &= keys[i] >= lo && keys[i] <= hi && (i == 0 || keys[i] > keys[i - 1]) && vals[i] == keys[i];
+            even += keys[i] % 2 == 0;
+        }
+        // [lo, hi] ∩ [0, keyRange) 中偶数的个数
+        int top = hi < t->keyRange - 1 ? hi : t->keyRange - 1;
+        int expect = top >= lo ? top / 2 - (lo + 1) / 2 + 1 : 0;
+        t->ok &= even == expect;
+        t->ops++;
+    }
+    free(keys);
+    free(vals);
+    return NULL;
+}
+
+/* 正确性 */
+void testValidate() {
+    int threadNum = 8, keyRange = 4096;
+    pthread_t tids[8];
+    CslTestTask tasks[8];
+
+    /* 互不相交的键 */
+    ConcurrentSkipList *map = newConcurrentSkipList(threadNum);
+    int *present = calloc(keyRange, sizeof(int)), *value = calloc(keyRange, sizeof(int));
+    for (int i = 0; i < threadNum; i++) {
+        tasks[i] = (CslTestTask){map, i, threadNum, keyRange, 100000, present, value, 0, 0, false, true};
+        pthread_create(&tids[i], NULL, cslDisjointWorker, &tasks[i]);
+    }
+    long long expectSize = 0;
+    for (int i = 0; i < threadNum; i++) {
+        pthread_join(tids[i], NULL);
+        assert(tasks[i].ok);
+    }
+    for (int key = 0; key < keyRange; key++) {
+        int val;
+        bool found = cslGet(map, 0, key, &val);
+        assert(found == present[key] && (!found || val == value[key]));
+        expectSize += present[key];
+    }
+    assert(cslSize(map) == expectSize && cslValidate(map));
+    printf("%d 个线程修改互不相交的键：结果与各线程的本地记录一致（%lld 个键）\n", threadNum, expectSize);
+    delConcurrentSkipList(map);
+    free(present);
+    free(value);
+
+    /* 争用相同的键 */
+    map = newConcurrentSkipList(threadNum);
+    long long inserted = 0, removed = 0;
+    for (int i = 0; i < threadNum; i++) {
+        tasks[i] = (CslTestTask){map, i, threadNum, 64, 200000, NULL, NULL, 0, 0, false, true};
+        pthread_create(&tids[i], NULL, cslContendWorker, &tasks[i]);
+    }
+    for (int i = 0; i < threadNum; i++) {
+        pthread_join(tids[i], NULL);
+        assert(tasks[i].ok);
+        inserted += tasks[i].inserted;
+        removed += tasks[i].removed;
+    }
+    assert(cslSize(map) == inserted - removed && cslValidate(map));
+    printf("%d 个线程争用 64 个键：插入成功 %lld 次，删除成功 %lld 次，剩余 %lld 个键\n", threadNum, inserted, removed,
+           cslSize(map));
+    delConcurrentSkipList(map);
+
+    /* 并发修改时的范围扫描 */
+    map = newConcurrentSkipList(threadNum);
+    for (int key = 0; key < keyRange; key += 2) {
+        cslPut(map, 0, key, key);
+    }
+    for (int i = 0; i < threadNum; i++) {
+        tasks[i] = (CslTestTask){map, i, threadNum, keyRange, i < threadNum / 2 ? 200000 : 0, NULL, NULL, 0, 0, false,
+                                 true};
+        pthread_create(&tids[i], NULL, i < threadNum / 2 ? cslOddWorker : cslScanWorker, &tasks[i]);
+    }
+    for (int i = 0; i < threadNum / 2; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    for (int i = threadNum / 2; i < threadNum; i++) {
+        __atomic_store_n(&tasks[i].stop, true, __ATOMIC_RELEASE);
+    }
+    int scans = 0;
+    for (int i = threadNum / 2; i < threadNum; i++) {
+        pthread_join(tids[i], NULL);
+        assert(tasks[i].ok);
+        scans += tasks[i].ops;
+    }
+    assert(cslValidate(map));
+    printf("修改奇数键的同时完成 %d 次范围扫描：结果有序，且包含所有未被修改的偶数键\n", scans);
+    delConcurrentSkipList(map);
+}
+
+/* 全局互斥锁保护的 AVL 树 */
+typedef struct {
+    AVLTree *avl;
+    pthread_mutex_t lock;
+} LockedAVLTree;
+
+/* 性能测试的线程参数 */
+typedef struct {
+    ConcurrentSkipList *map;
+    LockedAVLTree *locked;
+    int tid, ops;
+} CslBenchTask;
+
+/* 80% 查找、10% 插入、10% 删除 */
+void *cslBenchWorker(void *arg) {
+    CslBenchTask *t = arg;
+    unsigned long long x = 0x9E3779B97F4A7C15ULL * (t->tid + 1);
+    int val;
+    for (int i = 0; i < t->ops; i++) {
+        int key = (int)(randU32(&x) % BENCH_KEYS), op = (int)(randU32(&x) % 10);
+        if (t->map != NULL) {
+            if (op < 8) {
+                cslGet(t->map, t->tid, key, &val);
+            } else if (op == 8) {
+                cslPut(t->map, t->tid, key, i);
+            } else {
+                cslRemove(t->map, t->tid, key, NULL);
+            }
+        } else {
+            pthread_mutex_lock(&t->locked->lock);
+            if (op < 8) {
+                search(t->locked->avl, key);
+            } else if (op == 8) {
+                insert(t->locked->avl, key);
+            } else {
+                removeItem(t->locked->avl, key);
+            }
+            pthread_mutex_unlock(&t->locked->lock);
+        }
+    }
+    return NULL;
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    printf("键的范围 %d ，共 %d 次操作（80%% 查找 / 10%% 插入 / 10%% 删除），单位为百万次操作 / 秒\n", BENCH_KEYS,
+           BENCH_OPS);
+    printf("%-8s %14s %14s\n", "线程数", "无锁跳表", "互斥锁 AVL");
+    for (int threadNum = 1; threadNum <= 64; threadNum *= 2) {
+        double mops[2];
+        for (int kind = 0; kind < 2; kind++) {
+            ConcurrentSkipList *map = NULL;
+            LockedAVLTree locked = {NULL};
+            if (kind == 0) {
+                map = newConcurrentSkipList(threadNum);
+                for (int key = 0; key < BENCH_KEYS; key += 2) {
+                    cslPut(map, 0, key, key);
+                }
+            } else {
+                locked.avl = newAVLTreePooled();
+                pthread_mutex_init(&locked.lock, NULL);
+                for (int key = 0; key < BENCH_KEYS; key += 2) {
+                    insert(locked.avl, key);
+                }
+            }
+            pthread_t *tids = malloc(sizeof(pthread_t) * threadNum);
+            CslBenchTask *tasks = malloc(sizeof(CslBenchTask) * threadNum);
+            double start = wallSeconds();
+            for (int i = 0; i < threadNum; i++) {
+                tasks[i] = (CslBenchTask){map, &locked, i, BENCH_OPS / threadNum};
+                pthread_create(&tids[i], NULL, cslBenchWorker, &tasks[i]);
+            }
+            for (int i = 0; i < threadNum; i++) {
+                pthread_join(tids[i], NULL);
+            }
+            mops[kind] = (double)(BENCH_OPS / threadNum * threadNum) / (wallSeconds() - start) / 1e6;
+            if (kind == 0) {
+                assert(cslValidate(map));
+                delConcurrentSkipList(map);
+            } else {
+                pthread_mutex_destroy(&locked.lock);
+                delAVLTree(locked.avl);
+            }
+            free(tids);
+            free(tasks);
+        }
+        printf("%-8d %14.2f %14.2f\n", threadNum, mops[0], mops[1]);
+    }
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * @FileName    :eytzinger_tree.c
+ * @Date        :2026-10-20 08:02:17
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :静态查找树的 Eytzinger 布局与 van Emde Boas 布局
+ * @Description :有序数组上的二分查找，前几轮访问的元素相距很远，每轮都是一次缓存失效，且下一次访问的位置取决于本轮比较结果，
+ *               无法提前加载。把有序数组视为一棵完全平衡的二叉搜索树，再换一种存放顺序，可以让访存更友好。
+ *               一、Eytzinger 布局（即 array_binary_tree.c 中的层序存放）
+ *               1. 下标从 1 开始，节点 k 的左右子节点为 2k 与 2k + 1 ，对有序数组做一次中序遍历即可填入，O(n) 。
+ *               2. 查找下界：k = 2k + (b[k] < x) ，循环次数固定，无分支；结束时 k 的二进制末尾有若干个 1
+ *                  （最后几步都向右走），去掉这些 1 及其前面的一个 0 即为答案。
+ *               3. 预取：节点 k 往下第 4 层的 16 个后代 b[16k .. 16k + 15] 恰好占一个缓存行（数组按 64 字节对齐），
+ *                  每轮预取这一行，4 轮之后用到时数据已经在缓存中，相当于同时有 4 次访存在进行。
+ *               二、van Emde Boas 布局
+ *               将高度为 h 的树从中间分为高度 h / 2 的顶部子树与若干棵高度 h - h / 2 的底部子树，
+ *               依次存放顶部子树与各棵底部子树，并对每棵子树递归地使用同样的布局。任意大小的缓存块中都存放着
+ *               一棵高度接近 log(块大小) 的完整子树，与缓存大小无关（cache-oblivious）。
+ *               查找时按深度预先计算的表 T / B / D 求出路径上每个节点的位置：深度为 d 、层序下标为 i 的节点，
+ *               位置 = pos[D[d]] + T[d] + (i & T[d]) * B[d] ，其中 D[d] 为它所在顶部子树根节点的深度，
+ *               T[d] 、B[d] 为该次划分中顶部子树与底部子树的节点数量。
+ *               节点数量补齐为 2^h - 1 ，多出的位置填入 INT_MAX 。
+ *               两种布局都可以附带与键一一对应的值数组，作为静态查找表使用。
+ */
+
+#include "../utils/common.h"
+
+#ifdef _WIN32
+#include <malloc.h>
+#define eytzAlignedAlloc(size) _aligned_malloc(size, 64)
+#define eytzAlignedFree(ptr) _aligned_free(ptr)
+#else
+#define eytzAlignedAlloc(size) aligned_alloc(64, ((size) + 63) / 64 * 64)
+#define eytzAlignedFree(ptr) free(ptr)
+#endif
+
+// van Emde Boas 布局支持的最大树高
+#define VEB_MAX_HEIGHT 40
+
+/* Eytzinger 布局的静态查找树 */
+typedef struct {
+    int *keys;   // keys[1 .. n] 为层序存放的键，keys[0] 不使用
+    int *vals;   // 与 keys 对应的值，可为 NULL
+    long long n; // 键的数量
+} EytzTree;
+
+/* 中序遍历完全二叉树，依次填入有序的键与值 */
+long long eytzFill(EytzTree *tree, const int *keys, const int *vals, long long i, long long k) {
+    if (k > tree->n) {
+        return i;
+    }
+    i = eytzFill(tree, keys, vals, i, 2 * k);
+    tree->keys[k] = keys[i];
+    if (vals != NULL) {
+        tree->vals[k] = vals[i];
+    }
+    i++;
+    return eytzFill(tree, keys, vals, i, 2 * k + 1);
+}
+
+/* 构造函数：由升序数组 keys 与对应的值 vals（可为 NULL）构建 */
+EytzTree *newEytzTree(const int *keys, const int *vals, long long n) {
+    EytzTree *tree = malloc(sizeof(EytzTree));
+    tree->n = n;
+    tree->keys = eytzAlignedAlloc(sizeof(int) * (n + 1));
+    tree->vals = vals != NULL ? malloc(sizeof(int) * (n + 1)) : NULL;
+    tree->keys[0] = INT_MIN;
+    eytzFill(tree, keys, vals, 0, 1);
+    return tree;
+}
+
+/* 析构函数 */
+void delEytzTree(EytzTree *tree) {
+    eytzAlignedFree(tree->keys);
+    free(tree->vals);
+    free(tree);
+}
+
+/* 查找下界：返回首个不小于 x 的键在 keys 中的下标，不存在时返回 0（预取 4 层之后的后代） */
+long long eytzLowerBound(const EytzTree *tree, int x) {
+    const int *b = tree->keys;
+    unsigned long long k = 1, n = tree->n;
+    while (k <= n) {
+        __builtin_prefetch(b + k * 16);
+        k = 2 * k + (b[k] < x);
+    }
+    // 去掉末尾连续的 1 以及其前面的一个 0
+    k >>= __builtin_ffsll(~k);
+    return (long long)k;
+}
+
+/* 查找下界，不预取 */
+long long eytzLowerBoundPlain(const EytzTree *tree, int x) {
+    const int *b = tree->keys;
+    unsigned long long k = 1, n = tree->n;
+    while (k <= n) {
+        k = 2 * k + (b[k] < x);
+    }
+    k >>= __builtin_ffsll(~k);
+    return (long long)k;
+}
+
+/* van Emde Boas 布局的静态查找树 */
+typedef struct {
+    int *keys;                   // 按 vEB 布局存放的键，长度为 2^height - 1
+    int *vals;                   // 与 keys 对应的值，可为 NULL
+    long long n;                 // 真实键的数量
+    int height;                  // 树高（层数）
+    bool hasMax;                 // 真实键中是否有 INT_MAX（用于区分补齐的位置）
+    long long T[VEB_MAX_HEIGHT]; // 以深度 d 为根的底部子树，所在划分中顶部子树的节点数量
+    long long B[VEB_MAX_HEIGHT]; // 以深度 d 为根的底部子树的节点数量
+    int D[VEB_MAX_HEIGHT];       // 对应顶部子树根节点的深度
+} VebTree;
+
+/* 计算深度 d0 开始、高度为 h 的子树中各次划分的 T / B / D */
+void vebTables(VebTree *tree, int d0, int h) {
+    if (h <= 1) {
+        return;
+    }
+    int ht = h / 2, hb = h - ht;
+    tree->T[d0 + ht] = (1LL << ht) - 1;
+    tree->B[d0 + ht] = (1LL << hb) - 1;
+    tree->D[d0 + ht] = d0;
+    vebTables(tree, d0, ht);
+    vebTables(tree, d0 + ht, hb);
+}
+
+/* 将层序下标为 i 、高度为 h 的子树按 vEB 布局放到 base 开始的位置；src 为层序存放的键（下标从 1 开始） */
+void vebPlace(VebTree *tree, const int *src, const int *srcVals, long long i, int h, long long base) {
+    if (h == 1) {
+        tree->keys[base] = src[i];
+        if (srcVals != NULL) {
+            tree->vals[base] = srcVals[i];
+        }
+        return;
+    }
+    int ht = h / 2, hb = h - ht;
+    long long top = (1LL << ht) - 1, bottom = (1LL << hb) - 1;
+    vebPlace(tree, src, srcVals, i, ht, base);
+    for (long long j = 0; j <= top; j++) {
+        vebPlace(tree, src, srcVals, (i << ht) + j, hb, base + top + j * bottom);
+    }
+}
+
+/* 构造函数：由升序数组 keys 与对应的值 vals（可为 NULL）构建 */
+VebTree *newVebTree(const int *keys, const int *vals, long long n) {
+    VebTree *tree = malloc(sizeof(VebTree));
+    tree->n = n;
+    tree->height = 1;
+    while ((1LL << tree->height) - 1 < n) {
+        tree->height++;
+    }
+    tree->hasMax = n > 0 && keys[n - 1] == INT_MAX;
+    long long size = (1LL << tree->height) - 1;
+    // 先补齐后按层序存放，再逐棵子树搬到 vEB 布局
+    int *padded = malloc(sizeof(int) * size), *paddedVals = NULL;
+    memcpy(padded, keys, sizeof(int) * n);
+    for (long long i = n; i < size; i++) {
+        padded[i] = INT_MAX;
+    }
+    if (vals != NULL) {
+        paddedVals = calloc(size, sizeof(int));
+        memcpy(paddedVals, vals, sizeof(int) * n);
+    }
+    EytzTree *bfs = newEytzTree(padded, paddedVals, size);
+    tree->keys = eytzAlignedAlloc(sizeof(int) * size);
+    tree->vals = vals != NULL ? malloc(sizeof(int) * size) : NULL;
+    vebTables(tree, 0, tree->height);
+    vebPlace(tree, bfs->keys, bfs->vals, 1, tree->height, 0);
+    delEytzTree(bfs);
+    free(padded);
+    free(paddedVals);
+    return tree;
+}
+
+/* 析构函数 */
+void delVebTree(VebTree *tree) {
+    eytzAlignedFree(tree->keys);
+    free(tree->vals);
+    free(tree);
+}
+
+/* 查找下界：返回首个不小于 x 的键在 keys 中的位置，不存在时返回 -1 */
+long long vebLowerBound(const VebTree *tree, int x) {
+    long long pos[VEB_MAX_HEIGHT], ans = -1;
+    unsigned long long i = 1;
+    pos[0] = 0;
+    for (int d = 0; d < tree->height; d++) {
+        if (d > 0) {
+            pos[d] = pos[tree->D[d]] + tree->T[d] + (long long)(i & tree->T[d]) * tree->B[d];
+        }
+        int key = tree->keys[pos[d]];
+        // 路径上最后一个不小于 x 的节点即为下界
+        ans = key >= x ? pos[d] : ans;
+        i = 2 * i + (key < x);
+    }
+    if (ans >= 0 && tree->keys[ans] == INT_MAX && !tree->hasMax) {
+        // 落在补齐的位置上
+        return -1;
+    }
+    return ans;
+}
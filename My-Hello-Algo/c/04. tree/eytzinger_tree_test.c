@@ -0,0 +1,226 @@
+/**
+ * @FileName    :eytzinger_tree_test.c
+ * @Date        :2026-10-20 08:31:46
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :Eytzinger 布局与 van Emde Boas 布局静态查找树测试程序
+ * @Description :1. 基本测试：打印小数组的两种布局，查找下界并取出对应的值
+ *               2. 正确性：各种大小（含 0 、1 、2^k - 1 、2^k 、含重复键与 INT_MIN / INT_MAX）的数组上，
+ *                  两种布局的下界与有序数组上的下界一致
+ *               3. 性能：数组大小从 1KB 按 4 倍增长到 BENCH_MAX_BYTES（默认 64MB ，-DBENCH_MAX_BYTES=4294967296
+ *                  可测试到 4GB ，需要约 16GB 内存），比较 binarySearch（07. searching/binary_search.c）、
+ *                  有序数组上的无分支下界、Eytzinger（预取 / 不预取）与 vEB 布局每次查找的平均耗时。
+ */
+
+#include "../utils/bench_util.h"
+#include "eytzinger_tree.c"
+#include "../07. searching/simd_search.c"
+
+#ifndef BENCH_MAX_BYTES
+#define BENCH_MAX_BYTES (64LL << 20)
+#endif
+
+#ifndef BENCH_QUERIES
+#define BENCH_QUERIES 1000000
+#endif
+
+/* 二分查找（双闭区间），与 07. searching/binary_search.c 相同 */
+int binarySearch(int *nums, int len, int target) {
+    int i = 0, j = len - 1;
+    while (i <= j) {
+        int m = i + (j - i) / 2;
+        if (nums[m] < target) {
+            i = m + 1;
+        } else if (nums[m] > target) {
+            j = m - 1;
+        } else {
+            return m;
+        }
+    }
+    return -1;
+}
+
+/* 有序数组上的下界（逐个比较，作为正确性的参照） */
+long long lowerBoundRef(const int *nums, long long n, int x) {
+    long long lo = 0, hi = n;
+    while (lo < hi) {
+        long long m = lo + (hi - lo) / 2;
+        if (nums[m] < x) {
+            lo = m + 1;
+        } else {
+            hi = m;
+        }
+    }
+    return lo;
+}
+
+/* 基本测试 */
+void testBasic() {
+    int keys[] = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19};
+    int vals[] = {10, 30, 50, 70, 90, 110, 130, 150, 170, 190};
+    EytzTree *eytz = newEytzTree(keys, vals, 10);
+    VebTree *veb = newVebTree(keys, vals, 10);
+    printf("有序数组：");
+    printArray(keys, 10);
+    printf("Eytzinger 布局（下标 1 ~ 10）：");
+    printArray(eytz->keys + 1, 10);
+    printf("vEB 布局（补齐为 %d 个节点）：", (1 << veb->height) - 1);
+    printArray(veb->keys, (1 << veb->height) - 1);
+
+    int queries[] = {0, 1, 6, 19, 20};
+    for (int i = 0; i < 5; i++) {
+        long long k = eytzLowerBound(eytz, queries[i]), p = vebLowerBound(veb, queries[i]);
+        if (k == 0) {
+            printf("不小于 %d 的键不存在\n", queries[i]);
+            assert(p == -1);
+            continue;
+        }
+        printf("不小于 %d 的最小键为 %d ，对应的值为 %d\n", queries[i], eytz->keys[k], eytz->vals[k]);
+        assert(p >= 0 && veb->keys[p] == eytz->keys[k] && veb->vals[p] == eytz->vals[k]);
+    }
+    delEytzTree(eytz);
+    delVebTree(veb);
+}
+
+/* 正确性 */
+void testValidate() {
+    int sizes[] = {0, 1, 2, 3, 7, 8, 15, 16, 100, 1023, 1024, 1025, 4097, 65535, 100000};
+    unsigned long long x = 2026;
+    int cases = 0;
+    for (int s = 0; s < 15; s++) {
+        for (int dup = 0; dup < 2; dup++) {
+            int n = sizes[s];
+            int *keys = malloc(sizeof(int) * (n + 1)), *vals = malloc(sizeof(int) * (n + 1));
+            // 不重复时步长为 3 ；重复时步长为 0 或 1 ，并在两端放入 INT_MIN 与 INT_MAX
+            int v = dup ? -n / 2 : -3 * (n / 2);
+            for (int i = 0; i < n; i++) {
+                keys[i] = v;
+                vals[i] = i;
+                v += dup ? (int)(randU32(&x) & 1) : 3;
+            }
+            if (dup && n >= 2) {
+                keys[0] = INT_MIN;
+                keys[n - 1] = INT_MAX;
+            }
+            EytzTree *eytz = newEytzTree(keys, vals, n);
+            VebTree *veb = newVebTree(keys, vals, n);
+            for (int q = 0; q < 3000; q++) {
+                int target;
+                if (q == 0) {
+                    target = INT_MIN;
+                } else if (q == 1) {
+                    target = INT_MAX;
+                } else if (n > 0 && q % 2 == 0) {
+                    long long t = (long long)keys[randU32(&x) % n] + (int)(randU32(&x) % 3) - 1;
+                    target = t < INT_MIN ? INT_MIN : (t > INT_MAX ? INT_MAX : (int)t);
+                } else {
+                    target = (int)randU32(&x);
+                }
+                long long expect = lowerBoundRef(keys, n, target);
+                long long k = eytzLowerBound(eytz, target), p = vebLowerBound(veb, target);
+                assert(k == eytzLowerBoundPlain(eytz, target));
+                if (expect == n) {
+                    assert(k == 0 && p == -1);
+                } else {
+                    // 有重复键时值不唯一，只比较键
+                    assert(k > 0 && eytz->keys[k] == keys[expect] && p >= 0 && veb->keys[p] == keys[expect]);
+                    assert(dup || (eytz->vals[k] == vals[expect] && veb->vals[p] == vals[expect]));
+                }
+                if (n > 0 && !dup) {
+                    int idx = binarySearch(keys, n, target);
+                    assert((idx >= 0) == (eytz->keys[k] == target && k > 0));
+                }
+                cases++;
+            }
+            delEytzTree(eytz);
+            delVebTree(veb);
+            free(keys);
+            free(vals);
+        }
+    }
+    printf("%d 次查找中，Eytzinger 与 vEB 布局的下界均与有序数组一致\n", cases);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int q = BENCH_QUERIES;
+    int *queries = malloc(sizeof(int) * q);
+    printf("每种大小随机查找 %d 次，单位为 ns / 次\n", q);
+    printf("%-10s %12s %12s %12s %12s %12s\n", "数组大小", "binarySearch", "无分支下界", "Eytz+预取", "Eytzinger",
+           "vEB");
+    for (long long bytes = 1024; bytes <= BENCH_MAX_BYTES; bytes *= 4) {
+        int n = (int)(bytes / sizeof(int));
+        int *keys = malloc(sizeof(int) * n);
+        for (int i = 0; i < n; i++) {
+            keys[i] = 2 * i;
+        }
+        unsigned long long x = 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < q; i++) {
+            queries[i] = (int)(randU32(&x) % (2U * n));
+        }
+        EytzTree *eytz = newEytzTree(keys, NULL, n);
+        VebTree *veb = newVebTree(keys, NULL, n);
+
+        // 各方法命中的键求和，保证结果被使用，并互相校验
+        double t[5];
+        long long hits[5] = {0};
+        double start = wallSeconds();
+        for (int i = 0; i < q; i++) {
+            hits[0] += binarySearch(keys, n, queries[i]) >= 0;
+        }
+        t[0] = wallSeconds() - start;
+        start = wallSeconds();
+        for (int i = 0; i < q; i++) {
+            int r = nodeRankBranchless(keys, n, queries[i]);
+            hits[1] += r < n && keys[r] == queries[i];
+        }
+        t[1] = wallSeconds() - start;
+        start = wallSeconds();
+        for (int i = 0; i < q; i++) {
+            long long k = eytzLowerBound(eytz, queries[i]);
+            hits[2] += k > 0 && eytz->keys[k] == queries[i];
+        }
+        t[2] = wallSeconds() - start;
+        start = wallSeconds();
+        for (int i = 0; i < q; i++) {
+            long long k = eytzLowerBoundPlain(eytz, queries[i]);
+            hits[3] += k > 0 && eytz->keys[k] == queries[i];
+        }
+        t[3] = wallSeconds() - start;
+        start = wallSeconds();
+        for (int i = 0; i < q; i++) {
+            long long p = vebLowerBound(veb, queries[i]);
+            hits[4] += p >= 0 && veb->keys[p] == queries[i];
+        }
+        t[4] = wallSeconds() - start;
+        for (int i = 1; i < 5; i++) {
+            assert(hits[i] == hits[0]);
+        }
+
+        char label[16];
+        if (bytes < (1LL << 20)) {
+            snprintf(label, sizeof(label), "%lldKB", bytes >> 10);
+        } else if (bytes < (1LL << 30)) {
+            snprintf(label, sizeof(label), "%lldMB", bytes >> 20);
+        } else {
+            snprintf(label, sizeof(label), "%lldGB", bytes >> 30);
+        }
+        printf("%-10s", label);
+        for (int i = 0; i < 5; i++) {
+            printf(" %12.1f", t[i] * 1e9 / q);
+        }
+        printf("\n");
+        delEytzTree(eytz);
+        delVebTree(veb);
+        free(keys);
+    }
+    free(queries);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,329 @@
+/**
+ * @FileName    :parallel_tree.c
+ * @Date        :2026-10-20 12:14:50
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :基于 fork-join 的并行建树与并行归约
+ * @Description :二叉树的左右子树互不相交，构建或遍历左右子树的两个子问题可以并行执行（运行时见 utils/fork_join.h ）。
+ *               1. 由前序与中序遍历构建二叉树（buildTree）：与分治章节相同，前序的首元素为根，查询其在中序中的位置划分左右子树。
+ *                  原实现用按值开辟的数组记录中序位置（假设所有元素都小于 1000）。这里改为按位置索引：
+ *                  将前序与中序分别按值排序为 (值, 位置) 对（两次排序并行执行），逐一配对得到 inPos[i] ，
+ *                  即前序第 i 个元素在中序中的位置。内存为 O(n) ，与值域无关；元素重复或两序列不匹配时返回 NULL 。
+ *                  左右子树的节点数量都超过 grain 时 fork 左子树，否则在当前线程顺序构建（链状的树不会逐层 fork）。
+ *               2. 由层序数组构建二叉树（arrayToTree）：下标 i 的子树在数组中占用的位置数量可逐层计算，超过 grain 时 fork 。
+ *               3. 二叉树序列化为层序数组（treeToArray）：先并行归约出最大下标，再并行填充 INT_MAX 与各节点的值。
+ *               4. 并行归约：一次遍历同时求节点数量、节点值之和与高度。
+ *               已有的树不知道各子树的大小，遍历类操作改为在深度小于 forkDepth 的节点上 fork ，
+ *               共产生约 2^forkDepth 个任务，由工作窃取在线程之间平衡。
+ *               节点由 malloc 分配（glibc 为每个线程使用独立的分配区，并行分配不会互相阻塞），可用 freeMemoryTree 释放。
+ */
+
+#include "../utils/common.h"
+#include "../utils/fork_join.h"
+
+/* 由前序与中序遍历构建二叉树的参数 */
+typedef struct {
+    int *preorder;
+    int *inPos;    // inPos[i] 为 preorder[i] 在中序中的位置
+    int i, l, r;   // 子树的根在前序中的位置，子树在中序中的区间 [l, r]
+    int grain;
+    TreeNode *root; // 构建结果
+} BuildTreeArgs;
+
+/* 构建子树：分治，左右子树都较大时 fork 左子树 */
+void buildTreeTask(FjWorker *w, void *arg) {
+    BuildTreeArgs *a = arg;
+    if (a->r - a->l < 0) {
+        a->root = NULL;
+        return;
+    }
+    TreeNode *root = newTreeNode(a->preorder[a->i]);
+    int m = a->inPos[a->i];
+    BuildTreeArgs left = {a->preorder, a->inPos, a->i + 1, a->l, m - 1, a->grain, NULL};
+    BuildTreeArgs right = {a->preorder, a->inPos, a->i + 1 + m - a->l, m + 1, a->r, a->grain, NULL};
+    if (w != NULL && m - a->l > a->grain && a->r - m > a->grain) {
+        FjTask task;
+        fjFork(w, &task, buildTreeTask, &left);
+        buildTreeTask(w, &right);
+        fjJoin(w, &task);
+    } else {
+        buildTreeTask(w, &left);
+        buildTreeTask(w, &right);
+    }
+    root->left = left.root;
+    root->right = right.root;
+    a->root = root;
+}
+
+/* (值, 位置) 对 */
+typedef struct {
+    int val, pos;
+} ValuePos;
+
+/* 按值升序比较 */
+int cmpValuePos(const void *a, const void *b) {
+    int x = ((const ValuePos *)a)->val, y = ((const ValuePos *)b)->val;
+    return (x > y) - (x < y);
+}
+
+/* 排序前序与中序的 (值, 位置) 对的参数 */
+typedef struct {
+    ValuePos *pre, *in;
+    int size;
+} SortPairsArgs;
+
+/* 对中序的 (值, 位置) 对排序 */
+void sortInorderTask(FjWorker *w, void *arg) {
+    (void)w;
+    SortPairsArgs *a = arg;
+    qsort(a->in, a->size, sizeof(ValuePos), cmpValuePos);
+}
+
+/* 根任务：fork 中序的排序，当前线程排序前序 */
+void sortPairsTask(FjWorker *w, void *arg) {
+    SortPairsArgs *a = arg;
+    FjTask task;
+    fjFork(w, &task, sortInorderTask, a);
+    qsort(a->pre, a->size, sizeof(ValuePos), cmpValuePos);
+    fjJoin(w, &task);
+}
+
+/* 构建二叉树：pool 为 NULL 时顺序执行；元素须互不相同，且前序与中序为同一组元素，否则返回 NULL */
+TreeNode *buildTreeParallel(FjPool *pool, int *preorder, int *inorder, int size, int grain) {
+    if (size == 0) {
+        return NULL;
+    }
+    ValuePos *pre = malloc(sizeof(ValuePos) * size), *in = malloc(sizeof(ValuePos) * size);
+    int *inPos = malloc(sizeof(int) * size);
+    if (pre == NULL || in == NULL || inPos == NULL) {
+        printf("buildTreeParallel: out of memory!\n");
+        free(pre);
+        free(in);
+        free(inPos);
+        return NULL;
+    }
+    for (int i = 0; i < size; i++) {
+        pre[i] = (ValuePos){preorder[i], i};
+        in[i] = (ValuePos){inorder[i], i};
+    }
+    SortPairsArgs sortArgs = {pre, in, size};
+    if (pool != NULL) {
+        fjRun(pool, sortPairsTask, &sortArgs);
+    } else {
+        qsort(pre, size, sizeof(ValuePos), cmpValuePos);
+        qsort(in, size, sizeof(ValuePos), cmpValuePos);
+    }
+    // 排序后第 k 小的值在两个序列中一一对应
+    bool valid = true;
+    for (int k = 0; k < size && valid; k++) {
+        valid = pre[k].val == in[k].val && (k == 0 || in[k].val != in[k - 1].val);
+        inPos[pre[k].pos] = in[k].pos;
+    }
+    free(pre);
+    free(in);
+    if (!valid) {
+        printf("buildTreeParallel: preorder and inorder must be the same set of distinct values!\n");
+        free(inPos);
+        return NULL;
+    }
+    BuildTreeArgs args = {preorder, inPos, 0, 0, size - 1, grain, NULL};
+    if (pool != NULL) {
+        fjRun(pool, buildTreeTask, &args);
+    } else {
+        buildTreeTask(NULL, &args);
+    }
+    free(inPos);
+    return args.root;
+}
+
+/* 构建二叉树（顺序） */
+TreeNode *buildTree(int *preorder, int preorderSize, int *inorder, int inorderSize) {
+    assert(preorderSize == inorderSize);
+    return buildTreeParallel(NULL, preorder, inorder, inorderSize, inorderSize);
+}
+
+/* 由层序数组构建二叉树的参数 */
+typedef struct {
+    int *arr;
+    int size;
+    long long i;
+    int grain;
+    TreeNode *root;
+} ArrayToTreeArgs;
+
+/* 下标 i 的子树在长度为 size 的层序数组中占用的位置数量 */
+long long heapSubtreeSlots(long long i, long long size) {
+    long long slots = 0, first = i, width = 1;
+    while (first < size) {
+        slots += (first + width <= size ? width : size - first);
+        first = 2 * first + 1;
+        width *= 2;
+    }
+    return slots;
+}
+
+/* 构建下标 i 的子树，子树较大时 fork 左子树 */
+void arrayToTreeTask(FjWorker *w, void *arg) {
+    ArrayToTreeArgs *a = arg;
+    if (a->i >= a->size || a->arr[a->i] == INT_MAX) {
+        a->root = NULL;
+        return;
+    }
+    TreeNode *root = newTreeNode(a->arr[a->i]);
+    ArrayToTreeArgs left = {a->arr, a->size, 2 * a->i + 1, a->grain, NULL};
+    ArrayToTreeArgs right = {a->arr, a->size, 2 * a->i + 2, a->grain, NULL};
+    if (w != NULL && heapSubtreeSlots(a->i, a->size) > a->grain) {
+        FjTask task;
+        fjFork(w, &task, arrayToTreeTask, &left);
+        arrayToTreeTask(w, &right);
+        fjJoin(w, &task);
+    } else {
+        arrayToTreeTask(w, &left);
+        arrayToTreeTask(w, &right);
+    }
+    root->left = left.root;
+    root->right = right.root;
+    a->root = root;
+}
+
+/* 将层序数组反序列化为二叉树（并行）；pool 为 NULL 时顺序执行 */
+TreeNode *arrayToTreeParallel(FjPool *pool, int *arr, int size, int grain) {
+    ArrayToTreeArgs args = {arr, size, 0, grain, NULL};
+    if (pool != NULL) {
+        fjRun(pool, arrayToTreeTask, &args);
+    } else {
+        arrayToTreeTask(NULL, &args);
+    }
+    return args.root;
+}
+
+/* 归约结果 */
+typedef struct {
+    long long count;    // 节点数量
+    long long sum;      // 节点值之和
+    int height;         // 高度（空树为 -1 ，与 AVL 树的约定相同）
+    long long maxIndex; // 层序数组中的最大下标（空树为 -1）
+} TreeStats;
+
+/* 归约的参数 */
+typedef struct {
+    TreeNode *node;
+    long long index; // 节点在层序数组中的下标，超过 LLONG_MAX / 4 后不再有意义
+    int depth, forkDepth;
+    TreeStats stats;
+} TreeStatsArgs;
+
+/* 合并左右子树的归约结果 */
+TreeStats treeStatsMerge(TreeStats l, TreeStats r, TreeNode *node, long long index) {
+    TreeStats s;
+    s.count = l.count + r.count + 1;
+    s.sum = l.sum + r.sum + node->val;
+    s.height = (l.height > r.height ? l.height : r.height) + 1;
+    s.maxIndex = index;
+    s.maxIndex = l.maxIndex > s.maxIndex ? l.maxIndex : s.maxIndex;
+    s.maxIndex = r.maxIndex > s.maxIndex ? r.maxIndex : s.maxIndex;
+    return s;
+}
+
+/* 归约子树，深度小于 forkDepth 时 fork 左子树 */
+void treeStatsTask(FjWorker *w, void *arg) {
+    TreeStatsArgs *a = arg;
+    if (a->node == NULL) {
+        a->stats = (TreeStats){0, 0, -1, -1};
+        return;
+    }
+    long long index = a->index < LLONG_MAX / 4 ? a->index : LLONG_MAX / 4;
+    TreeStatsArgs left = {a->node->left, 2 * index + 1, a->depth + 1, a->forkDepth, {0}};
+    TreeStatsArgs right = {a->node->right, 2 * index + 2, a->depth + 1, a->forkDepth, {0}};
+    if (w != NULL && a->depth < a->forkDepth) {
+        FjTask task;
+        fjFork(w, &task, treeStatsTask, &left);
+        treeStatsTask(w, &right);
+        fjJoin(w, &task);
+    } else {
+        treeStatsTask(w, &left);
+        treeStatsTask(w, &right);
+    }
+    a->stats = treeStatsMerge(left.stats, right.stats, a->node, index);
+}
+
+/* 归约：节点数量、节点值之和、高度、层序数组中的最大下标；pool 为 NULL 时顺序执行 */
+TreeStats treeStatsParallel(FjPool *pool, TreeNode *root, int forkDepth) {
+    TreeStatsArgs args = {root, 0, 0, forkDepth, {0}};
+    if (pool != NULL) {
+        fjRun(pool, treeStatsTask, &args);
+    } else {
+        treeStatsTask(NULL, &args);
+    }
+    return args.stats;
+}
+
+/* 序列化的参数 */
+typedef struct {
+    TreeNode *node;
+    int *res;
+    long long index;
+    int depth, forkDepth;
+} TreeToArrayArgs;
+
+/* 将子树的节点值写入层序数组 */
+void treeToArrayTask(FjWorker *w, void *arg) {
+    TreeToArrayArgs *a = arg;
+    if (a->node == NULL) {
+        return;
+    }
+    a->res[a->index] = a->node->val;
+    TreeToArrayArgs left = {a->node->left, a->res, 2 * a->index + 1, a->depth + 1, a->forkDepth};
+    TreeToArrayArgs right = {a->node->right, a->res, 2 * a->index + 2, a->depth + 1, a->forkDepth};
+    if (w != NULL && a->depth < a->forkDepth) {
+        FjTask task;
+        fjFork(w, &task, treeToArrayTask, &left);
+        treeToArrayTask(w, &right);
+        fjJoin(w, &task);
+    } else {
+        treeToArrayTask(w, &left);
+        treeToArrayTask(w, &right);
+    }
+}
+
+/* 填充 INT_MAX */
+void fillIntMaxBody(long long lo, long long hi, void *arg) {
+    int *res = arg;
+    for (long long i = lo; i < hi; i++) {
+        res[i] = INT_MAX;
+    }
+}
+
+/* 序列化的根任务参数 */
+typedef struct {
+    FjForArgs fill;
+    TreeToArrayArgs write;
+} TreeToArrayRootArgs;
+
+/* 根任务：先并行填充空位，再并行写入节点值 */
+void treeToArrayRoot(FjWorker *w, void *arg) {
+    TreeToArrayRootArgs *a = arg;
+    fjParallelFor(w, &a->fill);
+    treeToArrayTask(w, &a->write);
+}
+
+/* 将二叉树序列化为层序数组（空位为 INT_MAX），数组长度写入 *size ；长度超过 INT_MAX 时返回 NULL ；
+   pool 为 NULL 时顺序执行 */
+int *treeToArrayParallel(FjPool *pool, TreeNode *root, int *size, int forkDepth) {
+    TreeStats stats = treeStatsParallel(pool, root, forkDepth);
+    if (stats.maxIndex >= INT_MAX) {
+        fprintf(stderr, "层序数组的长度超出范围（树高 %d）\n", stats.height);
+        *size = 0;
+        return NULL;
+    }
+    *size = (int)(stats.maxIndex + 1);
+    int *res = malloc(sizeof(int) * (*size > 0 ? *size : 1));
+    TreeToArrayRootArgs args = {{0, *size, 1 << 16, fillIntMaxBody, res}, {root, res, 0, 0, forkDepth}};
+    if (pool != NULL) {
+        fjRun(pool, treeToArrayRoot, &args);
+    } else {
+        fillIntMaxBody(0, *size, res);
+        treeToArrayTask(NULL, &args.write);
+    }
+    return res;
+}
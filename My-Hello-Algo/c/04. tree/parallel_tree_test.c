@@ -0,0 +1,317 @@
+/**
+ * @FileName    :parallel_tree_test.c
+ * @Date        :2026-10-20 12:52:09
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :并行建树与并行归约测试程序
+ * @Description :1. 基本测试：由前序与中序遍历构建二叉树，并行归约与序列化
+ *               2. 正确性：不同大小、线程数量与 grain（含 grain = 1 ，即每个节点都 fork）下，
+ *                  并行结果与顺序实现完全相同；fork-join 运行时的并行 for 与嵌套 fork 结果正确，
+ *                  嵌套深度超过队列容量的链式 fork 不会越界；链状的树可以并行构建；pool 为 NULL 时顺序执行；
+ *                  值域跨越整个 int 范围时可以建树，元素重复或前序与中序不匹配时返回 NULL 。
+ *               3. 性能：BENCH_NODES 个节点（默认 10^7 ，-DBENCH_NODES=100000000 可测试 10^8 个，需要约 6GB 内存），
+ *                  线程数量 1 ~ BENCH_MAX_THREADS（默认 32）时，层序数组建树、前序与中序建树、归约（数量 / 和 / 高度）、
+ *                  序列化的耗时与相对 1 个线程的加速比。
+ */
+
+#include "../utils/bench_util.h"
+#include "parallel_tree.c"
+
+#ifndef BENCH_NODES
+#define BENCH_NODES 10000000
+#endif
+
+#ifndef BENCH_MAX_THREADS
+#define BENCH_MAX_THREADS 32
+#endif
+
+// 建树的 grain 与遍历的 forkDepth
+#define BENCH_GRAIN 4096
+#define BENCH_FORK_DEPTH 12
+
+/* 判断两棵树的结构与节点值是否相同 */
+bool treeEqual(TreeNode *a, TreeNode *b) {
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    return a->val == b->val && treeEqual(a->left, b->left) && treeEqual(a->right, b->right);
+}
+
+/* 随机形状二叉树的前序遍历：中序遍历为 lo ~ hi - 1 ，随机选择根（期望高度 O(log n)） */
+int randomPreorder(unsigned long long *x, int lo, int hi, int *pre, int size) {
+    if (lo >= hi) {
+        return size;
+    }
+    int root = lo + (int)(randU32(x) % (hi - lo));
+    pre[size++] = root;
+    size = randomPreorder(x, lo, root, pre, size);
+    return randomPreorder(x, root + 1, hi, pre, size);
+}
+
+/* 顺序求高度 */
+int treeHeight(TreeNode *node) {
+    if (node == NULL) {
+        return -1;
+    }
+    int l = treeHeight(node->left), r = treeHeight(node->right);
+    return (l > r ? l : r) + 1;
+}
+
+/* 求和测试：并行 for 的一段 */
+void sumBody(long long lo, long long hi, void *arg) {
+    long long *sums = arg;
+    for (long long i = lo; i < hi; i++) {
+        sums[i] = i * i;
+    }
+}
+
+/* 斐波那契数（嵌套 fork 测试） */
+typedef struct {
+    int n;
+    long long res;
+} FibArgs;
+
+void fibTask(FjWorker *w, void *arg) {
+    FibArgs *a = arg;
+    if (a->n < 2) {
+        a->res = a->n;
+        return;
+    }
+    FibArgs l = {a->n - 1, 0}, r = {a->n - 2, 0};
+    FjTask task;
+    fjFork(w, &task, fibTask, &l);
+    fibTask(w, &r);
+    fjJoin(w, &task);
+    a->res = l.res + r.res;
+}
+
+/* 链式 fork ：每层 fork 一个子任务，嵌套深度为 n */
+typedef struct {
+    int n;
+    long long res;
+} ChainArgs;
+
+void chainTask(FjWorker *w, void *arg) {
+    ChainArgs *a = arg;
+    if (a->n == 0) {
+        a->res = 0;
+        return;
+    }
+    ChainArgs child = {a->n - 1, 0};
+    FjTask task;
+    fjFork(w, &task, chainTask, &child);
+    fjJoin(w, &task);
+    a->res = child.res + 1;
+}
+
+/* 基本测试 */
+void testBasic() {
+    int preorder[] = {3, 9, 2, 1, 7};
+    int inorder[] = {9, 3, 1, 2, 7};
+    printf("前序遍历 = ");
+    printArray(preorder, 5);
+    printf("中序遍历 = ");
+    printArray(inorder, 5);
+    FjPool *pool = newFjPool(4);
+    TreeNode *root = buildTreeParallel(pool, preorder, inorder, 5, 1);
+    printf("并行构建的二叉树为：\n");
+    printTree(root);
+    TreeStats stats = treeStatsParallel(pool, root, 4);
+    printf("节点数量 %lld ，节点值之和 %lld ，高度 %d\n", stats.count, stats.sum, stats.height);
+    assert(stats.count == 5 && stats.sum == 22 && stats.height == 2);
+    int size;
+    int *arr = treeToArrayParallel(pool, root, &size, 4);
+    printf("层序数组（INT_MAX 表示空位）= ");
+    printArray(arr, size);
+    TreeNode *copy = arrayToTreeParallel(pool, arr, size, 1);
+    assert(treeEqual(root, copy));
+    free(arr);
+    freeMemoryTree(root);
+    freeMemoryTree(copy);
+    delFjPool(pool);
+}
+
+/* 正确性 */
+void testValidate() {
+    int sizes[] = {0, 1, 2, 3, 10, 100, 1000, 30000};
+    int threads[] = {1, 2, 3, 8};
+    int grains[] = {1, 7, 1000};
+    unsigned long long x = 2026;
+    int cases = 0;
+    int *pre = malloc(sizeof(int) * 30000), *in = malloc(sizeof(int) * 30000);
+    for (int t = 0; t < 4; t++) {
+        FjPool *pool = newFjPool(threads[t]);
+
+        /* 运行时本身：并行 for 与嵌套 fork */
+        long long *sums = malloc(sizeof(long long) * 100000);
+        FjForArgs forArgs = {0, 100000, 100, sumBody, sums};
+        fjRun(pool, fjParallelFor, &forArgs);
+        for (long long i = 0; i < 100000; i++) {
+            assert(sums[i] == i * i);
+        }
+        free(sums);
+        FibArgs fib = {20, 0};
+        fjRun(pool, fibTask, &fib);
+        assert(fib.res == 6765);
+        ChainArgs chain = {3 * FJ_DEQUE_SIZE, 0};
+        fjRun(pool, chainTask, &chain);
+        assert(chain.res == 3 * FJ_DEQUE_SIZE);
+
+        /* 右链：前序与中序均为 1 ~ 6000 */
+        for (int i = 0; i < 6000; i++) {
+            pre[i] = in[i] = i + 1;
+        }
+        TreeNode *chainTree = buildTreeParallel(pool, pre, in, 6000, 1000);
+        TreeStats chainStats = treeStatsParallel(pool, chainTree, 6);
+        assert(chainStats.count == 6000 && chainStats.height == 5999);
+        freeMemoryTree(chainTree);
+
+        /* 值域跨越整个 int 范围；重复元素或前序与中序不匹配时返回 NULL */
+        int widePre[] = {0, INT_MIN, INT_MAX}, wideIn[] = {INT_MIN, 0, INT_MAX};
+        TreeNode *wide = buildTreeParallel(pool, widePre, wideIn, 3, 1);
+        assert(wide != NULL && wide->val == 0 && wide->left->val == INT_MIN && wide->right->val == INT_MAX);
+        freeMemoryTree(wide);
+        int dupPre[] = {1, 1, 2}, dupIn[] = {1, 1, 2}, otherIn[] = {1, 2, 3};
+        assert(buildTreeParallel(pool, dupPre, dupIn, 3, 1) == NULL);
+        assert(buildTreeParallel(pool, widePre, otherIn, 3, 1) == NULL);
+
+        for (int s = 0; s < 8; s++) {
+            int n = sizes[s];
+            // 中序为 offset ~ offset + n - 1 ，含负数
+            int offset = -(int)(randU32(&x) % 1000);
+            randomPreorder(&x, 0, n, pre, 0);
+            for (int i = 0; i < n; i++) {
+                pre[i] += offset;
+                in[i] = offset + i;
+            }
+            TreeNode *expect = buildTree(pre, n, in, n);
+            TreeStats seq = treeStatsParallel(NULL, expect, 0);
+            assert(seq.count == n && seq.height == treeHeight(expect));
+            for (int g = 0; g < 3; g++) {
+                TreeNode *root = buildTreeParallel(pool, pre, in, n, grains[g]);
+                assert(treeEqual(root, expect));
+                TreeStats par = treeStatsParallel(pool, root, grains[g] == 1 ? 64 : 6);
+                assert(par.count == seq.count && par.sum == seq.sum && par.height == seq.height &&
+                       par.maxIndex == seq.maxIndex);
+                freeMemoryTree(root);
+                cases++;
+            }
+            freeMemoryTree(expect);
+
+            /* 层序数组与二叉树互相转换：完全二叉树（去掉部分节点） */
+            int *arr = malloc(sizeof(int) * (n > 0 ? n : 1));
+            for (int i = 0; i < n; i++) {
+                arr[i] = i > 0 && randU32(&x) % 10 == 0 ? INT_MAX : i;
+            }
+            expect = arrayToTree(arr, n);
+            for (int g = 0; g < 3; g++) {
+                TreeNode *root = arrayToTreeParallel(pool, arr, n, grains[g]);
+                assert(treeEqual(root, expect));
+                int size;
+                int *res = treeToArrayParallel(pool, root, &size, grains[g] == 1 ? 64 : 6);
+                // 空位之下的元素不在树中，序列化后也是空位；其余位置的值即为下标
+                assert(size <= n);
+                for (int i = 0; i < size; i++) {
+                    assert(res[i] == INT_MAX || res[i] == i);
+                }
+                TreeNode *back = arrayToTree(res, size);
+                assert(treeEqual(back, root));
+                freeMemoryTree(back);
+                free(res);
+                // pool 为 NULL 时顺序执行
+                res = treeToArrayParallel(NULL, root, &size, 0);
+                back = arrayToTreeParallel(NULL, res, size, grains[g]);
+                assert(treeEqual(back, root));
+                freeMemoryTree(back);
+                free(res);
+                freeMemoryTree(root);
+                cases++;
+            }
+            freeMemoryTree(expect);
+            free(arr);
+        }
+        delFjPool(pool);
+    }
+    printf("%d 组并行建树、归约与序列化的结果与顺序实现相同\n", cases);
+    free(pre);
+    free(in);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_NODES;
+    int *arr = malloc(sizeof(int) * n), *pre = malloc(sizeof(int) * n), *in = malloc(sizeof(int) * n);
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < n; i++) {
+        arr[i] = i;
+        in[i] = i;
+    }
+    randomPreorder(&x, 0, n, pre, 0);
+    printf("%d 个节点，建树 grain = %d ，遍历 forkDepth = %d\n", n, BENCH_GRAIN, BENCH_FORK_DEPTH);
+
+    /* 顺序实现 */
+    double start = wallSeconds();
+    TreeNode *root = arrayToTree(arr, n);
+    double tArray = wallSeconds() - start;
+    freeMemoryTree(root);
+    start = wallSeconds();
+    root = buildTree(pre, n, in, n);
+    double tBuild = wallSeconds() - start;
+    start = wallSeconds();
+    TreeStats seq = treeStatsParallel(NULL, root, 0);
+    double tStats = wallSeconds() - start;
+    freeMemoryTree(root);
+    printf("顺序实现：层序数组建树 %.3f s ，前序与中序建树 %.3f s（高度 %d），归约 %.3f s\n", tArray, tBuild,
+           seq.height, tStats);
+
+    printf("%-8s %18s %18s %18s %18s %8s\n", "线程数", "层序建树 s (加速)", "前中序建树 s (加速)", "归约 s (加速)",
+           "序列化 s (加速)", "窃取");
+    double base[4];
+    for (int threadNum = 1; threadNum <= BENCH_MAX_THREADS; threadNum *= 2) {
+        FjPool *pool = newFjPool(threadNum);
+        double t[4];
+        start = wallSeconds();
+        TreeNode *complete = arrayToTreeParallel(pool, arr, n, BENCH_GRAIN);
+        t[0] = wallSeconds() - start;
+        start = wallSeconds();
+        root = buildTreeParallel(pool, pre, in, n, BENCH_GRAIN);
+        t[1] = wallSeconds() - start;
+        start = wallSeconds();
+        TreeStats stats = treeStatsParallel(pool, root, BENCH_FORK_DEPTH);
+        t[2] = wallSeconds() - start;
+        assert(stats.count == n && stats.sum == seq.sum && stats.height == seq.height);
+        int size;
+        start = wallSeconds();
+        int *res = treeToArrayParallel(pool, complete, &size, BENCH_FORK_DEPTH);
+        t[3] = wallSeconds() - start;
+        assert(size == n && res[n - 1] == n - 1);
+        free(res);
+        freeMemoryTree(complete);
+        freeMemoryTree(root);
+
+        long long steals = 0;
+        for (int i = 0; i < threadNum; i++) {
+            steals += pool->workers[i].steals;
+        }
+        delFjPool(pool);
+        printf("%-8d", threadNum);
+        for (int k = 0; k < 4; k++) {
+            if (threadNum == 1) {
+                base[k] = t[k];
+            }
+            printf("   %8.3f (%5.2fx)", t[k], base[k] / t[k]);
+        }
+        printf(" %8lld\n", steals);
+    }
+    free(arr);
+    free(pre);
+    free(in);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,333 @@
+/**
+ * @FileName    :succinct_tree.c
+ * @Date        :2026-10-20 13:36:22
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :二叉树的简洁（succinct）序列化：层序位图（二叉树的 LOUDS）
+ * @Description :arrayToTree / treeToArray 使用的层序数组按完全二叉树编号，空位填 INT_MAX ，
+ *               高度为 h 的树需要长度 2^h - 1 的数组，退化为链表时无法存放。这里只为实际存在的节点编号：
+ *               1. 按层序给 n 个节点编号 0 ~ n - 1 ，节点 k 用位图中的两位 B[2k] 、B[2k + 1] 表示是否有左 / 右子节点，
+ *                  共 2n 位；节点值按同样的顺序存放在 vals 中。
+ *               2. 导航：位图中每个 1 按出现顺序对应编号 1 ~ n - 1 的节点（根节点不对应任何位），因此
+ *                  左子节点 = rank1(2k) + 1 ，右子节点 = rank1(2k + 1) + 1 （rank1(p) 为位图前 p 位中 1 的数量），
+ *                  父节点 = select1(j) / 2 （select1(j) 为第 j 个 1 的位置）。
+ *               3. 秩目录：每 512 位记录一次之前 1 的数量（32 位整数，额外约 6% 的位图空间），
+ *                  rank1 为一次查表加至多 8 次 popcount ；select1 在目录上二分查找后在块内扫描。
+ *               4. 文件格式：文件头、位图、秩目录、节点值依次存放，均按 8 字节对齐，与内存中的布局完全相同，
+ *                  因此可以用 mmap 直接映射文件并在其上查询，无需重建指针；也可以一次性重建为 TreeNode 结构。
+ *                  打开时扫描一遍位图（O(n)）校验秩目录与树的结构，损坏的文件在查询或重建前即被拒绝。
+ */
+
+#include "binary_tree_iter.c"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 文件头的标识
+#define SUCCINCT_MAGIC "SUCCTREE"
+// 秩目录每一项覆盖的 64 位字数量（512 位）
+#define SUCCINCT_BLOCK_WORDS 8
+
+/* 文件头 */
+typedef struct {
+    char magic[8];
+    unsigned long long n;      // 节点数量
+    unsigned long long words;  // 位图的 64 位字数量
+    unsigned long long blocks; // 秩目录的项数
+} SuccinctHeader;
+
+/* 简洁二叉树（只读） */
+typedef struct {
+    long long n;
+    const unsigned long long *bits; // 位图
+    const unsigned int *ranks;      // 秩目录：ranks[b] 为前 512b 位中 1 的数量
+    const int *vals;                // 节点值（层序）
+    void *image;                    // 与文件格式相同的完整数据
+    size_t imageSize;
+    bool mapped;                    // image 是否为 mmap 的映射
+} SuccinctTree;
+
+/* 各部分的字节数（向上对齐到 8 字节） */
+size_t succinctAlign8(size_t bytes) {
+    return (bytes + 7) / 8 * 8;
+}
+
+/* 按节点数量计算各部分的大小，返回总字节数 */
+size_t succinctLayout(unsigned long long n, SuccinctHeader *h) {
+    memcpy(h->magic, SUCCINCT_MAGIC, 8);
+    h->n = n;
+    h->words = (2 * n + 63) / 64;
+    // 每个块一项，最后再加一项记录 1 的总数
+    h->blocks = (h->words + SUCCINCT_BLOCK_WORDS - 1) / SUCCINCT_BLOCK_WORDS + 1;
+    return sizeof(SuccinctHeader) + h->words * 8 + succinctAlign8(h->blocks * 4) + succinctAlign8(n * 4);
+}
+
+/* 将各数组指向 image 中对应的位置 */
+void succinctAttach(SuccinctTree *t, void *image, size_t imageSize) {
+    SuccinctHeader *h = image;
+    char *p = (char *)image + sizeof(SuccinctHeader);
+    t->n = (long long)h->n;
+    t->bits = (const unsigned long long *)p;
+    p += h->words * 8;
+    t->ranks = (const unsigned int *)p;
+    p += succinctAlign8(h->blocks * 4);
+    t->vals = (const int *)p;
+    t->image = image;
+    t->imageSize = imageSize;
+}
+
+/* 由二叉树构建（在内存中） */
+SuccinctTree *newSuccinctTree(TreeNode *root) {
+    // 第一遍：统计节点数量
+    unsigned long long n = 0;
+    TreeIter it;
+    treeIterInit(&it, root, TREE_PRE_ORDER);
+    while (treeIterNext(&it) != NULL) {
+        n++;
+    }
+    treeIterFree(&it);
+
+    SuccinctHeader h;
+    size_t size = succinctLayout(n, &h);
+    void *image = calloc(1, size);
+    memcpy(image, &h, sizeof(h));
+    SuccinctTree *t = malloc(sizeof(SuccinctTree));
+    t->mapped = false;
+    succinctAttach(t, image, size);
+    unsigned long long *bits = (unsigned long long *)t->bits;
+    unsigned int *ranks = (unsigned int *)t->ranks;
+    int *vals = (int *)t->vals;
+
+    // 第二遍：层序写入位图与节点值
+    treeIterInit(&it, root, TREE_LEVEL_ORDER);
+    long long k = 0;
+    for (TreeNode *node = treeIterNext(&it); node != NULL; node = treeIterNext(&it), k++) {
+        vals[k] = node->val;
+        if (node->left != NULL) {
+            bits[(2 * k) >> 6] |= 1ULL << ((2 * k) & 63);
+        }
+        if (node->right != NULL) {
+            bits[(2 * k + 1) >> 6] |= 1ULL << ((2 * k + 1) & 63);
+        }
+    }
+    treeIterFree(&it);
+
+    // 秩目录
+    unsigned int ones = 0;
+    for (unsigned long long w = 0; w < h.words; w++) {
+        if (w % SUCCINCT_BLOCK_WORDS == 0) {
+            ranks[w / SUCCINCT_BLOCK_WORDS] = ones;
+        }
+        ones += __builtin_popcountll(bits[w]);
+    }
+    ranks[h.blocks - 1] = ones;
+    return t;
+}
+
+/* 析构函数 */
+void delSuccinctTree(SuccinctTree *t) {
+#ifndef _WIN32
+    if (t->mapped) {
+        munmap(t->image, t->imageSize);
+        free(t);
+        return;
+    }
+#endif
+    free(t->image);
+    free(t);
+}
+
+/* 保存到文件，返回是否成功 */
+bool succinctSave(const SuccinctTree *t, const char *path) {
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL) {
+        fprintf(stderr, "无法写入文件 %s\n", path);
+        return false;
+    }
+    bool ok = fwrite(t->image, 1, t->imageSize, fp) == t->imageSize;
+    ok &= fclose(fp) == 0;
+    return ok;
+}
+
+/* 检查文件：文件头与文件大小一致，秩目录与位图一致，且位图描述的是一棵合法的二叉树
+   （1 的总数为 n - 1 ，每个节点的父节点编号小于自身），否则查询会越界、重建会越界或成环 */
+bool succinctCheck(const void *image, size_t size) {
+    SuccinctHeader expect;
+    if (size < sizeof(SuccinctHeader) || memcmp(image, SUCCINCT_MAGIC, 8) != 0) {
+        return false;
+    }
+    const SuccinctHeader *h = image;
+    // 每个节点至少占 4 字节，先限制 n 以免计算布局时溢出
+    if (h->n > size / 4 || succinctLayout(h->n, &expect) != size || expect.words != h->words ||
+        expect.blocks != h->blocks) {
+        return false;
+    }
+    const unsigned long long *bits = (const unsigned long long *)((const char *)image + sizeof(SuccinctHeader));
+    const unsigned int *ranks = (const unsigned int *)(bits + h->words);
+    unsigned long long ones = 0;
+    for (unsigned long long w = 0; w < h->words; w++) {
+        if (w % SUCCINCT_BLOCK_WORDS == 0 && ranks[w / SUCCINCT_BLOCK_WORDS] != ones) {
+            return false;
+        }
+        unsigned long long word = bits[w];
+        // 最后一个字中第 2n 位之后的填充位须为 0
+        unsigned long long valid = 2 * h->n - 64 * w;
+        if (valid < 64 && (word >> valid) != 0) {
+            return false;
+        }
+        // 节点 k（k >= 1）对应第 k 个 1 ，父节点 select1(k) / 2 < k 等价于 rank1(2k) >= k
+        for (int i = 0; i < 64; i += 2) {
+            unsigned long long k = 32 * w + i / 2;
+            if (k >= 1 && k < h->n && ones + __builtin_popcountll(word & ((1ULL << i) - 1)) < k) {
+                return false;
+            }
+        }
+        ones += __builtin_popcountll(word);
+    }
+    return ranks[h->blocks - 1] == ones && ones == (h->n > 0 ? h->n - 1 : 0);
+}
+
+/* 打开文件：直接映射到内存（Windows 下读入内存），格式错误时返回 NULL */
+SuccinctTree *succinctOpen(const char *path) {
+    SuccinctTree *t = malloc(sizeof(SuccinctTree));
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+        fprintf(stderr, "无法打开文件 %s\n", path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        free(t);
+        return NULL;
+    }
+    void *image = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // 映射建立后即可关闭文件描述符
+    close(fd);
+    if (image == MAP_FAILED) {
+        fprintf(stderr, "无法映射文件 %s\n", path);
+        free(t);
+        return NULL;
+    }
+    size_t size = st.st_size;
+    t->mapped = true;
+#else
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) {
+        fprintf(stderr, "无法打开文件 %s\n", path);
+        free(t);
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    size_t size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    void *image = malloc(size > 0 ? size : 1);
+    size = fread(image, 1, size, fp);
+    fclose(fp);
+    t->mapped = false;
+#endif
+    t->image = image;
+    t->imageSize = size;
+    if (!succinctCheck(image, size)) {
+        fprintf(stderr, "文件 %s 不是有效的简洁二叉树\n", path);
+        delSuccinctTree(t);
+        return NULL;
+    }
+    succinctAttach(t, image, size);
+    return t;
+}
+
+/* 位图的第 p 位 */
+bool succinctBit(const SuccinctTree *t, long long p) {
+    return (t->bits[p >> 6] >> (p & 63)) & 1;
+}
+
+/* 位图前 p 位中 1 的数量 */
+long long succinctRank1(const SuccinctTree *t, long long p) {
+    long long w = p >> 6, b = w / SUCCINCT_BLOCK_WORDS;
+    long long ones = t->ranks[b];
+    for (long long i = b * SUCCINCT_BLOCK_WORDS; i < w; i++) {
+        ones += __builtin_popcountll(t->bits[i]);
+    }
+    if (p & 63) {
+        ones += __builtin_popcountll(t->bits[w] & ((1ULL << (p & 63)) - 1));
+    }
+    return ones;
+}
+
+/* 第 j 个 1 的位置（j 从 1 开始） */
+long long succinctSelect1(const SuccinctTree *t, long long j) {
+    // 二分查找最后一个 ranks[b] < j 的块
+    long long words = (t->n * 2 + 63) / 64;
+    long long lo = 0, hi = (words + SUCCINCT_BLOCK_WORDS - 1) / SUCCINCT_BLOCK_WORDS - 1;
+    while (lo < hi) {
+        long long mid = (lo + hi + 1) / 2;
+        if (t->ranks[mid] < j) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    long long remain = j - t->ranks[lo], w = lo * SUCCINCT_BLOCK_WORDS;
+    for (;;) {
+        int c = __builtin_popcountll(t->bits[w]);
+        if (c >= remain) {
+            break;
+        }
+        remain -= c;
+        w++;
+    }
+    unsigned long long word = t->bits[w];
+    for (long long i = 1; i < remain; i++) {
+        word &= word - 1; // 去掉最低位的 1
+    }
+    return w * 64 + __builtin_ctzll(word);
+}
+
+/* 左子节点的编号，不存在时返回 -1 */
+long long succinctLeft(const SuccinctTree *t, long long k) {
+    return succinctBit(t, 2 * k) ? succinctRank1(t, 2 * k) + 1 : -1;
+}
+
+/* 右子节点的编号，不存在时返回 -1 */
+long long succinctRight(const SuccinctTree *t, long long k) {
+    return succinctBit(t, 2 * k + 1) ? succinctRank1(t, 2 * k + 1) + 1 : -1;
+}
+
+/* 父节点的编号，根节点返回 -1 */
+long long succinctParent(const SuccinctTree *t, long long k) {
+    return k == 0 ? -1 : succinctSelect1(t, k) / 2;
+}
+
+/* 将树视为二叉搜索树查找 val ，返回节点编号，不存在时返回 -1 */
+long long succinctSearch(const SuccinctTree *t, int val) {
+    long long k = t->n > 0 ? 0 : -1;
+    while (k >= 0 && t->vals[k] != val) {
+        k = val < t->vals[k] ? succinctLeft(t, k) : succinctRight(t, k);
+    }
+    return k;
+}
+
+/* 重建为 TreeNode 结构（pool 为 NULL 时逐个 malloc） */
+TreeNode *succinctToTree(const SuccinctTree *t, TreeNodePool *pool) {
+    if (t->n == 0) {
+        return NULL;
+    }
+    TreeNode **nodes = malloc(sizeof(TreeNode *) * t->n);
+    for (long long k = 0; k < t->n; k++) {
+        nodes[k] = treeNodeAlloc(pool, t->vals[k]);
+    }
+    // 子节点按层序依次出现，无需 rank
+    long long child = 1;
+    for (long long k = 0; k < t->n; k++) {
+        nodes[k]->left = succinctBit(t, 2 * k) ? nodes[child++] : NULL;
+        nodes[k]->right = succinctBit(t, 2 * k + 1) ? nodes[child++] : NULL;
+    }
+    TreeNode *root = nodes[0];
+    free(nodes);
+    return root;
+}
@@ -0,0 +1,413 @@
+/**
+ * @FileName    :succinct_tree_test.c
+ * @Date        :2026-10-20 14:08:51
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :二叉树简洁序列化测试程序
+ * @Description :1. 基本测试：打印示例二叉树的位图、导航与查找，保存后映射回来
+ *               2. 正确性：空树、单节点、链、之字形链、完全二叉树与随机二叉搜索树（含位图跨越秩目录块边界的大小）上，
+ *                  rank / select 与逐位计数一致，左 / 右 / 父节点与指针结构一致，经文件往返后重建的树与原树相同，
+ *                  损坏或截断的文件，以及文件头正确但位图、秩目录损坏或位图不构成合法树的文件均被拒绝。
+ *               3. 性能：BENCH_NODES 个节点（默认 10^7）的平衡二叉搜索树、随机二叉搜索树与右链上，
+ *                  层序数组（INT_MAX 填充）与简洁格式的大小，保存（构建 + 写文件）、打开（mmap）、重建指针的耗时，
+ *                  以及 BENCH_QUERIES 次查找直接在映射文件上与在指针结构上的平均耗时。
+ */
+
+#include "../utils/bench_util.h"
+#include "succinct_tree.c"
+
+#ifndef BENCH_NODES
+#define BENCH_NODES 10000000
+#endif
+
+#ifndef BENCH_QUERIES
+#define BENCH_QUERIES 1000000
+#endif
+
+// 测试使用的临时文件
+#define SUCCINCT_TEST_PATH "succinct_tree_test.bin"
+
+/* 判断两棵树的结构与节点值是否相同（迭代，链状的树也不会栈溢出） */
+bool treeEqual(TreeNode *a, TreeNode *b) {
+    TreeIter ia, ib;
+    treeIterInit(&ia, a, TREE_PRE_ORDER);
+    treeIterInit(&ib, b, TREE_PRE_ORDER);
+    bool equal = true;
+    for (;;) {
+        TreeNode *na = treeIterNext(&ia), *nb = treeIterNext(&ib);
+        if (na == NULL || nb == NULL) {
+            equal = na == nb;
+            break;
+        }
+        if (na->val != nb->val || (na->left == NULL) != (nb->left == NULL) ||
+            (na->right == NULL) != (nb->right == NULL)) {
+            equal = false;
+            break;
+        }
+    }
+    treeIterFree(&ia);
+    treeIterFree(&ib);
+    return equal;
+}
+
+/* 值为 lo ~ hi - 1 的随机二叉搜索树（随机选择根） */
+TreeNode *randomBST(TreeNodePool *pool, unsigned long long *x, int lo, int hi) {
+    if (lo >= hi) {
+        return NULL;
+    }
+    int mid = lo + (int)(randU32(x) % (hi - lo));
+    TreeNode *node = treeNodeAlloc(pool, mid);
+    node->left = randomBST(pool, x, lo, mid);
+    node->right = randomBST(pool, x, mid + 1, hi);
+    return node;
+}
+
+/* 值为 lo ~ hi - 1 的平衡二叉搜索树 */
+TreeNode *balancedBST(TreeNodePool *pool, int lo, int hi) {
+    if (lo >= hi) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    TreeNode *node = treeNodeAlloc(pool, mid);
+    node->left = balancedBST(pool, lo, mid);
+    node->right = balancedBST(pool, mid + 1, hi);
+    return node;
+}
+
+/* 链：0 为右链（值递增，也是二叉搜索树），1 为之字形链 */
+TreeNode *chainTree(TreeNodePool *pool, int n, int zigzag) {
+    TreeNode *root = NULL;
+    for (int i = n - 1; i >= 0; i--) {
+        TreeNode *node = treeNodeAlloc(pool, i);
+        node->left = NULL;
+        node->right = NULL;
+        if (zigzag && i % 2 == 0) {
+            node->left = root;
+        } else {
+            node->right = root;
+        }
+        root = node;
+    }
+    return root;
+}
+
+/* 在指针结构上查找 */
+TreeNode *bstFind(TreeNode *node, int val) {
+    while (node != NULL && node->val != val) {
+        node = val < node->val ? node->left : node->right;
+    }
+    return node;
+}
+
+/* 层序数组表示的最大下标（double ，溢出时为无穷大）与树高 */
+double heapMaxIndex(TreeNode *root, int *height) {
+    double maxIndex = -1;
+    *height = -1;
+    if (root == NULL) {
+        return maxIndex;
+    }
+    long long cap = 64, top = 0;
+    TreeNode **nodes = malloc(sizeof(TreeNode *) * cap);
+    double *index = malloc(sizeof(double) * cap);
+    int *depth = malloc(sizeof(int) * cap);
+    nodes[top] = root, index[top] = 0, depth[top++] = 0;
+    while (top > 0) {
+        top--;
+        TreeNode *node = nodes[top];
+        double i = index[top];
+        int d = depth[top];
+        maxIndex = i > maxIndex ? i : maxIndex;
+        *height = d > *height ? d : *height;
+        if (top + 2 > cap) {
+            cap *= 2;
+            nodes = realloc(nodes, sizeof(TreeNode *) * cap);
+            index = realloc(index, sizeof(double) * cap);
+            depth = realloc(depth, sizeof(int) * cap);
+        }
+        if (node->left != NULL) {
+            nodes[top] = node->left, index[top] = 2 * i + 1, depth[top++] = d + 1;
+        }
+        if (node->right != NULL) {
+            nodes[top] = node->right, index[top] = 2 * i + 2, depth[top++] = d + 1;
+        }
+    }
+    free(nodes);
+    free(index);
+    free(depth);
+    return maxIndex;
+}
+
+/* 格式化字节数 */
+void formatBytes(double bytes, int height, char *buf, int size) {
+    const char *units[] = {"B", "KB", "MB", "GB", "TB", "PB", "EB"};
+    int u = 0;
+    if (isinf(bytes) || bytes > 1e20) {
+        // 右链的层序数组长度约为 2^(h+1)
+        snprintf(buf, size, "约 2^%d B", height + 3);
+        return;
+    }
+    while (bytes >= 1024 && u < 6) {
+        bytes /= 1024;
+        u++;
+    }
+    snprintf(buf, size, "%.1f %s", bytes, units[u]);
+}
+
+/* 将（修改过的）文件内容写入文件后打开，返回是否被拒绝 */
+bool imageRejected(const void *image, size_t size) {
+    FILE *fp = fopen(SUCCINCT_TEST_PATH, "wb");
+    fwrite(image, 1, size, fp);
+    fclose(fp);
+    SuccinctTree *t = succinctOpen(SUCCINCT_TEST_PATH);
+    if (t == NULL) {
+        return true;
+    }
+    delSuccinctTree(t);
+    return false;
+}
+
+/* 文件头正确、内容损坏的文件：n 个节点的右链，只修改位图或秩目录 */
+void testCorruptBody(int n) {
+    TreeNodePool *pool = newTreeNodePool();
+    SuccinctTree *t = newSuccinctTree(chainTree(pool, n, 0));
+    unsigned char *image = malloc(t->imageSize);
+    unsigned long long *bits = (unsigned long long *)(image + sizeof(SuccinctHeader));
+    unsigned int *ranks = (unsigned int *)(image + ((const char *)t->ranks - (const char *)t->image));
+    long long blocks = ((SuccinctHeader *)t->image)->blocks;
+
+    memcpy(image, t->image, t->imageSize);
+    assert(!imageRejected(image, t->imageSize));
+    // 多出一个 1 ：子节点数量超过 n - 1
+    bits[(2 * n - 2) >> 6] |= 1ULL << ((2 * n - 2) & 63);
+    assert(imageRejected(image, t->imageSize));
+    // 秩目录与位图不一致
+    memcpy(image, t->image, t->imageSize);
+    ranks[blocks - 1]++;
+    assert(imageRejected(image, t->imageSize));
+    memcpy(image, t->image, t->imageSize);
+    ranks[blocks > 2 ? 1 : 0]++;
+    assert(imageRejected(image, t->imageSize));
+    // 第 2n 位之后的填充位不为 0
+    if ((2 * n) % 64 != 0) {
+        memcpy(image, t->image, t->imageSize);
+        bits[(2 * n) >> 6] |= 1ULL << ((2 * n) & 63);
+        assert(imageRejected(image, t->imageSize));
+    }
+    // 1 的数量与秩目录都正确，但根的右子节点移到最后一个节点的左侧：节点 1 的父节点不在它之前
+    if (n >= 2 && 2 * n <= 64 * SUCCINCT_BLOCK_WORDS) {
+        memcpy(image, t->image, t->imageSize);
+        bits[0] &= ~2ULL;
+        bits[(2 * n - 2) >> 6] |= 1ULL << ((2 * n - 2) & 63);
+        assert(imageRejected(image, t->imageSize));
+    }
+    free(image);
+    delSuccinctTree(t);
+    delTreeNodePool(pool);
+}
+
+/* 基本测试 */
+void testBasic() {
+    int nums[] = {1, 2, 3, 4, INT_MAX, 6, 7, 8, 9, INT_MAX, INT_MAX, 12, INT_MAX, INT_MAX, 15};
+    TreeNode *root = arrayToTree(nums, sizeof(nums) / sizeof(int));
+    printf("初始化二叉树\n");
+    printTree(root);
+    SuccinctTree *t = newSuccinctTree(root);
+    printf("层序节点值 = ");
+    printArray((int *)t->vals, (int)t->n);
+    printf("位图（每个节点两位：有左子节点 / 有右子节点）= ");
+    for (long long p = 0; p < 2 * t->n; p++) {
+        printf("%d%s", succinctBit(t, p), p % 2 == 1 ? " " : "");
+    }
+    printf("\n");
+    for (long long k = 0; k < t->n; k++) {
+        long long l = succinctLeft(t, k), r = succinctRight(t, k), p = succinctParent(t, k);
+        printf("节点 %2d ：左 %2d ，右 %2d ，父 %2d\n", t->vals[k], l >= 0 ? t->vals[l] : -1,
+               r >= 0 ? t->vals[r] : -1, p >= 0 ? t->vals[p] : -1);
+    }
+    assert(succinctSave(t, SUCCINCT_TEST_PATH));
+    SuccinctTree *mapped = succinctOpen(SUCCINCT_TEST_PATH);
+    TreeNode *copy = succinctToTree(mapped, NULL);
+    printf("%lld 个节点保存为 %zu 字节（层序数组需要 %zu 字节），映射后重建的二叉树：\n", t->n, mapped->imageSize,
+           sizeof(nums));
+    printTree(copy);
+    assert(treeEqual(root, copy));
+    delSuccinctTree(t);
+    delSuccinctTree(mapped);
+    freeMemoryTree(root);
+    freeMemoryTree(copy);
+    remove(SUCCINCT_TEST_PATH);
+}
+
+/* 正确性 */
+void testValidate() {
+    int sizes[] = {0, 1, 2, 3, 31, 32, 33, 255, 256, 257, 1000, 4096, 5000};
+    unsigned long long x = 2026;
+    int cases = 0;
+    for (int shape = 0; shape < 4; shape++) {
+        for (int s = 0; s < 13; s++) {
+            int n = sizes[s];
+            TreeNodePool *pool = newTreeNodePool();
+            TreeNode *root;
+            if (shape == 0) {
+                root = chainTree(pool, n, 0);
+            } else if (shape == 1) {
+                root = chainTree(pool, n, 1);
+            } else if (shape == 2) {
+                root = balancedBST(pool, 0, n);
+            } else {
+                root = randomBST(pool, &x, 0, n);
+            }
+            SuccinctTree *t = newSuccinctTree(root);
+            assert(t->n == n);
+
+            /* rank / select 与逐位计数一致 */
+            long long ones = 0;
+            for (long long p = 0; p < 2 * t->n; p++) {
+                assert(succinctRank1(t, p) == ones);
+                if (succinctBit(t, p)) {
+                    ones++;
+                    assert(succinctSelect1(t, ones) == p);
+                }
+            }
+            assert(ones == (n > 0 ? n - 1 : 0));
+
+            /* 导航与指针结构一致 */
+            TreeNode **order = malloc(sizeof(TreeNode *) * (n > 0 ? n : 1));
+            TreeIter it;
+            treeIterInit(&it, root, TREE_LEVEL_ORDER);
+            for (int k = 0; k < n; k++) {
+                order[k] = treeIterNext(&it);
+            }
+            treeIterFree(&it);
+            for (long long k = 0; k < n; k++) {
+                long long l = succinctLeft(t, k), r = succinctRight(t, k);
+                assert(t->vals[k] == order[k]->val);
+                assert(l < 0 ? order[k]->left == NULL : order[l] == order[k]->left && succinctParent(t, l) == k);
+                assert(r < 0 ? order[k]->right == NULL : order[r] == order[k]->right && succinctParent(t, r) == k);
+            }
+            assert(n == 0 || succinctParent(t, 0) == -1);
+            free(order);
+
+            /* 查找（二叉搜索树） */
+            if (shape != 1) {
+                for (int q = -1; q <= n; q++) {
+                    long long k = succinctSearch(t, q);
+                    assert(q < 0 || q >= n ? k == -1 : t->vals[k] == q);
+                }
+            }
+
+            /* 文件往返 */
+            assert(succinctSave(t, SUCCINCT_TEST_PATH));
+            SuccinctTree *mapped = succinctOpen(SUCCINCT_TEST_PATH);
+            assert(mapped != NULL && mapped->n == n);
+            TreeNode *copy = succinctToTree(mapped, NULL);
+            assert(treeEqual(root, copy));
+            freeMemoryTree(copy);
+            delSuccinctTree(mapped);
+            delSuccinctTree(t);
+            delTreeNodePool(pool);
+            cases++;
+        }
+    }
+
+    /* 截断与损坏的文件 */
+    FILE *fp = fopen(SUCCINCT_TEST_PATH, "r+b");
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    fputc('X', fp);
+    fclose(fp);
+    assert(succinctOpen(SUCCINCT_TEST_PATH) == NULL);
+    fp = fopen(SUCCINCT_TEST_PATH, "wb");
+    fwrite(SUCCINCT_MAGIC, 1, 8, fp);
+    fclose(fp);
+    assert(succinctOpen(SUCCINCT_TEST_PATH) == NULL);
+    int corruptSizes[] = {2, 33, 200, 5000};
+    for (int i = 0; i < 4; i++) {
+        testCorruptBody(corruptSizes[i]);
+    }
+    remove(SUCCINCT_TEST_PATH);
+    printf("损坏文件头、截断为 8 字节（原 %ld 字节）、位图或秩目录损坏的文件均被拒绝\n", size);
+    printf("%d 棵树的 rank / select 、导航、查找与文件往返均正确\n", cases);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_NODES;
+    const char *names[] = {"平衡 BST", "随机 BST", "右链"};
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    int *queries = malloc(sizeof(int) * BENCH_QUERIES);
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        queries[i] = (int)(randU32(&x) % n);
+    }
+    printf("%d 个节点，查找 %d 次\n", n, BENCH_QUERIES);
+    printf("%-10s %6s %14s %12s %10s %12s %10s %12s %12s %12s\n", "形状", "树高", "层序数组", "简洁格式", "位/节点",
+           "保存 MB/s", "打开 us", "重建 M/s", "映射查找 ns", "指针查找 ns");
+    for (int shape = 0; shape < 3; shape++) {
+        TreeNodePool *pool = newTreeNodePool();
+        TreeNode *root = shape == 0 ? balancedBST(pool, 0, n) : shape == 1 ? randomBST(pool, &x, 0, n)
+                                                                          : chainTree(pool, n, 0);
+        int height;
+        double heapBytes = (heapMaxIndex(root, &height) + 1) * sizeof(int);
+
+        double start = wallSeconds();
+        SuccinctTree *t = newSuccinctTree(root);
+        assert(succinctSave(t, SUCCINCT_TEST_PATH));
+        double tSave = wallSeconds() - start;
+        size_t fileBytes = t->imageSize;
+        // 位图与秩目录（不含节点值与文件头）每个节点占用的位数
+        double shapeBits = (double)(fileBytes - sizeof(SuccinctHeader) - succinctAlign8((size_t)n * 4)) * 8 / n;
+        delSuccinctTree(t);
+
+        start = wallSeconds();
+        t = succinctOpen(SUCCINCT_TEST_PATH);
+        double tOpen = wallSeconds() - start;
+        assert(t != NULL);
+
+        TreeNodePool *copyPool = newTreeNodePool();
+        start = wallSeconds();
+        TreeNode *copy = succinctToTree(t, copyPool);
+        double tLoad = wallSeconds() - start;
+        assert(copy->val == root->val);
+        delTreeNodePool(copyPool);
+
+        double tMapped = 0, tPointer = 0;
+        if (shape != 2) {
+            long long hits = 0;
+            start = wallSeconds();
+            for (int i = 0; i < BENCH_QUERIES; i++) {
+                hits += succinctSearch(t, queries[i]) >= 0;
+            }
+            tMapped = wallSeconds() - start;
+            start = wallSeconds();
+            for (int i = 0; i < BENCH_QUERIES; i++) {
+                hits -= bstFind(root, queries[i]) != NULL;
+            }
+            tPointer = wallSeconds() - start;
+            assert(hits == 0);
+        }
+
+        char heapBuf[32], fileBuf[32];
+        formatBytes(heapBytes, height, heapBuf, sizeof(heapBuf));
+        formatBytes((double)fileBytes, height, fileBuf, sizeof(fileBuf));
+        printf("%-10s %6d %14s %12s %10.2f %12.1f %10.1f %12.1f", names[shape], height, heapBuf, fileBuf, shapeBits,
+               fileBytes / 1e6 / tSave, tOpen * 1e6, n / 1e6 / tLoad);
+        if (shape != 2) {
+            printf(" %12.1f %12.1f\n", tMapped * 1e9 / BENCH_QUERIES, tPointer * 1e9 / BENCH_QUERIES);
+        } else {
+            printf(" %12s %12s\n", "-", "-");
+        }
+        delSuccinctTree(t);
+        delTreeNodePool(pool);
+    }
+    remove(SUCCINCT_TEST_PATH);
+    free(queries);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,221 @@
+/**
+ * @FileName    :tree_node_pool_test.c
+ * @Date        :2026-10-20 04:58:03
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :节点内存池测试程序
+ * @Description :1. 基本测试：内存池的分配与复用、从内存池反序列化二叉树、使用内存池的 AVL 树
+ *               2. 正确性：随机插入 / 删除，逐个 malloc 的 AVL 树、使用内存池的 AVL 树与二叉搜索树、紧凑 AVL 树的
+ *                  中序遍历结果一致，内存池中正在使用的节点数量与树的节点数量一致
+ *               3. 性能：随机键（默认 10^6 个，-DBENCH_KEYS=10000000 可测试 10^7 个）的 AVL 树插入吞吐量、
+ *                  建树后常驻内存（RSS）的增量与销毁耗时，对比逐个 malloc 、内存池与 32 位下标三种实现。
+ */
+
+#include "../utils/bench_util.h"
+
+// 二叉搜索树与 AVL 树的函数同名，包含前先重命名
+#define search bstSearch
+#define insert bstInsert
+#define removeItem bstRemoveItem
+#include "binary_search_tree.c"
+#undef search
+#undef insert
+#undef removeItem
+#include "avl_tree.c"
+#include "avl_tree_compact.c"
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#ifndef BENCH_KEYS
+#define BENCH_KEYS 1000000
+#endif
+
+/* 当前进程的常驻内存（MB），非 Linux 平台返回 0 */
+double rssMB() {
+#ifdef __GLIBC__
+    // 先将分配器缓存的空闲内存归还系统，避免前一次测试释放的内存被复用而低估增量
+    malloc_trim(0);
+#endif
+#ifdef __linux__
+    long pages = 0, resident = 0;
+    FILE *fp = fopen("/proc/self/statm", "r");
+    if (fp != NULL) {
+        if (fscanf(fp, "%ld %ld", &pages, &resident) != 2) {
+            resident = 0;
+        }
+        fclose(fp);
+    }
+    return resident * (double)sysconf(_SC_PAGESIZE) / 1e6;
+#else
+    return 0;
+#endif
+}
+
+/* 中序遍历，将节点值写入 res ，返回写入的数量 */
+int treeInorder(TreeNode *node, int *res, int size) {
+    if (node == NULL) {
+        return size;
+    }
+    size = treeInorder(node->left, res, size);
+    res[size++] = node->val;
+    return treeInorder(node->right, res, size);
+}
+
+/* 统计节点数量 */
+long long treeSize(TreeNode *node) {
+    return node == NULL ? 0 : 1 + treeSize(node->left) + treeSize(node->right);
+}
+
+/* 基本测试 */
+void testBasic() {
+    TreeNodePool *pool = newTreeNodePool();
+    TreeNode *a = treeNodeAlloc(pool, 1), *b = treeNodeAlloc(pool, 2);
+    assert(b == a + 1 && pool->live == 2 && pool->capacity == TREE_POOL_MIN_SLAB);
+    treeNodeFree(pool, a);
+    // 回收的节点被优先复用
+    assert(treeNodeAlloc(pool, 3) == a && pool->live == 2);
+    delTreeNodePool(pool);
+
+    int arr[] = {1, 2, 3, 4, INT_MAX, 6, 7, 8, 9, INT_MAX, INT_MAX, 12, INT_MAX, INT_MAX, 15};
+    pool = newTreeNodePool();
+    TreeNode *root = arrayToTreePool(pool, arr, sizeof(arr) / sizeof(arr[0]));
+    printf("从内存池反序列化的二叉树（%lld 个节点）：\n", pool->live);
+    printTree(root);
+    // 销毁内存池即释放整棵树
+    delTreeNodePool(pool);
+
+    AVLTree *avl = newAVLTreePooled();
+    for (int i = 1; i <= 10; i++) {
+        insert(avl, i);
+    }
+    removeItem(avl, 4);
+    printf("\n使用内存池的 AVL 树（插入 1 ~ 10 ，删除 4）：\n");
+    printTree(avl->root);
+    assert(avl->pool->live == 9 && search(avl, 4) == NULL && search(avl, 5) != NULL);
+    int avlHeight = avl->root->height;
+    delAVLTree(avl);
+
+    AVLTreeCompact *compact = newAVLTreeCompact(0);
+    for (int i = 1; i <= 10; i++) {
+        avlcInsert(compact, i);
+    }
+    avlcRemove(compact, 4);
+    printf("\n紧凑 AVL 树：节点 %zu 字节，根节点 %d ，高度 %d\n", sizeof(TreeNode32),
+           compact->nodes[compact->root].val, compact->nodes[compact->root].height);
+    assert(compact->size == 9 && avlcSearch(compact, 4) == 0 && avlcSearch(compact, 5) != 0);
+    assert(compact->nodes[compact->root].height == avlHeight);
+    delAVLTreeCompact(compact);
+}
+
+/* 正确性 */
+void testValidate() {
+    int range = 5000, ops = 200000;
+    AVLTree *plain = newAVLTree(), *pooled = newAVLTreePooled();
+    BinarySearchTree *bst = newBinarySearchTreePooled();
+    AVLTreeCompact *compact = newAVLTreeCompact(0);
+    bool *exist = calloc(range, sizeof(bool));
+    int *expect = malloc(sizeof(int) * range), *res = malloc(sizeof(int) * range);
+    unsigned long long x = 2026;
+    long long size = 0;
+    for (int op = 0; op < ops; op++) {
+        int k = randU32(&x) % range;
+        if (randU32(&x) % 2 == 0) {
+            insert(plain, k);
+            insert(pooled, k);
+            bstInsert(bst, k);
+            avlcInsert(compact, k);
+            size += !exist[k];
+            exist[k] = true;
+        } else {
+            removeItem(plain, k);
+            removeItem(pooled, k);
+            bstRemoveItem(bst, k);
+            avlcRemove(compact, k);
+            size -= exist[k];
+            exist[k] = false;
+        }
+        if (op % 10000 == 0 || op == ops - 1) {
+            int cnt = 0;
+            for (int j = 0; j < range; j++) {
+                if (exist[j]) {
+                    expect[cnt++] = j;
+                }
+            }
+            assert(cnt == size);
+            assert(treeInorder(plain->root, res, 0) == cnt && memcmp(res, expect, sizeof(int) * cnt) == 0);
+            assert(treeInorder(pooled->root, res, 0) == cnt && memcmp(res, expect, sizeof(int) * cnt) == 0);
+            assert(treeInorder(bst->root, res, 0) == cnt && memcmp(res, expect, sizeof(int) * cnt) == 0);
+            assert(avlcInorder(compact, compact->root, res, 0) == cnt && memcmp(res, expect, sizeof(int) * cnt) == 0);
+            // 旋转序列相同，因此树高相同
+            assert(height(plain->root) == height(pooled->root));
+            assert(height(plain->root) == compact->nodes[compact->root].height);
+            assert(pooled->pool->live == size && bst->pool->live == size && compact->size == size);
+        }
+    }
+    printf("%d 次随机操作后各实现结果一致，内存池容量 %lld 个节点，正在使用 %lld 个\n", ops, pooled->pool->capacity,
+           pooled->pool->live);
+    delAVLTree(plain);
+    delAVLTree(pooled);
+    delBinarySearchTree(bst);
+    delAVLTreeCompact(compact);
+    free(exist);
+    free(expect);
+    free(res);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_KEYS;
+    int *keys = malloc(sizeof(int) * n);
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < n; i++) {
+        keys[i] = (int)(randU32(&x) >> 1);
+    }
+    printf("%d 个随机键\n%-16s %14s %12s %10s\n", n, "", "插入 (M 次/s)", "RSS 增量 (MB)", "销毁 (s)");
+
+    const char *names[] = {"逐个 malloc", "内存池"};
+    long long size = -1;
+    for (int k = 0; k < 2; k++) {
+        double rss = rssMB(), start = wallSeconds();
+        AVLTree *avl = k == 0 ? newAVLTree() : newAVLTreePooled();
+        for (int i = 0; i < n; i++) {
+            insert(avl, keys[i]);
+        }
+        double t = wallSeconds() - start, mem = rssMB() - rss;
+        if (k == 0) {
+            size = treeSize(avl->root);
+        } else {
+            assert(avl->pool->live == size);
+        }
+        start = wallSeconds();
+        delAVLTree(avl);
+        printf("%-16s %14.2f %12.1f %10.3f\n", names[k], n / t / 1e6, mem, wallSeconds() - start);
+    }
+
+    /* 32 位下标 */
+    double rss = rssMB(), start = wallSeconds();
+    AVLTreeCompact *compact = newAVLTreeCompact(0);
+    for (int i = 0; i < n; i++) {
+        avlcInsert(compact, keys[i]);
+    }
+    double t = wallSeconds() - start, mem = rssMB() - rss;
+    assert(compact->size == size);
+    start = wallSeconds();
+    delAVLTreeCompact(compact);
+    printf("%-16s %14.2f %12.1f %10.3f\n", "32 位下标", n / t / 1e6, mem, wallSeconds() - start);
+    printf("节点大小：TreeNode %zu 字节，TreeNode32 %zu 字节\n", sizeof(TreeNode), sizeof(TreeNode32));
+    free(keys);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * @FileName    :bucket_queue.c
+ * @Date        :2026-10-19 09:48:15
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :桶队列（bucket queue / 日历队列），适用于有界范围单调整数优先级的小顶堆
+ * @Description :前提：出堆的优先级单调不减，且堆中任意元素的优先级都位于 [cur, cur + range) 内，
+ *               例如边权不超过 range - 1 的 Dijkstra 最短路，或步长有界的离散事件模拟。
+ *               使用 range 个桶组成环形数组（日历），优先级为 key 的元素放入第 key % range 个桶中。
+ *               入堆为 O(1) ；出堆时从当前桶 cur 开始向后扫描到第一个非空桶，
+ *               由于 cur 只增不减，扫描总代价为 O(n + C) ，C 为最大优先级。
+ *               接口与 MinHeap 保持一致（push / pop / peek / size / isEmpty），
+ *               另提供带附加数据的 pushPair / popPair 版本。
+ */
+
+#include "../utils/common.h"
+
+/* 桶队列元素 */
+typedef struct {
+    int key;  // 优先级
+    int item; // 附加数据（如顶点编号）
+} BucketQueueNode;
+
+/* 桶（动态数组） */
+typedef struct {
+    BucketQueueNode *nodes; // 元素数组
+    int size;               // 元素数量
+    int capacity;           // 数组容量
+} CalendarBucket;
+
+/* 桶队列 */
+typedef struct {
+    CalendarBucket *buckets; // 环形桶数组
+    int range;               // 桶数量，即优先级跨度上限
+    int cur;                 // 当前最小优先级（只增不减）
+    int size;                // 元素总数
+} BucketQueue;
+
+/* 构造函数，range 为堆中优先级跨度的上限（最大边权 + 1） */
+BucketQueue *newBucketQueue(int range) {
+    BucketQueue *queue = malloc(sizeof(BucketQueue));
+    queue->buckets = calloc(range, sizeof(CalendarBucket));
+    queue->range = range;
+    queue->cur = 0;
+    queue->size = 0;
+    return queue;
+}
+
+/* 析构函数 */
+void delBucketQueue(BucketQueue *queue) {
+    for (int i = 0; i < queue->range; i++) {
+        free(queue->buckets[i].nodes);
+    }
+    free(queue->buckets);
+    free(queue);
+}
+
+/* 获取堆大小 */
+int bucketQueueSize(BucketQueue *queue) {
+    return queue->size;
+}
+
+/* 判断堆是否为空 */
+bool bucketQueueIsEmpty(BucketQueue *queue) {
+    return queue->size == 0;
+}
+
+/* 元素入堆（带附加数据） */
+void bucketQueuePushPair(BucketQueue *queue, int key, int item) {
+    // 优先级必须落在 [cur, cur + range) 内
+    if (key < queue->cur || key - queue->cur >= queue->range) {
+        printf("Key %d is out of the bucket queue range!\n", key);
+        return;
+    }
+    CalendarBucket *bucket = &queue->buckets[key % queue->range];
+    if (bucket->size == bucket->capacity) {
+        bucket->capacity = bucket->capacity == 0 ? 4 : bucket->capacity * 2;
+        bucket->nodes = realloc(bucket->nodes, bucket->capacity * sizeof(BucketQueueNode));
+    }
+    bucket->nodes[bucket->size].key = key;
+    bucket->nodes[bucket->size].item = item;
+    bucket->size++;
+    queue->size++;
+}
+
+/* 元素入堆 */
+void bucketQueuePush(BucketQueue *queue, int val) {
+    bucketQueuePushPair(queue, val, val);
+}
+
+/* 将 cur 推进到第一个非空桶，返回该桶 */
+CalendarBucket *bucketQueueAdvance(BucketQueue *queue) {
+    CalendarBucket *bucket = &queue->buckets[queue->cur % queue->range];
+    while (bucket->size == 0) {
+        queue->cur++;
+        bucket = &queue->buckets[queue->cur % queue->range];
+    }
+    return bucket;
+}
+
+/* 访问堆顶元素 */
+int bucketQueuePeek(BucketQueue *queue) {
+    if (bucketQueueIsEmpty(queue)) {
+        printf("Heap is empty!");
+        return INT_MAX;
+    }
+    bucketQueueAdvance(queue);
+    return queue->cur;
+}
+
+/* 元素出堆（带附加数据），返回优先级 */
+int bucketQueuePopPair(BucketQueue *queue, int *item) {
+    // 判空处理
+    if (bucketQueueIsEmpty(queue)) {
+        printf("Heap is empty!");
+        return INT_MAX;
+    }
+    // 桶中元素优先级均为 cur ，从尾部取出即可
+    CalendarBucket *bucket = bucketQueueAdvance(queue);
+    BucketQueueNode node = bucket->nodes[--bucket->size];
+    queue->size--;
+    if (item != NULL) {
+        *item = node.item;
+    }
+    return node.key;
+}
+
+/* 元素出堆 */
+int bucketQueuePop(BucketQueue *queue) {
+    return bucketQueuePopPair(queue, NULL);
+}
@@ -0,0 +1,277 @@
+/**
+ * @FileName    :k_way_merge.c
+ * @Date        :2026-10-19 11:05:47
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :多路归并（k-way merge）：败者树与小顶堆两种实现
+ * @Description :给定 k 个有序序列（数组或文件），将其归并为一个有序序列，并按批次输出。
+ *               1. 败者树（loser tree / 锦标赛树）：k 个叶节点对应 k 个序列的当前元素，
+ *                  内部节点记录比赛的“败者”，根节点之上额外记录总冠军。
+ *                  弹出冠军后，只需沿其叶节点到根的路径与各层败者比较一次，共 log2(k) 次比较。
+ *               2. 小顶堆：堆中存放序列编号，按序列当前元素排序，复用 MinHeap 的 left / right / parent 索引计算。
+ *                  每次弹出后从顶至底堆化，每层需要 2 次比较。
+ *               序列通过迭代器 RunIter 抽象，数组序列一次性提供全部元素，文件序列按块读入缓冲区。
+ *               相等元素按序列编号从小到大输出，因此归并是稳定的。
+ *               mergeSortKWay 将归并排序的二路 merge 替换为 k 路归并，降低大数据量下的归并轮数。
+ */
+
+#include "min_heap.c"
+
+// 文件序列的读缓冲区大小（元素个数）
+#define RUN_BUF_SIZE 4096
+// k 不超过该阈值时，自动模式使用小顶堆
+#define KWAY_HEAP_THRESHOLD 2
+
+/* 归并实现方式 */
+typedef enum {
+    KWAY_AUTO,       // 根据 k 自动选择
+    KWAY_LOSER_TREE, // 败者树
+    KWAY_HEAP,       // 小顶堆
+} KWayMode;
+
+/* 有序序列迭代器 */
+typedef struct RunIter {
+    int *buf;                           // 当前缓冲区
+    int pos;                            // 缓冲区读取位置
+    int len;                            // 缓冲区有效长度
+    bool (*refill)(struct RunIter *it); // 缓冲区读完后补充数据，返回是否还有数据
+    FILE *file;                         // 文件序列对应的文件，数组序列为 NULL
+} RunIter;
+
+/* 数组序列无法补充数据 */
+bool arrayRunRefill(RunIter *it) {
+    (void)it;
+    return false;
+}
+
+/* 文件序列：从文件中读入下一块数据 */
+bool fileRunRefill(RunIter *it) {
+    it->len = (int)fread(it->buf, sizeof(int), RUN_BUF_SIZE, it->file);
+    it->pos = 0;
+    return it->len > 0;
+}
+
+/* 初始化数组序列迭代器 */
+void initArrayRun(RunIter *it, int *nums, int size) {
+    it->buf = nums;
+    it->pos = 0;
+    it->len = size;
+    it->refill = arrayRunRefill;
+    it->file = NULL;
+}
+
+/* 初始化文件序列迭代器，文件内容为二进制 int 数组 */
+void initFileRun(RunIter *it, FILE *file) {
+    it->buf = malloc(sizeof(int) * RUN_BUF_SIZE);
+    it->file = file;
+    it->refill = fileRunRefill;
+    fileRunRefill(it);
+}
+
+/* 释放迭代器（只释放文件序列的缓冲区，不关闭文件） */
+void delRunIter(RunIter *it) {
+    if (it->file != NULL) {
+        free(it->buf);
+    }
+}
+
+/* 判断序列是否还有元素 */
+bool runHasNext(RunIter *it) {
+    return it->pos < it->len || (it->refill(it) && it->pos < it->len);
+}
+
+/* 多路归并器 */
+typedef struct {
+    RunIter *runs; // k 个序列
+    int k;         // 序列数量
+    KWayMode mode; // 实现方式
+    int *keys;     // 每个序列的当前元素
+    bool *alive;   // 序列是否还有元素
+    int *tree;     // 败者树：tree[0] 为冠军，tree[1..k-1] 为各内部节点的败者；小顶堆：序列编号数组
+    int heapSize;  // 小顶堆大小
+} KWayMerger;
+
+/* 序列 a 的当前元素是否应排在序列 b 之前（已耗尽的序列视为无穷大） */
+bool kWayBeats(KWayMerger *m, int a, int b) {
+    if (!m->alive[a]) {
+        return false;
+    }
+    if (!m->alive[b]) {
+        return true;
+    }
+    return m->keys[a] < m->keys[b] || (m->keys[a] == m->keys[b] && a < b);
+}
+
+/* 读取序列 i 的下一个元素作为当前元素 */
+void kWayAdvance(KWayMerger *m, int i) {
+    RunIter *it = &m->runs[i];
+    m->alive[i] = runHasNext(it);
+    if (m->alive[i]) {
+        m->keys[i] = it->buf[it->pos++];
+    }
+}
+
+/* 建立败者树：叶节点 k + i 对应序列 i ，内部节点 1..k-1 ，节点 j 的父节点为 j / 2 */
+void buildLoserTree(KWayMerger *m) {
+    int k = m->k;
+    // winner[j] 记录以 j 为根的子树的胜者
+    int *winner = malloc(sizeof(int) * k);
+    for (int j = k - 1; j >= 1; j--) {
+        int l = 2 * j, r = 2 * j + 1;
+        int a = l >= k ? l - k : winner[l];
+        int b = r >= k ? r - k : winner[r];
+        if (kWayBeats(m, a, b)) {
+            winner[j] = a, m->tree[j] = b;
+        } else {
+            winner[j] = b, m->tree[j] = a;
+        }
+    }
+    m->tree[0] = k == 1 ? 0 : winner[1];
+    free(winner);
+}
+
+/* 冠军序列前进一步后，沿叶节点到根的路径重赛 */
+void replayLoserTree(KWayMerger *m) {
+    int w = m->tree[0];
+    kWayAdvance(m, w);
+    for (int j = (w + m->k) / 2; j >= 1; j /= 2) {
+        // 与该节点记录的败者比赛，败者留下，胜者继续向上
+        if (kWayBeats(m, m->tree[j], w)) {
+            int temp = m->tree[j];
+            m->tree[j] = w;
+            w = temp;
+        }
+    }
+    m->tree[0] = w;
+}
+
+/* 小顶堆：从节点 i 开始，从顶至底堆化 */
+void kWaySiftDown(KWayMerger *m, int i) {
+    while (true) {
+        int l = left(i), r = right(i), min = i;
+        if (l < m->heapSize && kWayBeats(m, m->tree[l], m->tree[min])) {
+            min = l;
+        }
+        if (r < m->heapSize && kWayBeats(m, m->tree[r], m->tree[min])) {
+            min = r;
+        }
+        if (min == i) {
+            break;
+        }
+        int temp = m->tree[i];
+        m->tree[i] = m->tree[min];
+        m->tree[min] = temp;
+        i = min;
+    }
+}
+
+/* 构造函数，runs 由调用方初始化并持有 */
+KWayMerger *newKWayMerger(RunIter *runs, int k, KWayMode mode) {
+    KWayMerger *m = malloc(sizeof(KWayMerger));
+    m->runs = runs;
+    m->k = k;
+    if (mode == KWAY_AUTO) {
+        mode = k <= KWAY_HEAP_THRESHOLD ? KWAY_HEAP : KWAY_LOSER_TREE;
+    }
+    m->mode = mode;
+    m->keys = malloc(sizeof(int) * k);
+    m->alive = malloc(sizeof(bool) * k);
+    m->tree = malloc(sizeof(int) * k);
+    for (int i = 0; i < k; i++) {
+        kWayAdvance(m, i);
+    }
+    if (mode == KWAY_LOSER_TREE) {
+        buildLoserTree(m);
+    } else {
+        // 只有非空序列入堆，自底向上建堆
+        m->heapSize = 0;
+        for (int i = 0; i < k; i++) {
+            if (m->alive[i]) {
+                m->tree[m->heapSize++] = i;
+            }
+        }
+        for (int i = parent(m->heapSize - 1); i >= 0; i--) {
+            kWaySiftDown(m, i);
+        }
+    }
+    return m;
+}
+
+/* 析构函数 */
+void delKWayMerger(KWayMerger *m) {
+    free(m->keys);
+    free(m->alive);
+    free(m->tree);
+    free(m);
+}
+
+/* 按批次输出：最多向 out 写入 batchSize 个元素，返回实际写入数量，返回 0 表示归并完成 */
+int kWayMergeNext(KWayMerger *m, int *out, int batchSize) {
+    int n = 0;
+    if (m->k == 0) {
+        return 0;
+    }
+    if (m->mode == KWAY_LOSER_TREE) {
+        while (n < batchSize && m->alive[m->tree[0]]) {
+            out[n++] = m->keys[m->tree[0]];
+            replayLoserTree(m);
+        }
+    } else {
+        while (n < batchSize && m->heapSize > 0) {
+            int top = m->tree[0];
+            out[n++] = m->keys[top];
+            kWayAdvance(m, top);
+            // 序列耗尽时用堆尾元素替换堆顶
+            if (!m->alive[top]) {
+                m->tree[0] = m->tree[--m->heapSize];
+            }
+            kWaySiftDown(m, 0);
+        }
+    }
+    return n;
+}
+
+/* 将 k 个有序数组归并到 out 中，返回元素总数 */
+int kWayMergeArrays(int **arrs, int *sizes, int k, int *out, KWayMode mode) {
+    RunIter *runs = malloc(sizeof(RunIter) * k);
+    for (int i = 0; i < k; i++) {
+        initArrayRun(&runs[i], arrs[i], sizes[i]);
+    }
+    KWayMerger *m = newKWayMerger(runs, k, mode);
+    int total = 0, n;
+    while ((n = kWayMergeNext(m, out + total, RUN_BUF_SIZE)) > 0) {
+        total += n;
+    }
+    delKWayMerger(m);
+    free(runs);
+    return total;
+}
+
+/* k 路归并排序：将区间 [left, right] 划分为 k 段分别排序，再进行一次 k 路归并 */
+void mergeSortKWay(int *nums, int left, int right, int k) {
+    int n = right - left + 1;
+    // 终止条件：子数组长度为 1
+    if (n <= 1) {
+        return;
+    }
+    if (k > n) {
+        k = n;
+    }
+    // 划分阶段：第 i 段为 [left + n * i / k, left + n * (i + 1) / k)
+    int **arrs = malloc(sizeof(int *) * k);
+    int *sizes = malloc(sizeof(int) * k);
+    for (int i = 0; i < k; i++) {
+        int l = left + (int)((long long)n * i / k);
+        int r = left + (int)((long long)n * (i + 1) / k) - 1;
+        mergeSortKWay(nums, l, r, k);
+        arrs[i] = nums + l;
+        sizes[i] = r - l + 1;
+    }
+    // 合并阶段：k 路归并到临时数组，再复制回原数组
+    int *tmp = malloc(sizeof(int) * n);
+    kWayMergeArrays(arrs, sizes, k, tmp, KWAY_AUTO);
+    memcpy(nums + left, tmp, sizeof(int) * n);
+    free(tmp);
+    free(arrs);
+    free(sizes);
+}
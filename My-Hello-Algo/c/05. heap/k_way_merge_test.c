@@ -0,0 +1,144 @@
+/**
+ * @FileName    :k_way_merge_test.c
+ * @Date        :2026-10-19 11:05:47
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :多路归并测试程序
+ * @Description :1. 数组序列归并、文件序列按批次归并、k 路归并排序
+ *               2. 性能对比：k = 2 ~ 1024 时败者树与小顶堆的归并耗时
+ */
+
+#include "../utils/bench_util.h"
+#include "k_way_merge.c"
+
+// 性能测试的元素总数
+#define BENCH_SIZE (1 << 22)
+
+/* 生成 k 个有序序列，元素总数为 n */
+int **genSortedRuns(int n, int k, int *sizes) {
+    int **arrs = malloc(sizeof(int *) * k);
+    for (int i = 0; i < k; i++) {
+        sizes[i] = n / k + (i < n % k ? 1 : 0);
+        arrs[i] = malloc(sizeof(int) * (sizes[i] + 1));
+        for (int j = 0; j < sizes[i]; j++) {
+            arrs[i][j] = rand();
+        }
+        qsort(arrs[i], sizes[i], sizeof(int), cmpInt);
+    }
+    return arrs;
+}
+
+/* 释放序列 */
+void freeRuns(int **arrs, int k) {
+    for (int i = 0; i < k; i++) {
+        free(arrs[i]);
+    }
+    free(arrs);
+}
+
+/* 数组序列归并 */
+void testArrayMerge() {
+    int a[] = {1, 4, 7, 10};
+    int b[] = {2, 5, 8};
+    int d[] = {0, 3, 6, 9, 12};
+    int *arrs[] = {a, b, NULL, d}; // 第 3 个序列为空
+    int sizes[] = {4, 3, 0, 5};
+    int out[12], expect[12], total = 0;
+    // 期望结果：所有序列拼接后排序
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < sizes[i]; j++) {
+            expect[total++] = arrs[i][j];
+        }
+    }
+    qsort(expect, total, sizeof(int), cmpInt);
+    int n = kWayMergeArrays(arrs, sizes, 4, out, KWAY_LOSER_TREE);
+    printf("败者树归并结果为 ");
+    printArray(out, n);
+    assert(n == total && memcmp(out, expect, sizeof(int) * total) == 0);
+    n = kWayMergeArrays(arrs, sizes, 4, out, KWAY_HEAP);
+    printf("小顶堆归并结果为 ");
+    printArray(out, n);
+    assert(n == total && memcmp(out, expect, sizeof(int) * total) == 0);
+}
+
+/* 文件序列按批次归并 */
+void testFileMerge() {
+    int k = 5, n = 20000;
+    int sizes[5];
+    int **arrs = genSortedRuns(n, k, sizes);
+    // 将每个序列写入临时文件
+    FILE *files[5];
+    RunIter runs[5];
+    for (int i = 0; i < k; i++) {
+        files[i] = tmpfile();
+        fwrite(arrs[i], sizeof(int), sizes[i], files[i]);
+        rewind(files[i]);
+        initFileRun(&runs[i], files[i]);
+    }
+    // 每批输出 1000 个元素
+    KWayMerger *m = newKWayMerger(runs, k, KWAY_AUTO);
+    int *out = malloc(sizeof(int) * n);
+    int total = 0, batches = 0, cnt;
+    while ((cnt = kWayMergeNext(m, out + total, 1000)) > 0) {
+        total += cnt;
+        batches++;
+    }
+    for (int i = 1; i < total; i++) {
+        assert(out[i - 1] <= out[i]);
+    }
+    assert(total == n);
+    printf("文件序列归并：%d 个序列，%d 个元素，%d 个批次\n", k, total, batches);
+
+    delKWayMerger(m);
+    for (int i = 0; i < k; i++) {
+        delRunIter(&runs[i]);
+        fclose(files[i]);
+    }
+    free(out);
+    freeRuns(arrs, k);
+}
+
+/* k 路归并排序 */
+void testMergeSortKWay() {
+    int nums[] = {7, 3, 2, 6, 0, 1, 5, 4, 9, 8, 3};
+    int size = sizeof(nums) / sizeof(int);
+    mergeSortKWay(nums, 0, size - 1, 4);
+    printf("4 路归并排序完成后 nums = ");
+    printArray(nums, size);
+}
+
+/* 性能对比：败者树 vs 小顶堆 */
+void testBenchmark() {
+    int *out = malloc(sizeof(int) * BENCH_SIZE);
+    printf("\n元素总数 %d\n", BENCH_SIZE);
+    printf("%6s %12s %12s\n", "k", "loser tree", "heap");
+    for (int k = 2; k <= 1024; k *= 2) {
+        int *sizes = malloc(sizeof(int) * k);
+        int **arrs = genSortedRuns(BENCH_SIZE, k, sizes);
+        double t[2];
+        KWayMode modes[] = {KWAY_LOSER_TREE, KWAY_HEAP};
+        for (int j = 0; j < 2; j++) {
+            clock_t start = clock();
+            int n = kWayMergeArrays(arrs, sizes, k, out, modes[j]);
+            t[j] = (double)(clock() - start) / CLOCKS_PER_SEC;
+            assert(n == BENCH_SIZE);
+            for (int i = 1; i < n; i++) {
+                assert(out[i - 1] <= out[i]);
+            }
+        }
+        printf("%6d %10.3f s %10.3f s\n", k, t[0], t[1]);
+        freeRuns(arrs, k);
+        free(sizes);
+    }
+    free(out);
+}
+
+/* Driver Code */
+int main() {
+    srand(2026);
+    runTest("testArrayMerge", testArrayMerge);
+    runTest("testFileMerge", testFileMerge);
+    runTest("testMergeSortKWay", testMergeSortKWay);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -24,9 +24,10 @@ typedef struct
 } MaxHeap;
 
 // 函数声明
-void siftDown(MaxHeap *maxHeap, int i); // 从节点 i 开始，从【顶】至【底】堆化
-void siftUp(MaxHeap *maxHeap, int i);   // 从节点 i 开始，从【底】至【顶】堆化
-int parent(int i);                      // 向下取整获取父节点的索引
+void siftDown(MaxHeap *maxHeap, int i);         // 从节点 i 开始，从【顶】至【底】堆化（参考实现）
+void siftDownBottomUp(MaxHeap *maxHeap, int i); // 从节点 i 开始，自底向上（Floyd）堆化
+void siftUp(MaxHeap *maxHeap, int i);           // 从节点 i 开始，从【底】至【顶】堆化
+int parent(int i);                              // 向下取整获取父节点的索引
 
 /* 构造函数，根据切片建堆 时间复杂度为 O(n) */
 // 1. 将列表所有元素原封不动地添加到堆中，此时堆的性质尚未得到满足。
@@ -38,7 +39,7 @@ MaxHeap *newMaxHeap(int *nums, int size) {
     memcpy(maxHeap->data, nums, size * sizeof(int));
     // 自底向上堆化除叶节点以外的其他所有节点
     for (int i = parent(size - 1); i >= 0; i--) {
-        siftDown(maxHeap, i);
+        siftDownBottomUp(maxHeap, i);
     }
     return maxHeap;
 }
@@ -128,13 +129,13 @@ int pop(MaxHeap *maxHeap) {
     // 删除节点
     int val = maxHeap->data[size(maxHeap) - 1];
     maxHeap->size--;
-    // 从顶至底堆化
-    siftDown(maxHeap, 0);
+    // 从顶至底堆化（换到堆顶的原堆尾元素通常很小，会一路下沉到底部，适合自底向上堆化）
+    siftDownBottomUp(maxHeap, 0);
     // 返回堆顶元素(交换到堆尾被删除的为原来的堆顶元素)
     return val;
 }
 
-/* 从节点 i 开始，从顶至底堆化 */
+/* 从节点 i 开始，从顶至底堆化（经典实现，作为 siftDownBottomUp 的参考，见 max_heap_test.c） */
 void siftDown(MaxHeap *maxHeap, int i) {
     while (true) {
         int s = size(maxHeap);
@@ -157,4 +158,35 @@ void siftDown(MaxHeap *maxHeap, int i) {
         // 循环向下堆化
         i = max;
     }
-}
\ No newline at end of file
+}
+
+/* 从节点 i 开始，自底向上（Floyd / Wegener）堆化 */
+// 经典堆化每层需比较 2 次（左右子节点比较、与较大子节点比较）。
+// 自底向上堆化先取出节点 i 的值形成“空位”，让空位沿较大子节点一路下沉到叶节点，每层只需比较 1 次；
+// 再将取出的值放入空位并向上回溯到正确位置。由于该值通常很小，回溯往往只需极少次比较。
+void siftDownBottomUp(MaxHeap *maxHeap, int i) {
+    int s = size(maxHeap);
+    int val = maxHeap->data[i];
+    int hole = i;
+    // 1. 空位沿较大子节点下沉至叶节点
+    int l = left(hole);
+    while (l < s) {
+        int max = l;
+        if (l + 1 < s && maxHeap->data[l + 1] > maxHeap->data[l]) {
+            max = l + 1;
+        }
+        maxHeap->data[hole] = maxHeap->data[max];
+        hole = max;
+        l = left(hole);
+    }
+    // 2. 从叶节点向上回溯，找到 val 的位置（不越过起始节点 i ）
+    while (hole > i) {
+        int p = parent(hole);
+        if (maxHeap->data[p] >= val) {
+            break;
+        }
+        maxHeap->data[hole] = maxHeap->data[p];
+        hole = p;
+    }
+    maxHeap->data[hole] = val;
+}
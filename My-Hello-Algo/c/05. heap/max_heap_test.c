@@ -4,13 +4,56 @@
  * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
  * @Version     :V1.0.0
  * @Brief       :最大堆测试程序
- * @Description :
+ * @Description :1. 堆的基本操作
+ *               2. 自底向上堆化与经典的从顶至底堆化（siftDown）对照：两者建堆、出堆的结果一致
  */
 
 
 
 #include "max_heap.c"
 
+/* 判断是否满足大顶堆性质 */
+bool isMaxHeap(MaxHeap *maxHeap) {
+    for (int i = 1; i < size(maxHeap); i++) {
+        if (maxHeap->data[parent(i)] < maxHeap->data[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 对照：参考堆使用 siftDown 建堆与出堆，出堆序列须与 newMaxHeap / pop 相同 */
+void testSiftDownReference() {
+    unsigned int seed = 2024;
+    int nums[200];
+    for (int n = 0; n <= 200; n++) {
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            nums[i] = (int)(seed >> 16) % 50;
+        }
+        MaxHeap *heap = newMaxHeap(nums, n);
+        MaxHeap *ref = malloc(sizeof(MaxHeap));
+        ref->size = n;
+        memcpy(ref->data, nums, n * sizeof(int));
+        for (int i = parent(n - 1); i >= 0; i--) {
+            siftDown(ref, i);
+        }
+        assert(isMaxHeap(heap) && isMaxHeap(ref));
+        while (!isEmpty(ref)) {
+            int expect = ref->data[0];
+            swap(ref, 0, size(ref) - 1);
+            ref->size--;
+            siftDown(ref, 0);
+            assert(pop(heap) == expect);
+            assert(isMaxHeap(heap));
+        }
+        assert(isEmpty(heap));
+        delMaxHeap(heap);
+        delMaxHeap(ref);
+    }
+    printf("\n自底向上堆化与 siftDown 的建堆、出堆结果一致\n");
+}
+
 /* Driver Code */
 int main() {
     /* 初始化堆 */
@@ -42,5 +85,7 @@ int main() {
     // 释放内存
     delMaxHeap(maxHeap);
 
+    testSiftDownReference();
+
     return 0;
 }
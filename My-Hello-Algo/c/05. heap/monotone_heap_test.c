@@ -0,0 +1,149 @@
+/**
+ * @FileName    :monotone_heap_test.c
+ * @Date        :2026-10-19 10:20:31
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :基数堆、桶队列测试程序
+ * @Description :1. 基本操作测试：入堆、访问堆顶、出堆、堆大小、判空
+ *               2. 基于类 Dijkstra 操作序列的性能对比：MinHeap vs RadixHeap vs BucketQueue
+ *                  操作序列：每弹出一个距离 d ，就压入若干个 d + w（w 为随机边权），出堆序列单调不减。
+ *                  MinHeap 容量固定为 MAX_SIZE ，因此序列中同时在堆中的元素数量控制在 MAX_SIZE 以内。
+ */
+
+#include "../utils/bench_util.h"
+#include "bucket_queue.c"
+#include "min_heap.c"
+#include "radix_heap.c"
+
+// 操作序列长度（入堆 + 出堆次数）
+#define TRACE_SIZE 2000000
+// 最大边权
+#define MAX_WEIGHT 100
+// 出堆标记
+#define OP_POP -1
+
+/* 生成类 Dijkstra 的操作序列，返回序列长度 */
+int genDijkstraTrace(int *ops, int maxOps) {
+    int n = 0, live = 0;
+    // 使用小顶堆模拟生成序列，保证出堆结果单调
+    MinHeap *heap = newMinHeap((int[]){0}, 0);
+    push(heap, 0);
+    ops[n++] = 0;
+    live++;
+    srand(2026);
+    while (n < maxOps - 8 && live > 0) {
+        int d = pop(heap);
+        ops[n++] = OP_POP;
+        live--;
+        // 随机松弛 0 ~ 4 条边
+        int deg = rand() % 5;
+        for (int i = 0; i < deg && live < MAX_SIZE - 1; i++) {
+            int key = d + 1 + rand() % MAX_WEIGHT;
+            push(heap, key);
+            ops[n++] = key;
+            live++;
+        }
+    }
+    delMinHeap(heap);
+    return n;
+}
+
+/* 基本操作测试 */
+void testBasic() {
+    int nums[] = {9, 8, 6, 6, 7, 5, 2, 1, 4, 3, 6, 2};
+    int n = sizeof(nums) / sizeof(int);
+
+    RadixHeap *radixHeap = newRadixHeap();
+    BucketQueue *bucketQueue = newBucketQueue(16);
+    for (int i = 0; i < n; i++) {
+        radixHeapPush(radixHeap, nums[i]);
+        bucketQueuePush(bucketQueue, nums[i]);
+    }
+    printf("堆顶元素为 %d, %d\n", radixHeapPeek(radixHeap), bucketQueuePeek(bucketQueue));
+    printf("堆元素数量为 %d, %d\n", radixHeapSize(radixHeap), bucketQueueSize(bucketQueue));
+
+    // 出堆序列应当升序
+    int res1[12], res2[12];
+    for (int i = 0; i < n; i++) {
+        res1[i] = radixHeapPop(radixHeap);
+        res2[i] = bucketQueuePop(bucketQueue);
+        assert(res1[i] == res2[i]);
+        assert(i == 0 || res1[i - 1] <= res1[i]);
+    }
+    printf("基数堆出堆序列为 ");
+    printArray(res1, n);
+    printf("桶队列出堆序列为 ");
+    printArray(res2, n);
+    printf("堆是否为空 %d, %d\n", radixHeapIsEmpty(radixHeap), bucketQueueIsEmpty(bucketQueue));
+
+    // 附加数据随元素一起出堆
+    radixHeapPushPair(radixHeap, 20, 7);
+    int item;
+    int key = radixHeapPopPair(radixHeap, &item);
+    assert(key == 20 && item == 7);
+
+    delRadixHeap(radixHeap);
+    delBucketQueue(bucketQueue);
+}
+
+/* 性能对比 */
+void testBenchmark() {
+    int *ops = malloc(sizeof(int) * TRACE_SIZE);
+    int n = genDijkstraTrace(ops, TRACE_SIZE);
+    long long sum1 = 0, sum2 = 0, sum3 = 0;
+    clock_t start;
+
+    // MinHeap
+    start = clock();
+    MinHeap *minHeap = newMinHeap((int[]){0}, 0);
+    for (int i = 0; i < n; i++) {
+        if (ops[i] == OP_POP) {
+            sum1 += pop(minHeap);
+        } else {
+            push(minHeap, ops[i]);
+        }
+    }
+    delMinHeap(minHeap);
+    double t1 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // RadixHeap
+    start = clock();
+    RadixHeap *radixHeap = newRadixHeap();
+    for (int i = 0; i < n; i++) {
+        if (ops[i] == OP_POP) {
+            sum2 += radixHeapPop(radixHeap);
+        } else {
+            radixHeapPush(radixHeap, ops[i]);
+        }
+    }
+    delRadixHeap(radixHeap);
+    double t2 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // BucketQueue
+    start = clock();
+    BucketQueue *bucketQueue = newBucketQueue(MAX_WEIGHT + 1);
+    for (int i = 0; i < n; i++) {
+        if (ops[i] == OP_POP) {
+            sum3 += bucketQueuePop(bucketQueue);
+        } else {
+            bucketQueuePush(bucketQueue, ops[i]);
+        }
+    }
+    delBucketQueue(bucketQueue);
+    double t3 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    // 三者出堆结果必须一致
+    assert(sum1 == sum2 && sum2 == sum3);
+    printf("\n类 Dijkstra 操作序列长度为 %d\n", n);
+    printf("MinHeap     耗时 %.3f s\n", t1);
+    printf("RadixHeap   耗时 %.3f s\n", t2);
+    printf("BucketQueue 耗时 %.3f s\n", t3);
+    free(ops);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,262 @@
+/**
+ * @FileName    :pairing_heap.c
+ * @Date        :2026-10-19 14:10:08
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :配对堆（pairing heap），支持 O(1) 合并的小顶堆
+ * @Description :配对堆是一棵多叉树，任意节点的值 <= 其子节点的值，每个节点用“左孩子右兄弟”方式存储。
+ *               1. 合并（meld）：比较两个根节点，较大者成为较小者的第一个孩子，O(1) 。
+ *               2. 入堆（push）：新建单节点堆并与原堆合并，O(1) 。
+ *               3. 出堆（pop）：删除根节点后，将其所有孩子两两配对合并（从左到右），
+ *                  再从右到左依次合并为一棵树，均摊 O(log n) 。
+ *               4. 减小键值（decreaseKey）：将节点及其子树从父节点处剪下，修改键值后与根合并，均摊 o(log n) 。
+ *               节点从节点池 PairingPool 中分配：按块批量申请内存，释放的节点进入空闲链表复用。
+ *               共享同一节点池的堆之间可以直接合并。
+ *               接口与 MinHeap 保持一致（push / pop / peek / size / isEmpty），另提供 meld 与 decreaseKey 。
+ */
+
+#include "../utils/common.h"
+
+// 节点池每次申请的节点数量
+#define PAIRING_POOL_BLOCK 4096
+
+/* 配对堆节点 */
+typedef struct PairingNode {
+    int val;                     // 节点值
+    struct PairingNode *child;   // 第一个孩子
+    struct PairingNode *sibling; // 右兄弟
+    struct PairingNode *prev;    // 左兄弟；若为第一个孩子则指向父节点
+} PairingNode;
+
+/* 节点内存块（链表） */
+typedef struct PairingBlock {
+    PairingNode nodes[PAIRING_POOL_BLOCK];
+    struct PairingBlock *next;
+} PairingBlock;
+
+/* 节点池 */
+typedef struct {
+    PairingBlock *blocks;   // 已申请的内存块
+    int used;               // 当前块中已使用的节点数
+    PairingNode *freeList;  // 空闲节点链表（通过 sibling 链接）
+} PairingPool;
+
+/* 配对堆 */
+typedef struct {
+    PairingNode *root; // 根节点
+    int size;          // 节点数量
+    PairingPool *pool; // 节点池
+} PairingHeap;
+
+/* 节点池构造函数 */
+PairingPool *newPairingPool() {
+    PairingPool *pool = malloc(sizeof(PairingPool));
+    pool->blocks = NULL;
+    pool->used = PAIRING_POOL_BLOCK;
+    pool->freeList = NULL;
+    return pool;
+}
+
+/* 节点池析构函数：一次性释放所有节点 */
+void delPairingPool(PairingPool *pool) {
+    PairingBlock *block = pool->blocks;
+    while (block != NULL) {
+        PairingBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(pool);
+}
+
+/* 从节点池分配节点，O(1) */
+PairingNode *pairingPoolAlloc(PairingPool *pool) {
+    // 优先复用空闲节点
+    if (pool->freeList != NULL) {
+        PairingNode *node = pool->freeList;
+        pool->freeList = node->sibling;
+        return node;
+    }
+    // 当前块已用完，申请新块
+    if (pool->used == PAIRING_POOL_BLOCK) {
+        PairingBlock *block = malloc(sizeof(PairingBlock));
+        block->next = pool->blocks;
+        pool->blocks = block;
+        pool->used = 0;
+    }
+    return &pool->blocks->nodes[pool->used++];
+}
+
+/* 将节点归还节点池，O(1) */
+void pairingPoolFree(PairingPool *pool, PairingNode *node) {
+    node->sibling = pool->freeList;
+    pool->freeList = node;
+}
+
+/* 构造函数，多个堆可以共享同一个节点池 */
+PairingHeap *newPairingHeap(PairingPool *pool) {
+    PairingHeap *heap = malloc(sizeof(PairingHeap));
+    heap->root = NULL;
+    heap->size = 0;
+    heap->pool = pool;
+    return heap;
+}
+
+/* 析构函数：将所有节点归还节点池 */
+void delPairingHeap(PairingHeap *heap) {
+    // 借助 sibling 链表迭代遍历整棵树，避免递归
+    PairingNode *list = heap->root;
+    while (list != NULL) {
+        PairingNode *node = list;
+        list = node->sibling;
+        // 将孩子链表拼接到待处理链表头部
+        if (node->child != NULL) {
+            PairingNode *last = node->child;
+            while (last->sibling != NULL) {
+                last = last->sibling;
+            }
+            last->sibling = list;
+            list = node->child;
+        }
+        pairingPoolFree(heap->pool, node);
+    }
+    free(heap);
+}
+
+/* 合并两棵树，返回新的根节点 */
+PairingNode *pairingLink(PairingNode *a, PairingNode *b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    // 保证 a 为较小的根
+    if (b->val < a->val) {
+        PairingNode *temp = a;
+        a = b;
+        b = temp;
+    }
+    // b 成为 a 的第一个孩子
+    b->prev = a;
+    b->sibling = a->child;
+    if (a->child != NULL) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    a->sibling = NULL;
+    a->prev = NULL;
+    return a;
+}
+
+/* 获取堆大小 */
+int pairingHeapSize(PairingHeap *heap) {
+    return heap->size;
+}
+
+/* 判断堆是否为空 */
+bool pairingHeapIsEmpty(PairingHeap *heap) {
+    return heap->size == 0;
+}
+
+/* 访问堆顶元素 */
+int pairingHeapPeek(PairingHeap *heap) {
+    if (pairingHeapIsEmpty(heap)) {
+        printf("Heap is empty!");
+        return INT_MAX;
+    }
+    return heap->root->val;
+}
+
+/* 元素入堆，返回节点句柄（用于 decreaseKey ） */
+PairingNode *pairingHeapPush(PairingHeap *heap, int val) {
+    PairingNode *node = pairingPoolAlloc(heap->pool);
+    node->val = val;
+    node->child = node->sibling = node->prev = NULL;
+    heap->root = pairingLink(heap->root, node);
+    heap->size++;
+    return node;
+}
+
+/* 两趟配对合并兄弟链表，返回新的根节点 */
+PairingNode *pairingMergePairs(PairingNode *first) {
+    if (first == NULL) {
+        return NULL;
+    }
+    // 第一趟：从左到右两两合并，结果通过 prev 逆序串联
+    PairingNode *tail = NULL;
+    while (first != NULL) {
+        PairingNode *a = first;
+        PairingNode *b = a->sibling;
+        first = b == NULL ? NULL : b->sibling;
+        a->sibling = NULL;
+        if (b != NULL) {
+            b->sibling = NULL;
+        }
+        PairingNode *merged = pairingLink(a, b);
+        merged->prev = tail;
+        tail = merged;
+    }
+    // 第二趟：从右到左依次合并
+    PairingNode *root = tail;
+    tail = tail->prev;
+    while (tail != NULL) {
+        PairingNode *next = tail->prev;
+        root = pairingLink(tail, root);
+        tail = next;
+    }
+    return root;
+}
+
+/* 元素出堆 */
+int pairingHeapPop(PairingHeap *heap) {
+    // 判空处理
+    if (pairingHeapIsEmpty(heap)) {
+        printf("Heap is empty!");
+        return INT_MAX;
+    }
+    PairingNode *root = heap->root;
+    int val = root->val;
+    heap->root = pairingMergePairs(root->child);
+    if (heap->root != NULL) {
+        heap->root->prev = NULL;
+    }
+    heap->size--;
+    pairingPoolFree(heap->pool, root);
+    return val;
+}
+
+/* 合并堆：将 other 的所有节点并入 heap ，other 变为空堆，O(1) */
+void pairingHeapMeld(PairingHeap *heap, PairingHeap *other) {
+    if (heap->pool != other->pool) {
+        printf("Heaps with different pools can not be melded!\n");
+        return;
+    }
+    heap->root = pairingLink(heap->root, other->root);
+    heap->size += other->size;
+    other->root = NULL;
+    other->size = 0;
+}
+
+/* 减小节点 node 的值为 val */
+void pairingHeapDecreaseKey(PairingHeap *heap, PairingNode *node, int val) {
+    if (val > node->val) {
+        printf("New key is greater than current key!\n");
+        return;
+    }
+    node->val = val;
+    if (node == heap->root) {
+        return;
+    }
+    // 将 node 及其子树从树中剪下
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+    if (node->sibling != NULL) {
+        node->sibling->prev = node->prev;
+    }
+    node->sibling = node->prev = NULL;
+    // 与根节点合并
+    heap->root = pairingLink(heap->root, node);
+}
@@ -0,0 +1,180 @@
+/**
+ * @FileName    :pairing_heap_test.c
+ * @Date        :2026-10-19 14:10:08
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :配对堆测试程序
+ * @Description :1. 基本操作测试：入堆、访问堆顶、出堆、合并、减小键值
+ *               2. 性能对比：MinHeap（数组实现，合并需逐个入堆）vs PairingHeap
+ *                  合并密集：多个分区堆反复两两合并；出堆密集：批量入堆后全部出堆。
+ *                  MinHeap 容量固定为 MAX_SIZE ，因此堆中元素总数控制在 MAX_SIZE 以内。
+ */
+
+#include "../utils/bench_util.h"
+#include "min_heap.c"
+#include "pairing_heap.c"
+
+// 分区数量与每个分区的元素数量
+#define PARTITION_NUM 64
+#define PARTITION_SIZE 64
+// 测试轮数
+#define BENCH_ROUNDS 2000
+
+/* 基本操作测试 */
+void testBasic() {
+    PairingPool *pool = newPairingPool();
+    PairingHeap *heap1 = newPairingHeap(pool);
+    PairingHeap *heap2 = newPairingHeap(pool);
+    int nums1[] = {9, 8, 6, 6, 7, 5};
+    int nums2[] = {2, 1, 4, 3, 6, 2};
+    PairingNode *handle = NULL;
+    for (int i = 0; i < 6; i++) {
+        pairingHeapPush(heap1, nums1[i]);
+        PairingNode *node = pairingHeapPush(heap2, nums2[i]);
+        if (nums2[i] == 4) {
+            handle = node;
+        }
+    }
+    printf("堆顶元素为 %d, %d\n", pairingHeapPeek(heap1), pairingHeapPeek(heap2));
+
+    /* 合并 */
+    pairingHeapMeld(heap1, heap2);
+    printf("合并后堆元素数量为 %d, %d\n", pairingHeapSize(heap1), pairingHeapSize(heap2));
+
+    /* 减小键值：4 -> 0 */
+    pairingHeapDecreaseKey(heap1, handle, 0);
+    printf("元素 4 减小为 0 后，堆顶元素为 %d\n", pairingHeapPeek(heap1));
+
+    /* 全部出堆 */
+    int res[12], n = 0;
+    while (!pairingHeapIsEmpty(heap1)) {
+        res[n++] = pairingHeapPop(heap1);
+    }
+    printf("出堆序列为 ");
+    printArray(res, n);
+    printf("堆是否为空 %d\n", pairingHeapIsEmpty(heap1));
+
+    delPairingHeap(heap1);
+    delPairingHeap(heap2);
+    delPairingPool(pool);
+}
+
+/* 数组堆的合并：将 other 的元素逐个压入 heap */
+void minHeapMeld(MinHeap *heap, MinHeap *other) {
+    for (int i = 0; i < other->size; i++) {
+        push(heap, other->data[i]);
+    }
+    other->size = 0;
+}
+
+/* 合并密集：每轮建立 PARTITION_NUM 个分区堆，两两合并为一个堆后弹出少量元素 */
+void benchMeldHeavy() {
+    long long sum1 = 0, sum2 = 0;
+    clock_t start;
+    MinHeap *minHeaps[PARTITION_NUM];
+    PairingHeap *pairingHeaps[PARTITION_NUM];
+
+    srand(1);
+    start = clock();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int p = 0; p < PARTITION_NUM; p++) {
+            minHeaps[p] = newMinHeap((int[]){0}, 0);
+            for (int i = 0; i < PARTITION_SIZE; i++) {
+                push(minHeaps[p], rand());
+            }
+        }
+        for (int step = 1; step < PARTITION_NUM; step *= 2) {
+            for (int p = 0; p + step < PARTITION_NUM; p += 2 * step) {
+                minHeapMeld(minHeaps[p], minHeaps[p + step]);
+            }
+        }
+        for (int i = 0; i < PARTITION_SIZE; i++) {
+            sum1 += pop(minHeaps[0]);
+        }
+        for (int p = 0; p < PARTITION_NUM; p++) {
+            delMinHeap(minHeaps[p]);
+        }
+    }
+    double t1 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    srand(1);
+    start = clock();
+    PairingPool *pool = newPairingPool();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int p = 0; p < PARTITION_NUM; p++) {
+            pairingHeaps[p] = newPairingHeap(pool);
+            for (int i = 0; i < PARTITION_SIZE; i++) {
+                pairingHeapPush(pairingHeaps[p], rand());
+            }
+        }
+        for (int step = 1; step < PARTITION_NUM; step *= 2) {
+            for (int p = 0; p + step < PARTITION_NUM; p += 2 * step) {
+                pairingHeapMeld(pairingHeaps[p], pairingHeaps[p + step]);
+            }
+        }
+        for (int i = 0; i < PARTITION_SIZE; i++) {
+            sum2 += pairingHeapPop(pairingHeaps[0]);
+        }
+        for (int p = 0; p < PARTITION_NUM; p++) {
+            delPairingHeap(pairingHeaps[p]);
+        }
+    }
+    delPairingPool(pool);
+    double t2 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    assert(sum1 == sum2);
+    printf("合并密集：MinHeap %.3f s, PairingHeap %.3f s\n", t1, t2);
+}
+
+/* 出堆密集：每轮压入 PARTITION_NUM * PARTITION_SIZE 个元素后全部弹出 */
+void benchPopHeavy() {
+    int n = PARTITION_NUM * PARTITION_SIZE;
+    long long sum1 = 0, sum2 = 0;
+    clock_t start;
+
+    srand(2);
+    start = clock();
+    MinHeap *minHeap = newMinHeap((int[]){0}, 0);
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int i = 0; i < n; i++) {
+            push(minHeap, rand());
+        }
+        while (!isEmpty(minHeap)) {
+            sum1 += pop(minHeap);
+        }
+    }
+    delMinHeap(minHeap);
+    double t1 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    srand(2);
+    start = clock();
+    PairingPool *pool = newPairingPool();
+    PairingHeap *pairingHeap = newPairingHeap(pool);
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (int i = 0; i < n; i++) {
+            pairingHeapPush(pairingHeap, rand());
+        }
+        while (!pairingHeapIsEmpty(pairingHeap)) {
+            sum2 += pairingHeapPop(pairingHeap);
+        }
+    }
+    delPairingHeap(pairingHeap);
+    delPairingPool(pool);
+    double t2 = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    assert(sum1 == sum2);
+    printf("出堆密集：MinHeap %.3f s, PairingHeap %.3f s\n", t1, t2);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    benchMeldHeavy();
+    benchPopHeavy();
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * @FileName    :radix_heap.c
+ * @Date        :2026-10-19 09:12:40
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :基数堆（radix heap），适用于单调整数优先级的小顶堆
+ * @Description :前提：出堆的优先级序列单调不减（如 Dijkstra 最短路、离散事件模拟），且优先级为非负整数。
+ *               记 last 为最近一次出堆的优先级，元素按 key 与 last 的“最高不同二进制位”放入桶中：
+ *                  桶 0 存放 key == last 的元素；桶 i (i >= 1) 存放最高不同位为第 i - 1 位的元素。
+ *               出堆时若桶 0 为空，则找到第一个非空桶 i ，以其中最小值作为新的 last ，
+ *               并将桶 i 的元素重新分配到更低的桶中。每个元素最多下沉 32 次，
+ *               因此 push 为 O(1) ，pop 为均摊 O(log C) ，C 为最大优先级与 last 的差值。
+ *               接口与 MinHeap 保持一致（push / pop / peek / size / isEmpty），
+ *               另提供带附加数据的 pushPair / popPair 版本，便于存储（距离，顶点）二元组。
+ */
+
+#include "../utils/common.h"
+
+// 桶的数量：桶 0 加上 32 个二进制位
+#define RADIX_BUCKET_NUM 33
+
+/* 基数堆元素 */
+typedef struct {
+    unsigned int key; // 优先级
+    int item;         // 附加数据（如顶点编号）
+} RadixHeapNode;
+
+/* 桶（动态数组） */
+typedef struct {
+    RadixHeapNode *nodes; // 元素数组
+    int size;             // 元素数量
+    int capacity;         // 数组容量
+} RadixBucket;
+
+/* 基数堆 */
+typedef struct {
+    RadixBucket buckets[RADIX_BUCKET_NUM]; // 桶数组
+    unsigned int last;                     // 最近一次出堆的优先级
+    int size;                              // 元素总数
+} RadixHeap;
+
+/* 构造函数 */
+RadixHeap *newRadixHeap() {
+    RadixHeap *heap = malloc(sizeof(RadixHeap));
+    for (int i = 0; i < RADIX_BUCKET_NUM; i++) {
+        heap->buckets[i].nodes = NULL;
+        heap->buckets[i].size = 0;
+        heap->buckets[i].capacity = 0;
+    }
+    heap->last = 0;
+    heap->size = 0;
+    return heap;
+}
+
+/* 析构函数 */
+void delRadixHeap(RadixHeap *heap) {
+    for (int i = 0; i < RADIX_BUCKET_NUM; i++) {
+        free(heap->buckets[i].nodes);
+    }
+    free(heap);
+}
+
+/* 计算 key 所属的桶：key 与 last 最高不同位的位置 + 1 */
+int radixBucketIndex(unsigned int key, unsigned int last) {
+    unsigned int diff = key ^ last;
+    return diff == 0 ? 0 : 32 - __builtin_clz(diff);
+}
+
+/* 向桶尾部添加元素，容量不足时两倍扩容 */
+void radixBucketAppend(RadixBucket *bucket, RadixHeapNode node) {
+    if (bucket->size == bucket->capacity) {
+        bucket->capacity = bucket->capacity == 0 ? 8 : bucket->capacity * 2;
+        bucket->nodes = realloc(bucket->nodes, bucket->capacity * sizeof(RadixHeapNode));
+    }
+    bucket->nodes[bucket->size++] = node;
+}
+
+/* 获取堆大小 */
+int radixHeapSize(RadixHeap *heap) {
+    return heap->size;
+}
+
+/* 判断堆是否为空 */
+bool radixHeapIsEmpty(RadixHeap *heap) {
+    return heap->size == 0;
+}
+
+/* 元素入堆（带附加数据） */
+void radixHeapPushPair(RadixHeap *heap, int key, int item) {
+    // 优先级必须非负，且不小于最近一次出堆的优先级
+    if (key < 0 || (unsigned int)key < heap->last) {
+        printf("Radix heap requires monotone non-negative keys!\n");
+        return;
+    }
+    RadixHeapNode node = {(unsigned int)key, item};
+    radixBucketAppend(&heap->buckets[radixBucketIndex(node.key, heap->last)], node);
+    heap->size++;
+}
+
+/* 元素入堆 */
+void radixHeapPush(RadixHeap *heap, int val) {
+    radixHeapPushPair(heap, val, val);
+}
+
+/* 保证桶 0 非空：找到第一个非空桶，以其最小值为新的 last 并重新分配 */
+void radixHeapPull(RadixHeap *heap) {
+    if (heap->buckets[0].size > 0) {
+        return;
+    }
+    int i = 1;
+    while (heap->buckets[i].size == 0) {
+        i++;
+    }
+    RadixBucket *bucket = &heap->buckets[i];
+    // 查找桶 i 中的最小优先级
+    unsigned int min = bucket->nodes[0].key;
+    for (int j = 1; j < bucket->size; j++) {
+        if (bucket->nodes[j].key < min) {
+            min = bucket->nodes[j].key;
+        }
+    }
+    heap->last = min;
+    // 桶 i 中所有元素与新 last 的最高不同位都低于 i - 1 ，因此必然落入更低的桶
+    for (int j = 0; j < bucket->size; j++) {
+        RadixHeapNode node = bucket->nodes[j];
+        radixBucketAppend(&heap->buckets[radixBucketIndex(node.key, min)], node);
+    }
+    bucket->size = 0;
+}
+
+/* 访问堆顶元素 */
+int radixHeapPeek(RadixHeap *heap) {
+    if (radixHeapIsEmpty(heap)) {
+        printf("Heap is empty!");
+        return INT_MAX;
+    }
+    radixHeapPull(heap);
+    return (int)heap->last;
+}
+
+/* 元素出堆（带附加数据），返回优先级 */
+int radixHeapPopPair(RadixHeap *heap, int *item) {
+    // 判空处理
+    if (radixHeapIsEmpty(heap)) {
+        printf("Heap is empty!");
+        return INT_MAX;
+    }
+    radixHeapPull(heap);
+    // 桶 0 中所有元素的优先级都等于 last ，从尾部取出即可
+    RadixBucket *bucket = &heap->buckets[0];
+    RadixHeapNode node = bucket->nodes[--bucket->size];
+    heap->size--;
+    if (item != NULL) {
+        *item = node.item;
+    }
+    return (int)node.key;
+}
+
+/* 元素出堆 */
+int radixHeapPop(RadixHeap *heap) {
+    return radixHeapPopPair(heap, NULL);
+}
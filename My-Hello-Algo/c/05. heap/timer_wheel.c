@@ -0,0 +1,328 @@
+/**
+ * @FileName    :timer_wheel.c
+ * @Date        :2026-10-19 15:21:54
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :分层时间轮（hierarchical timing wheel）+ 小顶堆实现的定时器队列
+ * @Description :时间以 tick 为单位。时间轮共 WHEEL_LEVELS 层，每层 WHEEL_SLOTS 个槽（每层对应过期时间的 WHEEL_BITS 位）。
+ *               将过期时间 expire 与当前时间 now 按 WHEEL_BITS 位一组划分为若干“位组”，
+ *               定时器放入 expire 与 now 最高不同位组所在的层，槽号为 expire 在该层的位组值（与基数堆的分桶思想相同）。
+ *               超出最高层范围的远期定时器放入小顶堆（按过期时间排序）。
+ *               1. 添加定时器：计算层与槽后插入槽内双向链表，O(1) ；远期定时器入堆 O(log n) 。
+ *               2. 取消定时器：从双向链表中摘除，O(1) ；堆中定时器 O(log n) 。
+ *               3. 推进时间：当时间跨过第 L 层的边界时，将第 L 层对应槽中的定时器重新分配到更低的层（级联）；
+ *                  跨过最高层的边界时，从堆中取出进入时间轮范围的定时器。
+ *                  第 0 层当前槽中的定时器全部到期，一次调用即可批量取出截至目标时间的所有到期定时器。
+ *                  每层用一个 64 位位图记录非空槽，推进时直接跳到下一个非空槽，空闲时间段无须逐 tick 扫描。
+ *               定时器结构体 Timer 由调用方分配（侵入式链表），时间轮本身不申请定时器内存。
+ *               timerWheelPoll 使用单调时钟驱动时间轮，tick 长度为 TIMER_TICK_MS 毫秒。
+ */
+
+#include "../utils/common.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+// 每层位数与槽数（槽数为 64 ，便于使用 64 位位图）
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+// 层数，时间轮覆盖 2^(WHEEL_BITS * WHEEL_LEVELS) 个 tick
+#define WHEEL_LEVELS 4
+// 位于堆中的定时器的层号
+#define TIMER_IN_HEAP WHEEL_LEVELS
+// 未添加的定时器的层号
+#define TIMER_IDLE -1
+// 单调时钟驱动时每个 tick 的毫秒数
+#define TIMER_TICK_MS 1
+
+/* 定时器（由调用方分配） */
+typedef struct Timer {
+    long long expire;   // 过期时间（tick）
+    void *data;         // 用户数据
+    struct Timer *prev; // 槽内前驱
+    struct Timer *next; // 槽内后继；批量到期时用于串联到期定时器
+    int level;          // 所在层，TIMER_IN_HEAP 表示在堆中，TIMER_IDLE 表示未添加
+    int heapIndex;      // 在堆数组中的索引
+} Timer;
+
+/* 时间轮 */
+typedef struct {
+    Timer *slots[WHEEL_LEVELS][WHEEL_SLOTS]; // 各层各槽的链表头
+    unsigned long long bitmap[WHEEL_LEVELS]; // 各层非空槽位图
+    Timer **heap;                            // 远期定时器小顶堆
+    int heapSize;                            // 堆大小
+    int heapCapacity;                        // 堆容量
+    long long now;                           // 下一个待处理的 tick
+    int size;                                // 定时器总数
+    long long startMs;                       // 单调时钟起点（毫秒）
+} TimerWheel;
+
+/* 获取单调时钟（毫秒） */
+long long monotonicMs() {
+#ifdef _WIN32
+    return (long long)GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+/* 构造函数 */
+TimerWheel *newTimerWheel() {
+    TimerWheel *tw = calloc(1, sizeof(TimerWheel));
+    tw->heapCapacity = 16;
+    tw->heap = malloc(sizeof(Timer *) * tw->heapCapacity);
+    tw->startMs = monotonicMs();
+    return tw;
+}
+
+/* 析构函数（定时器由调用方释放） */
+void delTimerWheel(TimerWheel *tw) {
+    free(tw->heap);
+    free(tw);
+}
+
+/* 初始化定时器 */
+void initTimer(Timer *timer, void *data) {
+    timer->data = data;
+    timer->prev = timer->next = NULL;
+    timer->level = TIMER_IDLE;
+    timer->heapIndex = -1;
+}
+
+/* 判断定时器是否已添加且尚未到期 */
+bool timerPending(Timer *timer) {
+    return timer->level != TIMER_IDLE;
+}
+
+/* 获取定时器数量 */
+int timerWheelSize(TimerWheel *tw) {
+    return tw->size;
+}
+
+/* ---------- 远期定时器小顶堆 ---------- */
+
+/* 交换堆中两个定时器并更新索引 */
+void timerHeapSwap(TimerWheel *tw, int i, int j) {
+    Timer *temp = tw->heap[i];
+    tw->heap[i] = tw->heap[j];
+    tw->heap[j] = temp;
+    tw->heap[i]->heapIndex = i;
+    tw->heap[j]->heapIndex = j;
+}
+
+/* 从节点 i 开始，从底至顶堆化 */
+void timerHeapSiftUp(TimerWheel *tw, int i) {
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (tw->heap[p]->expire <= tw->heap[i]->expire) {
+            break;
+        }
+        timerHeapSwap(tw, i, p);
+        i = p;
+    }
+}
+
+/* 从节点 i 开始，从顶至底堆化 */
+void timerHeapSiftDown(TimerWheel *tw, int i) {
+    while (true) {
+        int l = 2 * i + 1, r = 2 * i + 2, min = i;
+        if (l < tw->heapSize && tw->heap[l]->expire < tw->heap[min]->expire) {
+            min = l;
+        }
+        if (r < tw->heapSize && tw->heap[r]->expire < tw->heap[min]->expire) {
+            min = r;
+        }
+        if (min == i) {
+            break;
+        }
+        timerHeapSwap(tw, i, min);
+        i = min;
+    }
+}
+
+/* 定时器入堆 */
+void timerHeapPush(TimerWheel *tw, Timer *timer) {
+    if (tw->heapSize == tw->heapCapacity) {
+        tw->heapCapacity *= 2;
+        tw->heap = realloc(tw->heap, sizeof(Timer *) * tw->heapCapacity);
+    }
+    timer->level = TIMER_IN_HEAP;
+    timer->heapIndex = tw->heapSize;
+    tw->heap[tw->heapSize++] = timer;
+    timerHeapSiftUp(tw, timer->heapIndex);
+}
+
+/* 删除堆中索引为 i 的定时器 */
+void timerHeapRemove(TimerWheel *tw, int i) {
+    Timer *timer = tw->heap[i];
+    tw->heapSize--;
+    if (i != tw->heapSize) {
+        // 用堆尾元素填补，再向上或向下修复
+        tw->heap[i] = tw->heap[tw->heapSize];
+        tw->heap[i]->heapIndex = i;
+        timerHeapSiftUp(tw, i);
+        timerHeapSiftDown(tw, tw->heap[i]->heapIndex);
+    }
+    timer->heapIndex = -1;
+}
+
+/* ---------- 时间轮 ---------- */
+
+/* 定时器在第 level 层的槽号 */
+int timerSlot(long long expire, int level) {
+    return (int)((expire >> (level * WHEEL_BITS)) & WHEEL_MASK);
+}
+
+/* 将定时器放入对应的层和槽（不修改 size ） */
+void timerWheelPlace(TimerWheel *tw, Timer *timer) {
+    unsigned long long diff = (unsigned long long)(timer->expire ^ tw->now);
+    // expire 与 now 最高不同位所在的层
+    int level = diff == 0 ? 0 : (63 - __builtin_clzll(diff)) / WHEEL_BITS;
+    if (level >= WHEEL_LEVELS) {
+        timerHeapPush(tw, timer);
+        return;
+    }
+    int slot = timerSlot(timer->expire, level);
+    // 头插法插入槽内链表
+    timer->level = level;
+    timer->prev = NULL;
+    timer->next = tw->slots[level][slot];
+    if (timer->next != NULL) {
+        timer->next->prev = timer;
+    }
+    tw->slots[level][slot] = timer;
+    tw->bitmap[level] |= 1ULL << slot;
+}
+
+/* 添加定时器，expire 为过期时间（tick），早于当前时间的定时器在下一次推进时到期 */
+void timerWheelSchedule(TimerWheel *tw, Timer *timer, long long expire) {
+    if (timerPending(timer)) {
+        printf("Timer is already scheduled!\n");
+        return;
+    }
+    timer->expire = expire < tw->now ? tw->now : expire;
+    timerWheelPlace(tw, timer);
+    tw->size++;
+}
+
+/* 取消定时器 */
+void timerWheelCancel(TimerWheel *tw, Timer *timer) {
+    if (!timerPending(timer)) {
+        return;
+    }
+    if (timer->level == TIMER_IN_HEAP) {
+        timerHeapRemove(tw, timer->heapIndex);
+    } else {
+        int slot = timerSlot(timer->expire, timer->level);
+        // 从槽内双向链表中摘除
+        if (timer->prev != NULL) {
+            timer->prev->next = timer->next;
+        } else {
+            tw->slots[timer->level][slot] = timer->next;
+        }
+        if (timer->next != NULL) {
+            timer->next->prev = timer->prev;
+        }
+        if (tw->slots[timer->level][slot] == NULL) {
+            tw->bitmap[timer->level] &= ~(1ULL << slot);
+        }
+    }
+    timer->prev = timer->next = NULL;
+    timer->level = TIMER_IDLE;
+    tw->size--;
+}
+
+/* 取出第 level 层 slot 槽的整条链表 */
+Timer *timerWheelTakeSlot(TimerWheel *tw, int level, int slot) {
+    Timer *list = tw->slots[level][slot];
+    tw->slots[level][slot] = NULL;
+    tw->bitmap[level] &= ~(1ULL << slot);
+    return list;
+}
+
+/* 级联：now 恰好位于各层边界时，将高层对应槽中的定时器重新分配到低层 */
+void timerWheelCascade(TimerWheel *tw) {
+    // 跨过最高层边界：从堆中取出进入时间轮范围的定时器
+    long long top = tw->now >> (WHEEL_LEVELS * WHEEL_BITS);
+    if ((tw->now & ((1LL << (WHEEL_LEVELS * WHEEL_BITS)) - 1)) == 0) {
+        while (tw->heapSize > 0 && (tw->heap[0]->expire >> (WHEEL_LEVELS * WHEEL_BITS)) == top) {
+            Timer *timer = tw->heap[0];
+            timerHeapRemove(tw, 0);
+            timerWheelPlace(tw, timer);
+        }
+    }
+    // 从高层到低层依次级联
+    for (int level = WHEEL_LEVELS - 1; level >= 1; level--) {
+        if ((tw->now & ((1LL << (level * WHEEL_BITS)) - 1)) != 0) {
+            continue;
+        }
+        Timer *list = timerWheelTakeSlot(tw, level, timerSlot(tw->now, level));
+        while (list != NULL) {
+            Timer *next = list->next;
+            timerWheelPlace(tw, list);
+            list = next;
+        }
+    }
+}
+
+/* 计算下一个可能有事件（到期或级联）的 tick */
+long long timerWheelNextEvent(TimerWheel *tw) {
+    for (int level = 0; level < WHEEL_LEVELS; level++) {
+        int digit = timerSlot(tw->now, level);
+        // 当前位组之后的非空槽
+        unsigned long long rest = digit == WHEEL_MASK ? 0 : tw->bitmap[level] & (~0ULL << (digit + 1));
+        if (rest != 0) {
+            int slot = __builtin_ctzll(rest);
+            int shift = (level + 1) * WHEEL_BITS;
+            return ((tw->now >> shift) << shift) + ((long long)slot << (level * WHEEL_BITS));
+        }
+    }
+    // 时间轮为空：直接跳到堆顶定时器所在的最高层边界（堆中定时器进入时间轮），
+    // 中间的最高层边界都没有事件，无须逐个经过
+    if (tw->heapSize > 0) {
+        int shift = WHEEL_LEVELS * WHEEL_BITS;
+        return (tw->heap[0]->expire >> shift) << shift;
+    }
+    return LLONG_MAX;
+}
+
+/* 推进时间轮至 target（含），返回所有到期定时器组成的链表（通过 next 串联），按到期时间升序 */
+Timer *timerWheelAdvance(TimerWheel *tw, long long target) {
+    Timer *head = NULL, *tail = NULL;
+    while (tw->now <= target) {
+        timerWheelCascade(tw);
+        // 第 0 层当前槽中的定时器全部到期
+        Timer *list = timerWheelTakeSlot(tw, 0, timerSlot(tw->now, 0));
+        while (list != NULL) {
+            Timer *next = list->next;
+            list->prev = list->next = NULL;
+            list->level = TIMER_IDLE;
+            if (tail == NULL) {
+                head = list;
+            } else {
+                tail->next = list;
+            }
+            tail = list;
+            tw->size--;
+            list = next;
+        }
+        // 跳过没有任何事件的 tick
+        long long next = timerWheelNextEvent(tw);
+        tw->now = next > target + 1 ? target + 1 : next;
+    }
+    return head;
+}
+
+/* 当前单调时钟对应的 tick */
+long long timerWheelNowTick(TimerWheel *tw) {
+    return (monotonicMs() - tw->startMs) / TIMER_TICK_MS;
+}
+
+/* 按单调时钟推进时间轮，返回到期定时器链表 */
+Timer *timerWheelPoll(TimerWheel *tw) {
+    return timerWheelAdvance(tw, timerWheelNowTick(tw));
+}
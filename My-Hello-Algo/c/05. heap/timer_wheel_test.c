@@ -0,0 +1,214 @@
+/**
+ * @FileName    :timer_wheel_test.c
+ * @Date        :2026-10-19 15:21:54
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :分层时间轮测试程序
+ * @Description :1. 基本操作测试：添加、取消、批量到期、远期定时器、单调时钟驱动
+ *               2. 随机操作与暴力结果对比
+ *               3. 性能对比：纯小顶堆定时器队列 vs 时间轮，统计每次操作的平均耗时与内存占用
+ *                  默认定时器数量为 10^6 ，可通过 -DBENCH_TIMERS=10000000 测试 10^7 规模。
+ */
+
+#include "../utils/bench_util.h"
+#include "timer_wheel.c"
+
+#ifndef BENCH_TIMERS
+#define BENCH_TIMERS 1000000
+#endif
+// 性能测试中定时器过期时间的范围（tick）
+#define BENCH_RANGE (1 << 20)
+// 性能测试中每次推进的 tick 数
+#define BENCH_STEP 1000
+
+/* 打印到期定时器链表中的用户数据（整数编号） */
+int printExpired(Timer *list) {
+    int n = 0;
+    printf("[");
+    while (list != NULL) {
+        printf(n == 0 ? "%d" : ", %d", *(int *)list->data);
+        list = list->next;
+        n++;
+    }
+    printf("]\n");
+    return n;
+}
+
+/* 基本操作测试 */
+void testBasic() {
+    TimerWheel *tw = newTimerWheel();
+    int ids[] = {0, 1, 2, 3, 4, 5};
+    long long expires[] = {5, 3, 70, 5000, 1LL << 30, 3};
+    Timer timers[6];
+    for (int i = 0; i < 6; i++) {
+        initTimer(&timers[i], &ids[i]);
+        timerWheelSchedule(tw, &timers[i], expires[i]);
+    }
+    printf("定时器数量为 %d ，其中远期定时器 %d 个\n", timerWheelSize(tw), tw->heapSize);
+
+    /* 取消定时器 */
+    timerWheelCancel(tw, &timers[5]);
+    printf("取消定时器 5 后，定时器数量为 %d\n", timerWheelSize(tw));
+
+    /* 批量到期 */
+    printf("推进至 tick 10 ，到期定时器为 ");
+    printExpired(timerWheelAdvance(tw, 10));
+    printf("推进至 tick 10000 ，到期定时器为 ");
+    printExpired(timerWheelAdvance(tw, 10000));
+    // 只剩堆中的远期定时器：下一个事件直接是其所在的最高层边界
+    assert(timerWheelNextEvent(tw) == (1LL << 30));
+    printf("推进至 tick 2^30 ，到期定时器为 ");
+    printExpired(timerWheelAdvance(tw, 1LL << 30));
+    printf("定时器数量为 %d\n", timerWheelSize(tw));
+    delTimerWheel(tw);
+
+    /* 单调时钟驱动：添加 5 ms 后到期的定时器并轮询 */
+    // 时间轮的时间从构造时刻开始计算，因此使用新的时间轮
+    tw = newTimerWheel();
+    Timer timer;
+    int id = 100;
+    initTimer(&timer, &id);
+    timerWheelSchedule(tw, &timer, timerWheelNowTick(tw) + 5 / TIMER_TICK_MS);
+    Timer *list = NULL;
+    while (list == NULL) {
+        list = timerWheelPoll(tw);
+    }
+    printf("单调时钟驱动，到期定时器为 ");
+    printExpired(list);
+
+    delTimerWheel(tw);
+}
+
+/* 随机操作与暴力结果对比 */
+void testRandom() {
+    int n = 20000;
+    TimerWheel *tw = newTimerWheel();
+    Timer *timers = malloc(sizeof(Timer) * n);
+    int *ids = malloc(sizeof(int) * n);
+    bool *cancelled = calloc(n, sizeof(bool));
+    srand(2026);
+    for (int i = 0; i < n; i++) {
+        ids[i] = i;
+        initTimer(&timers[i], &ids[i]);
+        // 混合近期与远期定时器
+        long long expire = rand() % 3 == 0 ? (long long)rand() * 97 : rand() % 100000;
+        timerWheelSchedule(tw, &timers[i], expire);
+    }
+    for (int i = 0; i < n; i += 7) {
+        timerWheelCancel(tw, &timers[i]);
+        cancelled[i] = true;
+    }
+    // 按不规则步长推进，检查每个定时器恰好在过期时间到期
+    long long now = 0, last = -1;
+    int fired = 0;
+    while (timerWheelSize(tw) > 0) {
+        // 近期阶段小步推进，之后大步推进
+        now += rand() % 5000 + 1;
+        if (now >= 200000) {
+            now += (long long)rand() * 16;
+        }
+        for (Timer *t = timerWheelAdvance(tw, now); t != NULL; t = t->next) {
+            int i = *(int *)t->data;
+            assert(!cancelled[i]);
+            assert(t->expire > last && t->expire <= now);
+            fired++;
+        }
+        last = now;
+    }
+    assert(fired == n - (n + 6) / 7);
+    printf("随机测试通过：%d 个定时器到期，%d 个被取消\n", fired, (n + 6) / 7);
+    free(timers);
+    free(ids);
+    free(cancelled);
+    delTimerWheel(tw);
+}
+
+/* 计算耗时（纳秒 / 次） */
+double nsPerOp(clock_t start, int ops) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / ops;
+}
+
+/* 性能对比 */
+void testBenchmark() {
+    int n = BENCH_TIMERS;
+    Timer *timers = malloc(sizeof(Timer) * n);
+    long long *expires = malloc(sizeof(long long) * n);
+    srand(7);
+    for (int i = 0; i < n; i++) {
+        expires[i] = ((long long)rand() * RAND_MAX + rand()) % BENCH_RANGE;
+        initTimer(&timers[i], NULL);
+    }
+    printf("\n挂起定时器数量 %d ，过期时间范围 [0, %d)\n", n, BENCH_RANGE);
+    printf("%-10s %12s %12s %12s %14s\n", "", "添加(ns)", "取消(ns)", "到期(ns)", "内存(MB)");
+    clock_t start;
+
+    /* 纯小顶堆：所有定时器都放入堆中 */
+    TimerWheel *heapQueue = newTimerWheel();
+    start = clock();
+    for (int i = 0; i < n; i++) {
+        timers[i].expire = expires[i];
+        timerHeapPush(heapQueue, &timers[i]);
+    }
+    double heapAdd = nsPerOp(start, n);
+    start = clock();
+    for (int i = 0; i < n; i += 4) {
+        timerHeapRemove(heapQueue, timers[i].heapIndex);
+        timers[i].level = TIMER_IDLE;
+    }
+    double heapCancel = nsPerOp(start, (n + 3) / 4);
+    double heapMem = (sizeof(Timer) * (double)n + sizeof(Timer *) * (double)heapQueue->heapCapacity) / 1048576;
+    int heapFired = 0;
+    start = clock();
+    for (long long now = 0; now < BENCH_RANGE + BENCH_STEP; now += BENCH_STEP) {
+        // 逐个弹出堆顶
+        while (heapQueue->heapSize > 0 && heapQueue->heap[0]->expire <= now) {
+            Timer *t = heapQueue->heap[0];
+            timerHeapRemove(heapQueue, 0);
+            t->level = TIMER_IDLE;
+            heapFired++;
+        }
+    }
+    double heapExpire = nsPerOp(start, heapFired);
+    delTimerWheel(heapQueue);
+    printf("%-10s %12.1f %12.1f %12.1f %14.1f\n", "MinHeap", heapAdd, heapCancel, heapExpire, heapMem);
+
+    /* 分层时间轮 */
+    for (int i = 0; i < n; i++) {
+        initTimer(&timers[i], NULL);
+    }
+    TimerWheel *tw = newTimerWheel();
+    start = clock();
+    for (int i = 0; i < n; i++) {
+        timerWheelSchedule(tw, &timers[i], expires[i]);
+    }
+    double wheelAdd = nsPerOp(start, n);
+    start = clock();
+    for (int i = 0; i < n; i += 4) {
+        timerWheelCancel(tw, &timers[i]);
+    }
+    double wheelCancel = nsPerOp(start, (n + 3) / 4);
+    double wheelMem = (sizeof(Timer) * (double)n + sizeof(TimerWheel) + sizeof(Timer *) * (double)tw->heapCapacity) / 1048576;
+    int wheelFired = 0;
+    start = clock();
+    for (long long now = 0; now < BENCH_RANGE + BENCH_STEP; now += BENCH_STEP) {
+        // 一次调用批量取出所有到期定时器
+        for (Timer *t = timerWheelAdvance(tw, now); t != NULL; t = t->next) {
+            wheelFired++;
+        }
+    }
+    double wheelExpire = nsPerOp(start, wheelFired);
+    delTimerWheel(tw);
+    printf("%-10s %12.1f %12.1f %12.1f %14.1f\n", "TimerWheel", wheelAdd, wheelCancel, wheelExpire, wheelMem);
+
+    assert(heapFired == wheelFired);
+    free(timers);
+    free(expires);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testRandom", testRandom);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -19,41 +19,54 @@
 
 #include "../utils/common.h"
 
-// 假设节点最大数量为 100
+// 节点数组的初始容量，顶点数量超出时自动扩容
 #define MAX_SIZE 100
 
 /* 节点结构体 */
 typedef struct AdjListNode {
     Vertex *vertex;           // 顶点
+    int weight;               // 边权，无权图为 1
     struct AdjListNode *next; // 后继节点
 } AdjListNode;
 
 /* 基于邻接表实现的无向图类 */
 typedef struct
 {
-    AdjListNode *heads[MAX_SIZE]; // 节点数组
-    int size;                     // 节点数量
+    AdjListNode **heads; // 节点数组
+    int size;            // 节点数量
+    int capacity;        // 节点数组容量
+    bool weighted;       // 是否添加过带权边
 } GraphAdjList;
 
 /* 构造函数 */
 GraphAdjList *newGraphAdjList() {
     GraphAdjList *graph = malloc(sizeof(GraphAdjList));
     graph->size = 0;
-    for (int i = 0; i < MAX_SIZE; i++) {
-        graph->heads[i] = NULL;
-    }
+    graph->weighted = false;
+    graph->capacity = MAX_SIZE;
+    graph->heads = calloc(graph->capacity, sizeof(AdjListNode *));
     return graph;
 }
 
+/* 释放链表中的所有边节点 */
+void freeEdgeNodes(AdjListNode *head) {
+    AdjListNode *cur = head->next;
+    while (cur != NULL) {
+        AdjListNode *next = cur->next;
+        free(cur);
+        cur = next;
+    }
+    head->next = NULL;
+}
+
 /* 析构函数 */
 void delGraphAdjList(GraphAdjList *graph) {
     for (int i = 0; i < graph->size; i++) {
-        AdjListNode *pre = graph->heads[i];
-        AdjListNode *cur = pre->next;
-        free(cur);
-        graph->heads[i]->next = NULL;
+        freeEdgeNodes(graph->heads[i]);
         free(graph->heads[i]->vertex);
+        free(graph->heads[i]);
     }
+    free(graph->heads);
     free(graph);
 }
 
@@ -67,15 +80,21 @@ AdjListNode *findNode(GraphAdjList *graph, Vertex *vet) {
     return NULL;
 }
 
-/* 添加边辅助函数 */
-void addEdgeHelper(AdjListNode *head, Vertex *vet) {
+/* 添加带权边辅助函数 */
+void addWeightedEdgeHelper(AdjListNode *head, Vertex *vet, int weight) {
     AdjListNode *node = malloc(sizeof(AdjListNode));
     node->vertex = vet;
+    node->weight = weight;
     // 头插法
     node->next = head->next;
     head->next = node;
 }
 
+/* 添加边辅助函数 */
+void addEdgeHelper(AdjListNode *head, Vertex *vet) {
+    addWeightedEdgeHelper(head, vet, 1);
+}
+
 /* 添加边 */
 void addEdge(GraphAdjList *graph, Vertex *v1, Vertex *v2) {
     AdjListNode *h1 = findNode(graph, v1);
@@ -89,6 +108,20 @@ void addEdge(GraphAdjList *graph, Vertex *v1, Vertex *v2) {
     addEdgeHelper(h2, v1);
 }
 
+/* 添加带权边 */
+void addWeightedEdge(GraphAdjList *graph, Vertex *v1, Vertex *v2, int weight) {
+    AdjListNode *h1 = findNode(graph, v1);
+    AdjListNode *h2 = findNode(graph, v2);
+    if (h1 == NULL || h2 == NULL || h2 == h1) {
+        printf("Vertex dose not exist, or v1 and v2 is same!\n");
+        return;
+    }
+    // 添加边，无向图添加两条边
+    addWeightedEdgeHelper(h1, v2, weight);
+    addWeightedEdgeHelper(h2, v1, weight);
+    graph->weighted = true;
+}
+
 /* 删除边辅助函数 */
 void removeEdgeHelper(AdjListNode *head, Vertex *vet) {
     AdjListNode *pre = head;
@@ -122,11 +155,18 @@ void removeEdge(GraphAdjList *graph, Vertex *v1, Vertex *v2) {
 
 /* 添加顶点 */
 void addVertex(GraphAdjList *graph, Vertex *vet) {
-    if (graph == NULL || graph->size >= MAX_SIZE) {
-        printf("Graph is None or Full!\n");
+    if (graph == NULL) {
+        printf("Graph is None!\n");
+        return;
+    }
+    // 节点数组已满时容量翻倍
+    if (graph->size == graph->capacity) {
+        graph->capacity *= 2;
+        graph->heads = realloc(graph->heads, sizeof(AdjListNode *) * graph->capacity);
     }
     AdjListNode *head = malloc(sizeof(AdjListNode));
     head->vertex = vet;
+    head->weight = 0;
     head->next = NULL;
     // 在邻接表中添加一个新链表
     graph->heads[graph->size++] = head;
@@ -137,19 +177,13 @@ void removeVertex(GraphAdjList *graph, Vertex *vet) {
     AdjListNode *node = findNode(graph, vet);
     if (node == NULL) {
         printf("Vertex is not existent!\n");
+        return;
     }
-    // 在邻接表中依次删除顶点 vet 对应的链表
-    AdjListNode *cur = node, *pre = NULL;
-    while (cur != NULL) {
-        pre = cur;
-        cur = cur->next;
-        free(pre);
-    }
-    node->next = NULL;
+    // 删除顶点 vet 对应链表中的所有边节点
+    freeEdgeNodes(node);
     // 遍历其他顶点的链表，删除所有包含 vet 的边
     for (int i = 0; i < graph->size; i++) {
-        cur = graph->heads[i];
-        pre = NULL;
+        AdjListNode *cur = graph->heads[i], *pre = NULL;
         while (cur != NULL) {
             pre = cur;
             cur = pre->next;
@@ -171,6 +205,7 @@ void removeVertex(GraphAdjList *graph, Vertex *vet) {
         graph->heads[j] = graph->heads[j + 1];
     }
     graph->size--;
+    free(node);
     free(vet);
 }
 
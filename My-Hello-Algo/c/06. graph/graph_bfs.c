@@ -10,94 +10,97 @@
  *               2. 在循环的每轮迭代中，弹出队首顶点并记录访问，然后将该顶点的所有邻接顶点加入到队列尾部。
  *               3. 循环步骤 2. ，直到所有顶点被访问完毕后结束。
  *               为了防止重复遍历顶点，我们需要借助一个哈希集合 visited 来记录哪些节点已被访问。
- *              （C语言无内置哈希表，故使用循环从序列已访问中查找节点是否已经被访问）
  *               哈希集合可以看作一个只存储 key 而不存储 value 的哈希表，它可以在 O（1）时间复杂度下进行 key 的增删查改操作。根据 key 的唯一性，哈希集合通常用于数据去重等场景。
+ *               若在已访问序列中循环查找，并用 findNode 查找顶点的链表，每条边都需要 O(V) 时间，总复杂度退化为 O(V·E) 。
+ *               因此先将顶点映射为连续编号（VertexIndex），visited 使用按编号索引的时间戳数组（VisitedSet），
+ *               队列中存放编号并可自动扩容，通过 heads[id] 直接访问链表，总复杂度为 O(V + E) 。
  */
 
-#include "graph_adjacency_list.c"
+#include "vertex_index.c"
 
-// 假设节点最大数量为 100
-#define MAX_SIZE 100
-
-/* 节点队列结构体 */
+/* 顶点编号队列结构体（环形数组，满时自动扩容） */
 typedef struct
 {
-    Vertex *vertices[MAX_SIZE]; // 数组实现节点队列
-    int front, rear, size;      // 队首指针、队尾指针、队列长度
+    int *ids;                  // 环形数组
+    int front, size, capacity; // 队首指针、队列长度、容量
 } Queue;
 
 /* 构造函数 */
-Queue *newQueue() {
+Queue *newQueue(int capacity) {
     Queue *queue = malloc(sizeof(Queue));
-    queue->size = 0;
-    queue->front = queue->rear = 0;
+    queue->capacity = capacity < 1 ? 1 : capacity;
+    queue->ids = malloc(sizeof(int) * queue->capacity);
+    queue->front = queue->size = 0;
     return queue;
 }
 
+/* 析构函数 */
+void delQueue(Queue *queue) {
+    free(queue->ids);
+    free(queue);
+}
+
 /* 判断队列是否为空 */
 bool isEmpty(Queue *queue) {
     return queue->size == 0;
 }
 
 /* 入队操作 */
-void pushQueue(Queue *queue, Vertex *vet) {
-    queue->vertices[queue->rear] = vet;
-    queue->rear = (queue->rear + 1) % MAX_SIZE;
+void pushQueue(Queue *queue, int id) {
+    if (queue->size == queue->capacity) {
+        // 扩容为两倍，并将环形数组展开为从 0 开始的连续序列
+        int *ids = malloc(sizeof(int) * queue->capacity * 2);
+        for (int i = 0; i < queue->size; i++) {
+            ids[i] = queue->ids[(queue->front + i) % queue->capacity];
+        }
+        free(queue->ids);
+        queue->ids = ids;
+        queue->front = 0;
+        queue->capacity *= 2;
+    }
+    queue->ids[(queue->front + queue->size) % queue->capacity] = id;
     queue->size++;
 }
 
 /* 出队操作 */
-Vertex *pop(Queue *queue) {
-    Vertex *vet = queue->vertices[queue->front];
-    queue->front = (queue->front + 1) % MAX_SIZE;
+int pop(Queue *queue) {
+    int id = queue->ids[queue->front];
+    queue->front = (queue->front + 1) % queue->capacity;
     queue->size--;
-    return vet;
-}
-
-/* 检查顶点是否已被访问 */
-bool isVisited(Vertex **visited, int visitedSize, Vertex *vet) {
-    // 遍历查找节点，使用 O(n) 时间
-    for (int i = 0; i < visitedSize; i++) {
-        if (visited[i] == vet) {
-            return true;
-        }
-    }
-    return false;
+    return id;
 }
 
 /**
  * @brief  广度优先遍历
  * @param  graph        图
+ * @param  index        顶点编号
+ * @param  visited      已访问集合，函数开始时清空（O(1)），可在多次遍历间复用
  * @param  startVet     遍历起始节点
  * @param  result       遍历结果序列
  * @param  resSize      结果序列大小，同时控制元素添加位置
- * @param  visited      已访问过的节点数组
- * @param  visitedSize  已访问过的节点数组大小
- * @retval Vertex **result 遍历结果序列
  * @note   使用邻接表来表示图，以便获取指定顶点的所有邻接顶点
  */
-void graphBFS(GraphAdjList *graph, Vertex *startVet,
-              Vertex **result, int *resSize,
-              Vertex **visited, int *visitedSize) {
+void graphBFS(GraphAdjList *graph, VertexIndex *index, VisitedSet *visited,
+              Vertex *startVet, Vertex **result, int *resSize) {
+    visitedClear(visited);
     // 队列用于实现 BFS
-    Queue *queue = newQueue();
-    pushQueue(queue, startVet);
-    visited[(*visitedSize)++] = startVet;
+    Queue *queue = newQueue(MAX_SIZE);
+    int start = vertexId(index, startVet);
+    pushQueue(queue, start);
+    visitedMark(visited, start);
     // 以顶点 vet 为起点，循环直至访问完所有顶点
     while (!isEmpty(queue)) {
-        Vertex *vet = pop(queue);   // 队首顶点出队
-        result[(*resSize)++] = vet; // 记录访问顶点
+        AdjListNode *head = graph->heads[pop(queue)]; // 队首顶点出队
+        result[(*resSize)++] = head->vertex;          // 记录访问顶点
         // 遍历该顶点的所有邻接顶点
-        AdjListNode *node = findNode(graph, vet)->next;
-        while (node != NULL) {
-            if (!isVisited(visited, *visitedSize, node->vertex)) {
-                pushQueue(queue, node->vertex);
-                visited[(*visitedSize)++] = node->vertex;
+        for (AdjListNode *node = head->next; node != NULL; node = node->next) {
+            int id = vertexId(index, node->vertex);
+            if (visitedMark(visited, id)) {
+                pushQueue(queue, id);
             }
-            node = node->next;
         }
     }
-    free(queue);
+    delQueue(queue);
 }
 
 /* Driver Code */
@@ -123,14 +126,16 @@ int main() {
     // 顶点遍历序列
     Vertex *res[MAX_SIZE];
     int resSize = 0;
-    // 用于记录已被访问过的顶点
-    Vertex *visited[MAX_SIZE];
-    int visitedSize = 0;
-    graphBFS(graph, v[0], res, &resSize, visited, &visitedSize);
+    // 顶点编号与已访问集合
+    VertexIndex *index = newVertexIndex(graph);
+    VisitedSet *visited = newVisitedSet(graph->size);
+    graphBFS(graph, index, visited, v[0], res, &resSize);
     printf("\n广度优先遍历（BFS）顶点序列为\n");
     printArray(vetsToVals(res, resSize), resSize);
 
     // 释放内存
+    delVertexIndex(index);
+    delVisitedSet(visited);
     delGraphAdjList(graph);
     free(v);
     return 0;
@@ -0,0 +1,304 @@
+/**
+ * @FileName    :graph_bfs_do.c
+ * @Date        :2026-10-19 18:05:17
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :方向优化的并行广度优先遍历（direction-optimizing BFS）
+ * @Description :在 CSR 图上按层遍历，每一层在两种方向中选择代价更小的一种：
+ *               1. 自顶向下（top-down）：遍历当前层（frontier）每个顶点的邻接顶点，未访问的加入下一层。
+ *                  多线程时各线程处理 frontier 的一段，通过 CAS 设置 parent 认领顶点，新顶点写入线程私有缓冲区。
+ *               2. 自底向上（bottom-up）：遍历所有未访问顶点，在其邻接顶点中查找属于当前层的顶点，找到一个即可停止。
+ *                  当前层用位图表示，O(1) 判断；各线程按 64 对齐的顶点区间划分，写下一层位图无需原子操作。
+ *               低直径图（如社交网络）中间几层的 frontier 很大，top-down 会检查大量已访问顶点，
+ *               此时 bottom-up 的多数未访问顶点很快就能找到父节点，检查的边数大幅减少。
+ *               切换策略（Beamer）：mf 为 frontier 的边数，mu 为未访问顶点的边数，nf 为 frontier 的顶点数，
+ *                  top-down  -> bottom-up ：mf > mu / ALPHA
+ *                  bottom-up -> top-down  ：nf < n / BETA
+ *               工作线程在遍历开始时创建一次，每层之间用屏障（barrier）同步，高直径图（层数很多）也不会反复创建线程。
+ *               图需为无向图（bottom-up 需要入边，无向图的邻接顶点即为入边）。
+ *               结果：order 为访问顺序（按层排列），parent 为 BFS 树中的父顶点（起点为自身，未访问为 -1），level 为层数。
+ */
+
+#include <pthread.h>
+
+#include "graph_csr.c"
+
+// 切换参数
+#define DO_BFS_ALPHA 14
+#define DO_BFS_BETA 24
+
+/* 遍历方向 */
+typedef enum {
+    BFS_TOP_DOWN,
+    BFS_BOTTOM_UP
+} BFSDirection;
+
+/* 遍历状态（所有线程共享） */
+typedef struct {
+    GraphCSR *csr;
+    int *order, *parent, *level;
+    int front, rear;             // 当前层在 order 中的区间 [front, rear)
+    int depth;                   // 当前层的层数
+    unsigned long long *cur;     // 当前层位图
+    unsigned long long *next;    // 下一层位图
+    int threadNum;
+    BFSDirection direction;
+    pthread_barrier_t barrier;   // 每层开始与结束时同步所有线程
+    bool done;                   // 遍历是否结束（工作线程退出）
+} BFSState;
+
+/* 线程私有数据 */
+typedef struct {
+    BFSState *state;
+    int tid;
+    int *buf;             // 下一层顶点缓冲区
+    int bufSize, bufCap;
+    long long awakeEdges; // 下一层顶点的边数之和
+} BFSWorker;
+
+/* 向线程缓冲区添加顶点 */
+void bfsWorkerPush(BFSWorker *w, int v) {
+    if (w->bufSize == w->bufCap) {
+        w->bufCap *= 2;
+        w->buf = realloc(w->buf, sizeof(int) * w->bufCap);
+    }
+    w->buf[w->bufSize++] = v;
+}
+
+/* 自顶向下：处理 frontier 中属于本线程的一段 */
+void bfsTopDownStep(BFSWorker *w) {
+    BFSState *s = w->state;
+    GraphCSR *csr = s->csr;
+    long long len = s->rear - s->front;
+    int begin = s->front + (int)(len * w->tid / s->threadNum);
+    int end = s->front + (int)(len * (w->tid + 1) / s->threadNum);
+    for (int i = begin; i < end; i++) {
+        int u = s->order[i];
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int v = csr->neighbors[e];
+            int expected = -1;
+            // 先读后 CAS ，已访问的顶点只需一次普通的原子读
+            if (__atomic_load_n(&s->parent[v], __ATOMIC_RELAXED) == -1 &&
+                __atomic_compare_exchange_n(&s->parent[v], &expected, u, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                s->level[v] = s->depth + 1;
+                bfsWorkerPush(w, v);
+                w->awakeEdges += csrDegree(csr, v);
+            }
+        }
+    }
+}
+
+/* 自底向上：处理本线程负责的顶点区间（按位图的字划分）
+   区间内的 parent 只由本线程读写，且与 top-down 层之间有屏障分隔，无需原子操作 */
+void bfsBottomUpStep(BFSWorker *w) {
+    BFSState *s = w->state;
+    GraphCSR *csr = s->csr;
+    int words = (csr->vertexNum + 63) / 64;
+    int wBegin = (int)((long long)words * w->tid / s->threadNum);
+    int wEnd = (int)((long long)words * (w->tid + 1) / s->threadNum);
+    for (int wi = wBegin; wi < wEnd; wi++) {
+        unsigned long long bits = 0;
+        int vEnd = wi * 64 + 64 < csr->vertexNum ? wi * 64 + 64 : csr->vertexNum;
+        for (int v = wi * 64; v < vEnd; v++) {
+            if (s->parent[v] != -1) {
+                continue;
+            }
+            for (long long e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+                int u = csr->neighbors[e];
+                if (s->cur[u >> 6] >> (u & 63) & 1) {
+                    // 找到一个属于当前层的邻接顶点即可停止
+                    s->parent[v] = u;
+                    s->level[v] = s->depth + 1;
+                    bits |= 1ULL << (v & 63);
+                    bfsWorkerPush(w, v);
+                    w->awakeEdges += csrDegree(csr, v);
+                    break;
+                }
+            }
+        }
+        s->next[wi] = bits;
+    }
+}
+
+/* 按当前方向执行一层中本线程的部分 */
+void bfsWorkerStep(BFSWorker *w) {
+    if (w->state->direction == BFS_TOP_DOWN) {
+        bfsTopDownStep(w);
+    } else {
+        bfsBottomUpStep(w);
+    }
+}
+
+/* 工作线程（1 ~ threadNum - 1 号）主循环：等待主线程发布一层，执行后等待所有线程完成 */
+void *bfsWorkerLoop(void *arg) {
+    BFSWorker *w = arg;
+    BFSState *s = w->state;
+    for (;;) {
+        pthread_barrier_wait(&s->barrier);
+        if (s->done) {
+            return NULL;
+        }
+        bfsWorkerStep(w);
+        pthread_barrier_wait(&s->barrier);
+    }
+}
+
+/* 所有线程执行一层，主线程作为 0 号线程参与；单线程时直接调用 */
+void bfsRunLevel(BFSState *s, BFSWorker *workers) {
+    if (s->threadNum == 1) {
+        bfsWorkerStep(&workers[0]);
+        return;
+    }
+    pthread_barrier_wait(&s->barrier);
+    bfsWorkerStep(&workers[0]);
+    pthread_barrier_wait(&s->barrier);
+}
+
+/**
+ * @brief  方向优化的广度优先遍历
+ * @param  csr          无向图
+ * @param  source       起点编号
+ * @param  order        访问顺序，长度至少为顶点数量
+ * @param  parent       父顶点，长度为顶点数量
+ * @param  level        层数，长度为顶点数量，未访问的顶点为 -1
+ * @param  threadNum    线程数量
+ * @param  directions   每层使用的方向（可为 NULL），长度至少为层数
+ * @retval int          访问的顶点数量
+ */
+int csrBFSDirOpt(GraphCSR *csr, int source, int *order, int *parent, int *level,
+                 int threadNum, BFSDirection *directions) {
+    int n = csr->vertexNum;
+    int words = (n + 63) / 64;
+    if (threadNum < 1) {
+        threadNum = 1;
+    }
+    for (int v = 0; v < n; v++) {
+        parent[v] = -1;
+        level[v] = -1;
+    }
+    BFSState state = {.csr = csr, .order = order, .parent = parent, .level = level, .front = 0, .rear = 1, .depth = 0,
+                      .cur = calloc(words + 1, sizeof(unsigned long long)),
+                      .next = calloc(words + 1, sizeof(unsigned long long)),
+                      .threadNum = threadNum, .direction = BFS_TOP_DOWN, .done = false};
+    BFSWorker *workers = malloc(sizeof(BFSWorker) * threadNum);
+    for (int i = 0; i < threadNum; i++) {
+        workers[i] = (BFSWorker){&state, i, malloc(sizeof(int) * 1024), 0, 1024, 0};
+    }
+    pthread_t *tids = malloc(sizeof(pthread_t) * threadNum);
+    if (threadNum > 1) {
+        pthread_barrier_init(&state.barrier, NULL, threadNum);
+        for (int i = 1; i < threadNum; i++) {
+            pthread_create(&tids[i], NULL, bfsWorkerLoop, &workers[i]);
+        }
+    }
+    order[0] = source;
+    parent[source] = source;
+    level[source] = 0;
+    long long mf = csrDegree(csr, source);     // frontier 的边数
+    long long mu = csr->edgeNum - mf;          // 未访问顶点的边数
+    bool curValid = false;                     // 当前层位图是否与 frontier 一致
+    while (state.front < state.rear) {
+        int nf = state.rear - state.front;
+        /* 选择方向 */
+        if (state.direction == BFS_TOP_DOWN && mf > mu / DO_BFS_ALPHA) {
+            state.direction = BFS_BOTTOM_UP;
+        } else if (state.direction == BFS_BOTTOM_UP && nf < n / DO_BFS_BETA) {
+            state.direction = BFS_TOP_DOWN;
+        }
+        if (directions != NULL) {
+            directions[state.depth] = state.direction;
+        }
+        // 由 top-down 切换而来时，需由 frontier 重建当前层位图
+        if (state.direction == BFS_BOTTOM_UP && !curValid) {
+            memset(state.cur, 0, sizeof(unsigned long long) * words);
+            for (int i = state.front; i < state.rear; i++) {
+                state.cur[order[i] >> 6] |= 1ULL << (order[i] & 63);
+            }
+        }
+        /* 执行一层 */
+        for (int i = 0; i < threadNum; i++) {
+            workers[i].bufSize = 0;
+            workers[i].awakeEdges = 0;
+        }
+        bfsRunLevel(&state, workers);
+        /* 合并各线程缓冲区，作为下一层 */
+        int pos = state.rear;
+        mf = 0;
+        for (int i = 0; i < threadNum; i++) {
+            memcpy(order + pos, workers[i].buf, sizeof(int) * workers[i].bufSize);
+            pos += workers[i].bufSize;
+            mf += workers[i].awakeEdges;
+        }
+        mu -= mf;
+        if (state.direction == BFS_BOTTOM_UP) {
+            // 下一层位图已在本层写好，交换后直接作为当前层
+            unsigned long long *tmp = state.cur;
+            state.cur = state.next;
+            state.next = tmp;
+            curValid = true;
+        } else {
+            curValid = false;
+        }
+        state.front = state.rear;
+        state.rear = pos;
+        state.depth++;
+    }
+    if (threadNum > 1) {
+        // 通知工作线程退出
+        state.done = true;
+        pthread_barrier_wait(&state.barrier);
+        for (int i = 1; i < threadNum; i++) {
+            pthread_join(tids[i], NULL);
+        }
+        pthread_barrier_destroy(&state.barrier);
+    }
+    for (int i = 0; i < threadNum; i++) {
+        free(workers[i].buf);
+    }
+    free(workers);
+    free(tids);
+    free(state.cur);
+    free(state.next);
+    return state.rear;
+}
+
+/* 检查 BFS 结果：parent 构成合法的 BFS 树，且层数与串行 BFS 一致 */
+bool csrBFSValidate(GraphCSR *csr, int source, int *parent, int *level) {
+    int n = csr->vertexNum;
+    int *order = malloc(sizeof(int) * n);
+    int *expect = malloc(sizeof(int) * n);
+    for (int v = 0; v < n; v++) {
+        expect[v] = -1;
+    }
+    // 串行 BFS 计算标准层数
+    int front = 0, rear = 0;
+    order[rear++] = source;
+    expect[source] = 0;
+    while (front < rear) {
+        int u = order[front++];
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int v = csr->neighbors[e];
+            if (expect[v] == -1) {
+                expect[v] = expect[u] + 1;
+                order[rear++] = v;
+            }
+        }
+    }
+    bool ok = true;
+    for (int v = 0; v < n && ok; v++) {
+        if (level[v] != expect[v]) {
+            ok = false;
+        } else if (level[v] > 0) {
+            // 父顶点必须在上一层，且与 v 相邻
+            int p = parent[v];
+            bool adjacent = false;
+            for (long long e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+                adjacent |= csr->neighbors[e] == p;
+            }
+            ok = adjacent && level[p] == level[v] - 1;
+        }
+    }
+    free(order);
+    free(expect);
+    return ok;
+}
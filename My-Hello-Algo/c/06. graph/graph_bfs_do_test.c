@@ -0,0 +1,273 @@
+/**
+ * @FileName    :graph_bfs_do_test.c
+ * @Date        :2026-10-19 18:32:40
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :方向优化 BFS 测试程序
+ * @Description :1. 基本测试：小图上的访问顺序、父顶点与层数
+ *               2. 正确性：Kronecker 图上多个起点的结果与串行 BFS 对比（层数一致，父顶点合法）
+ *               3. 性能：Graph500 Kronecker 图（A = 0.57, B = C = 0.19, 边因子 16），
+ *                  对比串行 top-down BFS 与方向优化 BFS（1 线程 / 多线程）的 GTEPS 。
+ *                  TEPS 按 Graph500 的方式统计：起点所在连通分量中的无向边数 / 耗时。
+ *                  默认规模为 16 ~ 20 ，可通过 -DBENCH_SCALE_MIN=20 -DBENCH_SCALE_MAX=26 测试更大规模（需要约 20 GB 内存）。
+ *               4. 邻接表性能：随机图上对比线性查找 visited 与 findNode 的原始 BFS（O(V·E)）
+ *                  与顶点编号 + 时间戳 visited 的 BFS（O(V + E)），并在大图（默认 10^6 个顶点，
+ *                  -DBENCH_LIST_VERTICES 调整）上重复遍历，复用 visited 而无需清零。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_bfs_do.c"
+
+#ifndef BENCH_SCALE_MIN
+#define BENCH_SCALE_MIN 16
+#endif
+#ifndef BENCH_SCALE_MAX
+#define BENCH_SCALE_MAX 20
+#endif
+#define EDGE_FACTOR 16
+// 每个规模测试的起点数量
+#define BENCH_ROOTS 8
+// 多线程测试使用的线程数量
+#define BENCH_THREADS 4
+#ifndef BENCH_LIST_VERTICES
+#define BENCH_LIST_VERTICES 1000000
+#endif
+// 邻接表性能测试中随机图的平均度
+#define BENCH_DEGREE 8
+
+/* 生成 Kronecker 无向图：顶点数量 2^scale ，边数量 edgeFactor * 2^scale */
+GraphCSR *newKroneckerGraph(int scale, int edgeFactor, int threadNum) {
+    int *src, *dst;
+    long long m = genKroneckerEdges(scale, edgeFactor, scale, &src, &dst);
+    GraphCSR *csr = newGraphCSRFromEdges(1 << scale, src, dst, NULL, m, true, threadNum);
+    free(src);
+    free(dst);
+    return csr;
+}
+
+/* 基本测试 */
+void testBasic() {
+    // 与 graph_bfs.c 相同的 3 x 3 网格
+    int src[] = {0, 0, 1, 1, 2, 3, 3, 4, 4, 5, 6, 7};
+    int dst[] = {1, 3, 2, 4, 5, 4, 6, 5, 7, 8, 7, 8};
+    GraphCSR *csr = newGraphCSRFromEdges(9, src, dst, NULL, 12, true, 1);
+    int order[9], parent[9], level[9];
+    BFSDirection directions[9];
+    int cnt = csrBFSDirOpt(csr, 0, order, parent, level, 2, directions);
+    printf("访问顺序为 ");
+    printArray(order, cnt);
+    printf("父顶点为   ");
+    printArray(parent, 9);
+    printf("层数为     ");
+    printArray(level, 9);
+    assert(csrBFSValidate(csr, 0, parent, level));
+    delGraphCSR(csr);
+}
+
+/* 正确性：多个起点、多种线程数量 */
+void testValidate() {
+    GraphCSR *csr = newKroneckerGraph(14, EDGE_FACTOR, 1);
+    int n = csr->vertexNum;
+    int *order = malloc(sizeof(int) * n);
+    int *parent = malloc(sizeof(int) * n);
+    int *level = malloc(sizeof(int) * n);
+    for (int r = 0; r < 16; r++) {
+        int source = rand() % n;
+        int threadNum = r % 4 + 1;
+        csrBFSDirOpt(csr, source, order, parent, level, threadNum, NULL);
+        assert(csrBFSValidate(csr, source, parent, level));
+    }
+    printf("Kronecker 图（scale 14）上 16 个起点的结果均正确\n");
+    free(order);
+    free(parent);
+    free(level);
+    delGraphCSR(csr);
+}
+
+/* 统计已访问顶点的无向边数 */
+long long countTraversedEdges(GraphCSR *csr, int *order, int cnt) {
+    long long edges = 0;
+    for (int i = 0; i < cnt; i++) {
+        edges += csrDegree(csr, order[i]);
+    }
+    return edges / 2;
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    printf("\n%-6s %12s %14s %14s %14s\n", "scale", "边数", "串行 GTEPS", "DO-1 GTEPS", "DO-4 GTEPS");
+    for (int scale = BENCH_SCALE_MIN; scale <= BENCH_SCALE_MAX; scale++) {
+        GraphCSR *csr = newKroneckerGraph(scale, EDGE_FACTOR, BENCH_THREADS);
+        int n = csr->vertexNum;
+        int *order = malloc(sizeof(int) * n);
+        int *parent = malloc(sizeof(int) * n);
+        int *level = malloc(sizeof(int) * n);
+        double teps[3] = {0, 0, 0};
+        srand(1);
+        for (int r = 0; r < BENCH_ROOTS; r++) {
+            // 起点需有邻接顶点
+            int source;
+            do {
+                source = rand() % n;
+            } while (csrDegree(csr, source) == 0);
+            double start = wallSeconds();
+            int cnt = csrBFS(csr, source, order);
+            double t0 = wallSeconds() - start;
+            long long edges = countTraversedEdges(csr, order, cnt);
+            start = wallSeconds();
+            csrBFSDirOpt(csr, source, order, parent, level, 1, NULL);
+            double t1 = wallSeconds() - start;
+            start = wallSeconds();
+            csrBFSDirOpt(csr, source, order, parent, level, BENCH_THREADS, NULL);
+            double t2 = wallSeconds() - start;
+            // 取调和平均：累加每条边的耗时
+            teps[0] += t0 / edges;
+            teps[1] += t1 / edges;
+            teps[2] += t2 / edges;
+        }
+        printf("%-6d %12lld %14.3f %14.3f %14.3f\n", scale, csr->edgeNum / 2,
+               BENCH_ROOTS / teps[0] / 1e9, BENCH_ROOTS / teps[1] / 1e9, BENCH_ROOTS / teps[2] / 1e9);
+        free(order);
+        free(parent);
+        free(level);
+        delGraphCSR(csr);
+    }
+}
+
+/* 检查顶点是否已被访问（线性查找，仅用于性能对比） */
+bool isVisited(Vertex **visited, int visitedSize, Vertex *vet) {
+    // 遍历查找节点，使用 O(n) 时间
+    for (int i = 0; i < visitedSize; i++) {
+        if (visited[i] == vet) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* 广度优先遍历：线性查找 visited 与 findNode 的原始实现，O(V·E) ，仅用于性能对比 */
+void graphBFSLinear(GraphAdjList *graph, Vertex *startVet, Vertex **result, int *resSize) {
+    Vertex **visited = malloc(sizeof(Vertex *) * graph->size);
+    int visitedSize = 0;
+    Vertex **queue = malloc(sizeof(Vertex *) * graph->size);
+    int front = 0, rear = 0;
+    queue[rear++] = startVet;
+    visited[visitedSize++] = startVet;
+    while (front < rear) {
+        Vertex *vet = queue[front++];
+        result[(*resSize)++] = vet;
+        for (AdjListNode *node = findNode(graph, vet)->next; node != NULL; node = node->next) {
+            if (!isVisited(visited, visitedSize, node->vertex)) {
+                queue[rear++] = node->vertex;
+                visited[visitedSize++] = node->vertex;
+            }
+        }
+    }
+    free(visited);
+    free(queue);
+}
+
+/* 广度优先遍历：与 graph_bfs.c 中 graphBFS 相同，顶点编号 + 时间戳 visited ，队列为定长数组 */
+void graphBFSIndexed(GraphAdjList *graph, VertexIndex *index, VisitedSet *visited,
+                     Vertex *startVet, Vertex **result, int *resSize) {
+    visitedClear(visited);
+    int *queue = malloc(sizeof(int) * graph->size);
+    int front = 0, rear = 0;
+    queue[rear++] = vertexId(index, startVet);
+    visitedMark(visited, queue[0]);
+    while (front < rear) {
+        AdjListNode *head = graph->heads[queue[front++]];
+        result[(*resSize)++] = head->vertex;
+        for (AdjListNode *node = head->next; node != NULL; node = node->next) {
+            int id = vertexId(index, node->vertex);
+            if (visitedMark(visited, id)) {
+                queue[rear++] = id;
+            }
+        }
+    }
+    free(queue);
+}
+
+/* 建立 n 个顶点、平均度为 BENCH_DEGREE 的随机无向图 */
+GraphAdjList *newRandomGraph(int n) {
+    GraphAdjList *graph = newGraphAdjList();
+    for (int i = 0; i < n; i++) {
+        addVertex(graph, newVertex(i));
+    }
+    unsigned long long x = 2026;
+    long long m = (long long)n * BENCH_DEGREE / 2;
+    for (long long i = 0; i < m; i++) {
+        int u = randU32(&x) % n;
+        int v = randU32(&x) % n;
+        // 顶点编号已知，直接在对应链表中添加边，避免 addEdge 中 findNode 的线性查找
+        addEdgeHelper(graph->heads[u], graph->heads[v]->vertex);
+        addEdgeHelper(graph->heads[v], graph->heads[u]->vertex);
+    }
+    return graph;
+}
+
+/* 释放随机图（包括所有边节点） */
+void delRandomGraph(GraphAdjList *graph) {
+    for (int i = 0; i < graph->size; i++) {
+        AdjListNode *node = graph->heads[i];
+        free(node->vertex);
+        while (node != NULL) {
+            AdjListNode *next = node->next;
+            free(node);
+            node = next;
+        }
+    }
+    free(graph->heads);
+    free(graph);
+}
+
+/* 邻接表性能测试 */
+void testListBenchmark() {
+    /* 小规模图：原始实现 vs 编号 + 时间戳 */
+    GraphAdjList *graph = newRandomGraph(20000);
+    Vertex **res = malloc(sizeof(Vertex *) * graph->size);
+    int resSize = 0;
+    double start = wallSeconds();
+    graphBFSLinear(graph, graph->heads[0]->vertex, res, &resSize);
+    double t1 = wallSeconds() - start;
+    int linearSize = resSize;
+    VertexIndex *index = newVertexIndex(graph);
+    VisitedSet *visited = newVisitedSet(graph->size);
+    resSize = 0;
+    start = wallSeconds();
+    graphBFSIndexed(graph, index, visited, graph->heads[0]->vertex, res, &resSize);
+    double t2 = wallSeconds() - start;
+    assert(resSize == linearSize);
+    printf("%d 个顶点的随机图：线性查找 %.3f s, 顶点编号 + 时间戳 %.3f s\n", graph->size, t1, t2);
+    free(res);
+    delVertexIndex(index);
+    delVisitedSet(visited);
+    delRandomGraph(graph);
+
+    /* 大规模图：多次遍历复用 visited ，无需清零 */
+    graph = newRandomGraph(BENCH_LIST_VERTICES);
+    res = malloc(sizeof(Vertex *) * graph->size);
+    start = wallSeconds();
+    index = newVertexIndex(graph);
+    visited = newVisitedSet(graph->size);
+    printf("%d 个顶点的随机图：建立顶点编号 %.3f s\n", graph->size, wallSeconds() - start);
+    for (int round = 0; round < 3; round++) {
+        resSize = 0;
+        start = wallSeconds();
+        graphBFSIndexed(graph, index, visited, graph->heads[round]->vertex, res, &resSize);
+        printf("第 %d 次 BFS 访问 %d 个顶点，耗时 %.3f s\n", round + 1, resSize, wallSeconds() - start);
+    }
+    free(res);
+    delVertexIndex(index);
+    delVisitedSet(visited);
+    delRandomGraph(graph);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    runTest("testListBenchmark", testListBenchmark);
+    return 0;
+}
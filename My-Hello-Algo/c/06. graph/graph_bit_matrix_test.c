@@ -0,0 +1,268 @@
+/**
+ * @FileName    :graph_bit_matrix_test.c
+ * @Date        :2026-10-19 21:42:27
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :位矩阵图测试程序
+ * @Description :1. 基本操作测试：与 graph_adjacency_matrix.c 相同的操作序列（删除顶点改为 swap-with-last）
+ *               2. 随机操作（含扩容与删除顶点）与 int 矩阵暴力结果对比
+ *               3. 性能：稠密随机图（默认 10000 个顶点、边密度 5% ，可通过 -DBENCH_VERTICES / -DBENCH_DENSITY 调整）
+ *                  上的三角形计数与公共邻居查询，对比通用 / POPCNT / AVX2 实现，以及 CSR 上有序邻接表归并求交。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_bit_matrix.c"
+
+#ifndef BENCH_VERTICES
+#define BENCH_VERTICES 10000
+#endif
+// 边密度（百分比）
+#ifndef BENCH_DENSITY
+#define BENCH_DENSITY 5
+#endif
+
+/* 基本操作测试 */
+void testBasic() {
+    // 初始容量很小，添加顶点时会扩容
+    GraphBitMat *graph = newGraphBitMat(1);
+    int vertices[] = {1, 3, 2, 5, 4};
+    for (int i = 0; i < 5; i++) {
+        bitMatAddVertex(graph, vertices[i]);
+    }
+    int edges[][2] = {{0, 1}, {0, 3}, {1, 2}, {2, 3}, {2, 4}, {3, 4}};
+    for (int i = 0; i < 6; i++) {
+        bitMatAddEdge(graph, edges[i][0], edges[i][1]);
+    }
+    printf("\n初始化后，图为\n");
+    printGraphBitMat(graph);
+
+    /* 添加边 */
+    // 顶点 1, 2 的索引分别为 0, 2
+    bitMatAddEdge(graph, 0, 2);
+    printf("\n添加边 1-2 后，图为\n");
+    printGraphBitMat(graph);
+    printf("顶点 2 的度为 %d ，顶点 1 与顶点 5 的公共邻居数量为 %d ，三角形数量为 %lld\n",
+           bitMatDegree(graph, 2), bitMatCommonNeighbors(graph, 0, 3), bitMatTriangleCount(graph));
+
+    /* 删除边 */
+    // 顶点 1, 3 的索引分别为 0, 1
+    bitMatRemoveEdge(graph, 0, 1);
+    printf("\n删除边 1-3 后，图为\n");
+    printGraphBitMat(graph);
+
+    /* 添加顶点 */
+    bitMatAddVertex(graph, 6);
+    printf("\n添加顶点 6 后，图为\n");
+    printGraphBitMat(graph);
+
+    /* 删除顶点 */
+    // 顶点 3 的索引为 1 ，最后一个顶点 6 移动到索引 1
+    bitMatRemoveVertex(graph, 1);
+    printf("\n删除顶点 3 后，图为\n");
+    printGraphBitMat(graph);
+
+    delGraphBitMat(graph);
+}
+
+/* 随机操作与暴力结果对比 */
+void testRandom() {
+    int maxN = 300;
+    char *mat = calloc(maxN * maxN, 1);
+    int *vals = malloc(sizeof(int) * maxN);
+    int n = 0;
+    GraphBitMat *graph = newGraphBitMat(8);
+    srand(2026);
+    for (int op = 0; op < 200000; op++) {
+        int r = rand() % 100;
+        if (r < 3 && n < maxN) {
+            vals[n] = op;
+            bitMatAddVertex(graph, op);
+            n++;
+        } else if (r < 4 && n > 0) {
+            // 暴力删除：同样将最后一个顶点移动到 index
+            int index = rand() % n, last = n - 1;
+            for (int j = 0; j < n; j++) {
+                mat[index * maxN + j] = mat[last * maxN + j];
+                mat[j * maxN + index] = mat[j * maxN + last];
+            }
+            mat[index * maxN + index] = 0;
+            for (int j = 0; j < n; j++) {
+                mat[last * maxN + j] = mat[j * maxN + last] = 0;
+            }
+            vals[index] = vals[last];
+            bitMatRemoveVertex(graph, index);
+            n--;
+        } else if (n >= 2) {
+            int i = rand() % n, j = rand() % n;
+            if (i == j) {
+                continue;
+            }
+            bool add = r < 70;
+            mat[i * maxN + j] = mat[j * maxN + i] = add;
+            if (add) {
+                bitMatAddEdge(graph, i, j);
+            } else {
+                bitMatRemoveEdge(graph, i, j);
+            }
+        }
+    }
+    // 比较邻接关系、顶点值、公共邻居与三角形数量
+    assert(graph->size == n);
+    long long triangles = 0;
+    for (int i = 0; i < n; i++) {
+        assert(graph->vertices[i] == vals[i]);
+        for (int j = 0; j < n; j++) {
+            assert(bitMatHasEdge(graph, i, j) == mat[i * maxN + j]);
+            int common = 0;
+            for (int k = 0; k < n; k++) {
+                common += mat[i * maxN + k] && mat[j * maxN + k];
+                triangles += i < j && j < k && mat[i * maxN + j] && mat[i * maxN + k] && mat[j * maxN + k];
+            }
+            assert(bitMatCommonNeighbors(graph, i, j) == common);
+        }
+    }
+    assert(bitMatTriangleCount(graph) == triangles);
+    printf("\n随机测试通过：%d 个顶点，%lld 个三角形，容量扩展至 %d\n", n, triangles, graph->capacity);
+    free(mat);
+    free(vals);
+    delGraphBitMat(graph);
+}
+
+/* 有序数组归并求交计数 */
+int mergeIntersectCount(const int *a, int na, const int *b, int nb) {
+    int i = 0, j = 0, cnt = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (a[i] > b[j]) {
+            j++;
+        } else {
+            cnt++;
+            i++;
+            j++;
+        }
+    }
+    return cnt;
+}
+
+/* CSR 三角形计数：对每条边 (i, j)（i < j），归并求交 i 与 j 的大于 j 的邻居 */
+long long csrTriangleCount(long long *offsets, int *neighbors, int n) {
+    long long cnt = 0;
+    for (int i = 0; i < n; i++) {
+        for (long long e = offsets[i]; e < offsets[i + 1]; e++) {
+            int j = neighbors[e];
+            if (j <= i) {
+                continue;
+            }
+            // 邻接顶点升序，e + 1 之后即为大于 j 的部分
+            const int *a = neighbors + e + 1;
+            int na = (int)(offsets[i + 1] - e - 1);
+            const int *b = neighbors + offsets[j];
+            int nb = (int)(offsets[j + 1] - offsets[j]);
+            while (nb > 0 && *b <= j) {
+                b++;
+                nb--;
+            }
+            cnt += mergeIntersectCount(a, na, b, nb);
+        }
+    }
+    return cnt;
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_VERTICES;
+    GraphBitMat *graph = newGraphBitMat(n);
+    for (int i = 0; i < n; i++) {
+        bitMatAddVertex(graph, i);
+    }
+    srand(7);
+    long long m = 0;
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            if (rand() % 100 < BENCH_DENSITY) {
+                bitMatAddEdge(graph, i, j);
+                m++;
+            }
+        }
+    }
+    printf("\n稠密随机图：%d 个顶点，%lld 条边，位矩阵 %.1f MB（int 矩阵需 %.1f MB）\n", n, m,
+           (double)graph->capacity * graph->rowWords * 8 / 1048576, 4.0 * n * n / 1048576);
+
+    /* 由位矩阵生成 CSR（邻接顶点升序） */
+    long long *offsets = malloc(sizeof(long long) * (n + 1));
+    int *neighbors = malloc(sizeof(int) * (2 * m + 1));
+    offsets[0] = 0;
+    for (int i = 0; i < n; i++) {
+        long long pos = offsets[i];
+        for (int j = 0; j < n; j++) {
+            if (bitMatHasEdge(graph, i, j)) {
+                neighbors[pos++] = j;
+            }
+        }
+        offsets[i + 1] = pos;
+    }
+
+    /* 三角形计数 */
+    clock_t start = clock();
+    long long expect = csrTriangleCount(offsets, neighbors, n);
+    printf("%-16s 三角形 %lld 个，耗时 %.3f s\n", "CSR 归并求交", expect, (double)(clock() - start) / CLOCKS_PER_SEC);
+    const char *names[] = {"位矩阵 通用", "位矩阵 POPCNT", "位矩阵 AVX2"};
+    BitAndCountFunc funcs[3] = {bitAndCountGeneric, bitAndCountGeneric, bitAndCountGeneric};
+#ifdef BIT_MAT_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("popcnt")) {
+        funcs[1] = bitAndCountPopcnt;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        funcs[2] = bitAndCountAVX2;
+    }
+#endif
+    for (int k = 0; k < 3; k++) {
+        bitAndCount = funcs[k];
+        start = clock();
+        long long cnt = bitMatTriangleCount(graph);
+        assert(cnt == expect);
+        printf("%-16s 三角形 %lld 个，耗时 %.3f s\n", names[k], cnt, (double)(clock() - start) / CLOCKS_PER_SEC);
+    }
+
+    /* 公共邻居查询 */
+    int queries = 200000;
+    int *qs = malloc(sizeof(int) * 2 * queries);
+    for (int q = 0; q < 2 * queries; q++) {
+        qs[q] = rand() % n;
+    }
+    long long sumMerge = 0;
+    start = clock();
+    for (int q = 0; q < queries; q++) {
+        int i = qs[2 * q], j = qs[2 * q + 1];
+        sumMerge += mergeIntersectCount(neighbors + offsets[i], (int)(offsets[i + 1] - offsets[i]),
+                                        neighbors + offsets[j], (int)(offsets[j + 1] - offsets[j]));
+    }
+    printf("\n%d 次公共邻居查询：CSR 归并 %.3f s", queries, (double)(clock() - start) / CLOCKS_PER_SEC);
+    for (int k = 0; k < 3; k++) {
+        bitAndCount = funcs[k];
+        long long sum = 0;
+        start = clock();
+        for (int q = 0; q < queries; q++) {
+            sum += bitMatCommonNeighbors(graph, qs[2 * q], qs[2 * q + 1]);
+        }
+        assert(sum == sumMerge);
+        printf(", %s %.3f s", names[k], (double)(clock() - start) / CLOCKS_PER_SEC);
+    }
+    printf("\n");
+    bitAndCount = bitAndCountSelect();
+
+    free(qs);
+    free(offsets);
+    free(neighbors);
+    delGraphBitMat(graph);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testRandom", testRandom);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,286 @@
+/**
+ * @FileName    :graph_cc.c
+ * @Date        :2026-10-19 22:31:58
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :无向图的连通分量
+ * @Description :labels[v] 为顶点 v 所属连通分量的代表顶点，同一分量的顶点 labels 相同。
+ *               1. 邻接表 GraphAdjList ：通过顶点编号（VertexIndex）对每条边执行并查集合并，O((V + E) α(V)) 。
+ *               2. CSR 并查集：各线程处理一段顶点的边，使用无锁的并发合并。
+ *               3. Shiloach-Vishkin ：交替执行“挂接”与“跳跃”直到不再变化：
+ *                  挂接：对每条边 (u, v) ，若 comp[u] < comp[v] 且 comp[v] 为根，则将 comp[v] 挂到 comp[u] 下；
+ *                  跳跃：令每个顶点的 comp 指向根（comp[v] = comp[comp[v]] 直到不变）。
+ *                  每轮都需扫描所有边，轮数为 O(log V) 。
+ *               4. Afforest ：先对每个顶点只连接前 AFFOREST_ROUNDS 个邻居，此时大部分顶点已进入最大的分量；
+ *                  随机采样找出最大分量后，跳过属于该分量的顶点，只处理其余顶点的剩余边，
+ *                  在社交网络等存在巨型分量的图上可跳过绝大部分边。
+ *               并行版本中根始终为分量中编号最小的顶点，多线程通过 pthread 按顶点区间划分。
+ */
+
+#include <pthread.h>
+
+#include "graph_csr.c"
+#include "union_find.c"
+
+// Afforest 预先连接的邻居数量
+#define AFFOREST_ROUNDS 2
+// Afforest 寻找最大分量的采样数量
+#define AFFOREST_SAMPLES 1024
+
+/* 邻接表的连通分量，labels 按顶点在 heads 中的索引给出，返回分量数量 */
+int graphConnectedComponents(GraphAdjList *graph, int *labels) {
+    VertexIndex *index = newVertexIndex(graph);
+    DisjointSet *ds = newDisjointSet(graph->size);
+    for (int i = 0; i < graph->size; i++) {
+        for (AdjListNode *node = graph->heads[i]->next; node != NULL; node = node->next) {
+            dsUnion(ds, i, vertexId(index, node->vertex));
+        }
+    }
+    for (int i = 0; i < graph->size; i++) {
+        labels[i] = dsFind(ds, i);
+    }
+    int count = dsCount(ds);
+    delDisjointSet(ds);
+    delVertexIndex(index);
+    return count;
+}
+
+/* 并行任务：body 处理顶点区间 [begin, end) */
+typedef void (*CCBody)(void *ctx, int begin, int end);
+
+/* 线程参数 */
+typedef struct {
+    CCBody body;
+    void *ctx;
+    int begin, end;
+} CCTask;
+
+/* 线程函数 */
+void *ccTaskRun(void *arg) {
+    CCTask *t = arg;
+    t->body(t->ctx, t->begin, t->end);
+    return NULL;
+}
+
+/* 将 [0, n) 平均分给 threadNum 个线程执行 body */
+void ccParallelFor(int n, int threadNum, CCBody body, void *ctx) {
+    if (threadNum <= 1) {
+        body(ctx, 0, n);
+        return;
+    }
+    pthread_t tids[threadNum];
+    CCTask tasks[threadNum];
+    for (int i = 0; i < threadNum; i++) {
+        tasks[i] = (CCTask){body, ctx, (int)((long long)n * i / threadNum), (int)((long long)n * (i + 1) / threadNum)};
+        pthread_create(&tids[i], NULL, ccTaskRun, &tasks[i]);
+    }
+    for (int i = 0; i < threadNum; i++) {
+        pthread_join(tids[i], NULL);
+    }
+}
+
+/* 连通分量的共享上下文 */
+typedef struct {
+    GraphCSR *csr;
+    DisjointSet *ds;
+    int *comp;
+    int skip;    // Afforest 中跳过的分量（最大分量）
+    bool change; // Shiloach-Vishkin 本轮是否有挂接
+} CCContext;
+
+/* 统计分量数量：根满足 labels[v] == v */
+int ccCount(int *labels, int n) {
+    int count = 0;
+    for (int v = 0; v < n; v++) {
+        count += labels[v] == v;
+    }
+    return count;
+}
+
+/* 并发并查集：合并区间内顶点的所有边 */
+void ccUnionBody(void *arg, int begin, int end) {
+    CCContext *c = arg;
+    GraphCSR *csr = c->csr;
+    for (int u = begin; u < end; u++) {
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            // 无向图每条边存储两次，只处理一个方向
+            if (csr->neighbors[e] < u) {
+                dsUnionConcurrent(c->ds, u, csr->neighbors[e]);
+            }
+        }
+    }
+}
+
+/* 并发并查集：写出每个顶点的根 */
+void ccLabelBody(void *arg, int begin, int end) {
+    CCContext *c = arg;
+    for (int v = begin; v < end; v++) {
+        c->comp[v] = dsFindConcurrent(c->ds, v);
+    }
+}
+
+/* 基于并发并查集的连通分量，返回分量数量 */
+int csrCCUnionFind(GraphCSR *csr, int *labels, int threadNum) {
+    CCContext c = {csr, newDisjointSet(csr->vertexNum), labels, -1, false};
+    ccParallelFor(csr->vertexNum, threadNum, ccUnionBody, &c);
+    ccParallelFor(csr->vertexNum, threadNum, ccLabelBody, &c);
+    delDisjointSet(c.ds);
+    return ccCount(labels, csr->vertexNum);
+}
+
+/* 初始化：每个顶点自成一个分量 */
+void ccInitBody(void *arg, int begin, int end) {
+    CCContext *c = arg;
+    for (int v = begin; v < end; v++) {
+        c->comp[v] = v;
+    }
+}
+
+/* 跳跃：令 comp[v] 指向根 */
+void ccShortcutBody(void *arg, int begin, int end) {
+    int *comp = ((CCContext *)arg)->comp;
+    for (int v = begin; v < end; v++) {
+        int p = __atomic_load_n(&comp[v], __ATOMIC_RELAXED);
+        int gp = __atomic_load_n(&comp[p], __ATOMIC_RELAXED);
+        while (p != gp) {
+            p = gp;
+            gp = __atomic_load_n(&comp[p], __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(&comp[v], p, __ATOMIC_RELAXED);
+    }
+}
+
+/* Shiloach-Vishkin 挂接：对每条边尝试将较大的根挂到较小的分量下 */
+void ccHookBody(void *arg, int begin, int end) {
+    CCContext *c = arg;
+    GraphCSR *csr = c->csr;
+    int *comp = c->comp;
+    bool change = false;
+    for (int u = begin; u < end; u++) {
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int v = csr->neighbors[e];
+            int cu = __atomic_load_n(&comp[u], __ATOMIC_RELAXED);
+            int cv = __atomic_load_n(&comp[v], __ATOMIC_RELAXED);
+            // 只有根才能被挂接，CAS 保证同一根只被一个线程挂接
+            if (cu < cv && __atomic_compare_exchange_n(&comp[cv], &cv, cu, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                change = true;
+            }
+        }
+    }
+    if (change) {
+        __atomic_store_n(&c->change, true, __ATOMIC_RELAXED);
+    }
+}
+
+/* Shiloach-Vishkin 连通分量，返回分量数量 */
+int csrCCShiloachVishkin(GraphCSR *csr, int *labels, int threadNum) {
+    CCContext c = {csr, NULL, labels, -1, true};
+    ccParallelFor(csr->vertexNum, threadNum, ccInitBody, &c);
+    while (c.change) {
+        c.change = false;
+        ccParallelFor(csr->vertexNum, threadNum, ccHookBody, &c);
+        ccParallelFor(csr->vertexNum, threadNum, ccShortcutBody, &c);
+    }
+    return ccCount(labels, csr->vertexNum);
+}
+
+/* Afforest 连接：将 u 与 v 所在的树合并，编号较大的根挂到编号较小的根下 */
+void afforestLink(int *comp, int u, int v) {
+    int p1 = __atomic_load_n(&comp[u], __ATOMIC_RELAXED);
+    int p2 = __atomic_load_n(&comp[v], __ATOMIC_RELAXED);
+    while (p1 != p2) {
+        int high = p1 > p2 ? p1 : p2, low = p1 + p2 - high;
+        int pHigh = __atomic_load_n(&comp[high], __ATOMIC_RELAXED);
+        // 已经挂接
+        if (pHigh == low) {
+            break;
+        }
+        if (pHigh == high && __atomic_compare_exchange_n(&comp[high], &pHigh, low, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
+        }
+        // high 已不是根，沿树上移后重试
+        p1 = __atomic_load_n(&comp[__atomic_load_n(&comp[high], __ATOMIC_RELAXED)], __ATOMIC_RELAXED);
+        p2 = __atomic_load_n(&comp[low], __ATOMIC_RELAXED);
+    }
+}
+
+/* Afforest 轮次参数：本轮只连接每个顶点的第 round 个邻居 */
+typedef struct {
+    CCContext *c;
+    int round;
+} AfforestRound;
+
+/* Afforest 连接第 round 个邻居 */
+void afforestRoundBody(void *arg, int begin, int end) {
+    AfforestRound *r = arg;
+    GraphCSR *csr = r->c->csr;
+    for (int u = begin; u < end; u++) {
+        long long e = csr->offsets[u] + r->round;
+        if (e < csr->offsets[u + 1]) {
+            afforestLink(r->c->comp, u, csr->neighbors[e]);
+        }
+    }
+}
+
+/* Afforest 处理非最大分量顶点的剩余边 */
+void afforestFinishBody(void *arg, int begin, int end) {
+    CCContext *c = arg;
+    GraphCSR *csr = c->csr;
+    for (int u = begin; u < end; u++) {
+        if (__atomic_load_n(&c->comp[u], __ATOMIC_RELAXED) == c->skip) {
+            continue;
+        }
+        for (long long e = csr->offsets[u] + AFFOREST_ROUNDS; e < csr->offsets[u + 1]; e++) {
+            afforestLink(c->comp, u, csr->neighbors[e]);
+        }
+    }
+}
+
+/* 升序比较函数 */
+int ccCmpInt(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/* 随机采样，返回出现次数最多的分量 */
+int afforestSampleFrequent(int *comp, int n) {
+    int samples[AFFOREST_SAMPLES];
+    unsigned seed = 2026;
+    for (int i = 0; i < AFFOREST_SAMPLES; i++) {
+        seed = seed * 1103515245 + 12345;
+        samples[i] = comp[(seed >> 1) % n];
+    }
+    // 排序后统计最长的相同段
+    qsort(samples, AFFOREST_SAMPLES, sizeof(int), ccCmpInt);
+    int best = samples[0], bestCnt = 0;
+    for (int i = 0, j; i < AFFOREST_SAMPLES; i = j) {
+        for (j = i; j < AFFOREST_SAMPLES && samples[j] == samples[i]; j++) {
+        }
+        if (j - i > bestCnt) {
+            bestCnt = j - i;
+            best = samples[i];
+        }
+    }
+    return best;
+}
+
+/* Afforest 连通分量，返回分量数量 */
+int csrCCAfforest(GraphCSR *csr, int *labels, int threadNum) {
+    int n = csr->vertexNum;
+    CCContext c = {csr, NULL, labels, -1, false};
+    if (n == 0) {
+        return 0;
+    }
+    ccParallelFor(n, threadNum, ccInitBody, &c);
+    /* 1. 每个顶点先连接前 AFFOREST_ROUNDS 个邻居 */
+    for (int round = 0; round < AFFOREST_ROUNDS; round++) {
+        AfforestRound r = {&c, round};
+        ccParallelFor(n, threadNum, afforestRoundBody, &r);
+        ccParallelFor(n, threadNum, ccShortcutBody, &c);
+    }
+    /* 2. 采样找出最大分量，跳过其中的顶点 */
+    c.skip = afforestSampleFrequent(labels, n);
+    ccParallelFor(n, threadNum, afforestFinishBody, &c);
+    ccParallelFor(n, threadNum, ccShortcutBody, &c);
+    return ccCount(labels, n);
+}
@@ -0,0 +1,215 @@
+/**
+ * @FileName    :graph_cc_test.c
+ * @Date        :2026-10-19 22:48:03
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :并查集与连通分量测试程序
+ * @Description :1. 基本测试：并查集的合并与查询，邻接表的连通分量
+ *               2. 正确性：随机稀疏图（含巨型分量与大量小分量）上，并发并查集、Shiloach-Vishkin 、Afforest
+ *                  在 1 ~ 4 线程下的分量划分与串行并查集一致
+ *               3. 性能：随机图（默认 10^6 个顶点、10^7 条无向边，可通过 -DBENCH_VERTICES / -DBENCH_EDGES 调整，
+ *                  例如 -DBENCH_EDGES=100000000 测试 10^8 条边）上，对比逐个顶点 BFS 标记、串行并查集，
+ *                  以及三种并行算法在 1 / 2 / 4 / 8 线程下的耗时。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_cc.c"
+
+#ifndef BENCH_VERTICES
+#define BENCH_VERTICES 1000000
+#endif
+#ifndef BENCH_EDGES
+#define BENCH_EDGES 10000000LL
+#endif
+
+/* 生成 n 个顶点、m 条边的随机无向图 */
+GraphCSR *newRandomCSR(int n, long long m, unsigned seed) {
+    int *src = malloc(sizeof(int) * m), *dst = malloc(sizeof(int) * m);
+    unsigned long long x = seed * 0x9E3779B97F4A7C15ULL + 1;
+    for (long long i = 0; i < m; i++) {
+        // xorshift64
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        src[i] = (int)(x % n);
+        dst[i] = (int)((x >> 32) % n);
+    }
+    GraphCSR *csr = newGraphCSRFromEdges(n, src, dst, NULL, m, true, 1);
+    free(src);
+    free(dst);
+    return csr;
+}
+
+/* 基准：从每个未标记的顶点出发 BFS ，将到达的顶点标记为该顶点，返回分量数量 */
+int csrCCBFS(GraphCSR *csr, int *labels, int *queue) {
+    int n = csr->vertexNum, count = 0;
+    for (int v = 0; v < n; v++) {
+        labels[v] = -1;
+    }
+    for (int s = 0; s < n; s++) {
+        if (labels[s] != -1) {
+            continue;
+        }
+        count++;
+        int front = 0, rear = 0;
+        queue[rear++] = s;
+        labels[s] = s;
+        while (front < rear) {
+            int v = queue[front++];
+            for (long long e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+                int u = csr->neighbors[e];
+                if (labels[u] == -1) {
+                    labels[u] = s;
+                    queue[rear++] = u;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+/* 串行并查集求连通分量 */
+int csrCCSequential(GraphCSR *csr, int *labels) {
+    DisjointSet *ds = newDisjointSet(csr->vertexNum);
+    for (int u = 0; u < csr->vertexNum; u++) {
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            dsUnion(ds, u, csr->neighbors[e]);
+        }
+    }
+    for (int v = 0; v < csr->vertexNum; v++) {
+        labels[v] = dsFind(ds, v);
+    }
+    int count = dsCount(ds);
+    delDisjointSet(ds);
+    return count;
+}
+
+/* 将分量代表统一为分量中编号最小的顶点，buf 为长度 n 的辅助数组 */
+void normalizeLabels(int *labels, int n, int *buf) {
+    for (int v = 0; v < n; v++) {
+        buf[v] = -1;
+    }
+    // 按编号升序，第一个遇到的顶点即为分量中最小的顶点
+    for (int v = 0; v < n; v++) {
+        if (buf[labels[v]] == -1) {
+            buf[labels[v]] = v;
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        labels[v] = buf[labels[v]];
+    }
+}
+
+/* 基本测试 */
+void testBasic() {
+    /* 并查集 */
+    DisjointSet *ds = newDisjointSet(8);
+    dsUnion(ds, 0, 1);
+    dsUnion(ds, 2, 3);
+    dsUnion(ds, 1, 3);
+    dsUnion(ds, 5, 6);
+    printf("合并 (0, 1), (2, 3), (1, 3), (5, 6) 后，集合数量为 %d\n", dsCount(ds));
+    printf("0 与 2 %s同一集合，0 与 5 %s同一集合\n",
+           dsConnected(ds, 0, 2) ? "在" : "不在", dsConnected(ds, 0, 5) ? "在" : "不在");
+    assert(dsCount(ds) == 4 && dsConnected(ds, 0, 2) && !dsConnected(ds, 0, 5));
+    assert(!dsUnion(ds, 0, 3));
+    delDisjointSet(ds);
+
+    /* 邻接表的连通分量 */
+    int vals[] = {1, 3, 2, 5, 4, 6, 7};
+    int size = sizeof(vals) / sizeof(vals[0]);
+    Vertex **v = valsToVets(vals, size);
+    GraphAdjList *graph = newGraphAdjList();
+    for (int i = 0; i < size; i++) {
+        addVertex(graph, v[i]);
+    }
+    addEdge(graph, v[0], v[1]);
+    addEdge(graph, v[1], v[2]);
+    addEdge(graph, v[3], v[4]);
+    printf("\n图为\n");
+    printGraph(graph);
+    int labels[7];
+    int count = graphConnectedComponents(graph, labels);
+    printf("连通分量数量为 %d ，各顶点所属分量的代表顶点为 ", count);
+    for (int i = 0; i < size; i++) {
+        printf(i == 0 ? "[%d" : ", %d", graph->heads[labels[i]]->vertex->val);
+    }
+    printf("]\n");
+    assert(count == 4 && labels[0] == labels[2] && labels[3] == labels[4] && labels[0] != labels[3]);
+    delGraphAdjList(graph);
+    free(v);
+}
+
+/* 正确性：各算法与串行并查集结果一致 */
+void testValidate() {
+    typedef int (*CCFunc)(GraphCSR *, int *, int);
+    CCFunc funcs[] = {csrCCUnionFind, csrCCShiloachVishkin, csrCCAfforest};
+    int ns[] = {1, 2, 100, 5000, 60000};
+    for (int i = 0; i < 5; i++) {
+        int n = ns[i];
+        // 平均度约为 1.2 ，既有巨型分量也有大量孤立顶点与小分量
+        GraphCSR *csr = newRandomCSR(n, (long long)n * 6 / 10, i + 1);
+        int *expect = malloc(sizeof(int) * n), *labels = malloc(sizeof(int) * n), *buf = malloc(sizeof(int) * n);
+        int count = csrCCSequential(csr, expect);
+        normalizeLabels(expect, n, buf);
+        for (int k = 0; k < 3; k++) {
+            for (int threadNum = 1; threadNum <= 4; threadNum++) {
+                assert(funcs[k](csr, labels, threadNum) == count);
+                // 并行版本的根即为最小编号顶点，无需规范化
+                assert(memcmp(labels, expect, sizeof(int) * n) == 0);
+            }
+        }
+        free(expect);
+        free(labels);
+        free(buf);
+        delGraphCSR(csr);
+    }
+    printf("随机图上并发并查集、Shiloach-Vishkin 、Afforest 与串行并查集结果一致\n");
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_VERTICES;
+    double start = wallSeconds();
+    GraphCSR *csr = newRandomCSR(n, BENCH_EDGES, 2026);
+    printf("\n随机图：%d 个顶点，%lld 条无向边，生成耗时 %.3f s\n", n, csr->edgeNum / 2, wallSeconds() - start);
+    int *expect = malloc(sizeof(int) * n), *labels = malloc(sizeof(int) * n), *buf = malloc(sizeof(int) * n);
+
+    start = wallSeconds();
+    int count = csrCCBFS(csr, expect, buf);
+    printf("%-28s %.3f s ，分量数量 %d\n", "逐个顶点 BFS", wallSeconds() - start, count);
+    normalizeLabels(expect, n, buf);
+
+    start = wallSeconds();
+    assert(csrCCSequential(csr, labels) == count);
+    printf("%-28s %.3f s\n", "串行并查集", wallSeconds() - start);
+    normalizeLabels(labels, n, buf);
+    assert(memcmp(labels, expect, sizeof(int) * n) == 0);
+
+    typedef int (*CCFunc)(GraphCSR *, int *, int);
+    CCFunc funcs[] = {csrCCUnionFind, csrCCShiloachVishkin, csrCCAfforest};
+    const char *names[] = {"并发并查集", "Shiloach-Vishkin", "Afforest"};
+    for (int k = 0; k < 3; k++) {
+        printf("%-24s", names[k]);
+        for (int threadNum = 1; threadNum <= 8; threadNum *= 2) {
+            start = wallSeconds();
+            assert(funcs[k](csr, labels, threadNum) == count);
+            printf("  %d 线程 %.3f s", threadNum, wallSeconds() - start);
+            assert(memcmp(labels, expect, sizeof(int) * n) == 0);
+        }
+        printf("\n");
+    }
+
+    free(expect);
+    free(labels);
+    free(buf);
+    delGraphCSR(csr);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
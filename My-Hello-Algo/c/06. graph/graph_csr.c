@@ -0,0 +1,240 @@
+/**
+ * @FileName    :graph_csr.c
+ * @Date        :2026-10-19 16:40:12
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :基于压缩稀疏行（CSR, compressed sparse row）的图
+ * @Description :顶点使用 0 ~ n-1 的连续编号，所有边按起点顺序存放在一个数组中：
+ *                  offsets[n + 1]  ：顶点 i 的邻接顶点位于 neighbors[offsets[i], offsets[i + 1]) ；
+ *                  neighbors[m]    ：邻接顶点编号（int32）；
+ *                  weights[m]      ：边权（可选，为 NULL 表示无权图）。
+ *               与邻接表相比，CSR 没有逐节点的 malloc 和指针，遍历邻接顶点就是顺序扫描一段连续内存，
+ *               空间为 O(n + m) ；代价是图结构建成后只读。
+ *               批量建图（计数排序）：
+ *                  1. 统计每个顶点的出度；2. 前缀和得到 offsets ；3. 按起点将边分配到对应区间。
+ *               多线程建图时，各线程按边分段分别完成第 1、3 步，结果与单线程完全相同。
+ *               graphAdjListToCSR 可将邻接表 GraphAdjList 转换为 CSR ，vertices 保存编号到顶点的映射。
+ */
+
+#include <pthread.h>
+
+#include "vertex_index.c"
+
+/* 基于 CSR 的图 */
+typedef struct {
+    int vertexNum;      // 顶点数量
+    long long edgeNum;  // 有向边数量（无向图每条边计两次）
+    long long *offsets; // 邻接区间起点，长度为 vertexNum + 1
+    int *neighbors;     // 邻接顶点编号，长度为 edgeNum
+    int *weights;       // 边权，长度为 edgeNum ，无权图为 NULL
+    Vertex **vertices;  // 编号到原顶点的映射，由边表建图时为 NULL
+} GraphCSR;
+
+/* 析构函数（不释放原顶点） */
+void delGraphCSR(GraphCSR *csr) {
+    free(csr->offsets);
+    free(csr->neighbors);
+    free(csr->weights);
+    free(csr->vertices);
+    free(csr);
+}
+
+/* 获取顶点 v 的度 */
+int csrDegree(GraphCSR *csr, int v) {
+    return (int)(csr->offsets[v + 1] - csr->offsets[v]);
+}
+
+/* 获取顶点 v 的邻接顶点数组，数组长度为 csrDegree(csr, v) */
+int *csrNeighbors(GraphCSR *csr, int v) {
+    return csr->neighbors + csr->offsets[v];
+}
+
+/* 建图线程参数 */
+typedef struct {
+    GraphCSR *csr;
+    int *src, *dst, *weights;
+    long long begin, end; // 负责的边区间 [begin, end)
+    bool undirected;
+    long long *cursor;    // 本线程在各顶点邻接区间中的写入位置，统计阶段暂存度
+    int phase;            // 0：统计度；1：分配边
+} CSRBuildTask;
+
+/* 建图线程函数：只读写本线程的 cursor ，无需原子操作 */
+void *csrBuildWorker(void *arg) {
+    CSRBuildTask *t = arg;
+    long long *cursor = t->cursor;
+    if (t->phase == 0) {
+        for (long long i = t->begin; i < t->end; i++) {
+            cursor[t->src[i]]++;
+            if (t->undirected) {
+                cursor[t->dst[i]]++;
+            }
+        }
+        return NULL;
+    }
+    int *neighbors = t->csr->neighbors, *weights = t->csr->weights;
+    for (long long i = t->begin; i < t->end; i++) {
+        int u = t->src[i], v = t->dst[i];
+        long long pos = cursor[u]++;
+        neighbors[pos] = v;
+        if (weights != NULL) {
+            weights[pos] = t->weights[i];
+        }
+        if (t->undirected) {
+            pos = cursor[v]++;
+            neighbors[pos] = u;
+            if (weights != NULL) {
+                weights[pos] = t->weights[i];
+            }
+        }
+    }
+    return NULL;
+}
+
+/* 执行建图的某一阶段，单线程时直接调用 */
+void csrRunPhase(CSRBuildTask *tasks, int threadNum, int phase) {
+    if (threadNum == 1) {
+        tasks[0].phase = phase;
+        csrBuildWorker(&tasks[0]);
+        return;
+    }
+    pthread_t *tids = malloc(sizeof(pthread_t) * threadNum);
+    for (int i = 0; i < threadNum; i++) {
+        tasks[i].phase = phase;
+        pthread_create(&tids[i], NULL, csrBuildWorker, &tasks[i]);
+    }
+    for (int i = 0; i < threadNum; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    free(tids);
+}
+
+/**
+ * @brief  由边表批量建图（计数排序）
+ * @param  vertexNum    顶点数量，顶点编号为 0 ~ vertexNum - 1
+ * @param  src          边的起点数组
+ * @param  dst          边的终点数组
+ * @param  weights      边权数组，无权图传 NULL
+ * @param  edgeNum      边数量
+ * @param  undirected   是否为无向图（每条边同时添加两个方向）
+ * @param  threadNum    线程数量，1 表示单线程
+ * @retval GraphCSR *   CSR 图
+ * @note   计数排序是稳定的：每个顶点的邻接顶点按边在边表中的顺序排列，与线程数量无关。
+ *         多线程时每个线程按边分段，先各自统计度，再由前缀和为每个线程在每个顶点的邻接区间中
+ *         划分出一段互不重叠的写入范围，分配边时无需原子操作，额外空间为 O(threadNum * n) 。
+ */
+GraphCSR *newGraphCSRFromEdges(int vertexNum, int *src, int *dst, int *weights,
+                               long long edgeNum, bool undirected, int threadNum) {
+    if (threadNum < 1) {
+        threadNum = 1;
+    }
+    GraphCSR *csr = malloc(sizeof(GraphCSR));
+    csr->vertexNum = vertexNum;
+    csr->edgeNum = undirected ? 2 * edgeNum : edgeNum;
+    csr->offsets = malloc(sizeof(long long) * (vertexNum + 1));
+    csr->neighbors = malloc(sizeof(int) * (csr->edgeNum + 1));
+    csr->weights = weights == NULL ? NULL : malloc(sizeof(int) * (csr->edgeNum + 1));
+    csr->vertices = NULL;
+    CSRBuildTask *tasks = malloc(sizeof(CSRBuildTask) * threadNum);
+    for (int i = 0; i < threadNum; i++) {
+        tasks[i] = (CSRBuildTask){csr, src, dst, weights,
+                                  edgeNum * i / threadNum, edgeNum * (i + 1) / threadNum,
+                                  undirected, calloc(vertexNum + 1, sizeof(long long)), 0};
+    }
+    /* 1. 统计度 */
+    csrRunPhase(tasks, threadNum, 0);
+    /* 2. 前缀和：顶点 v 的区间内，线程 0, 1, ... 依次占据一段 */
+    long long sum = 0;
+    for (int v = 0; v < vertexNum; v++) {
+        csr->offsets[v] = sum;
+        for (int i = 0; i < threadNum; i++) {
+            long long cnt = tasks[i].cursor[v];
+            tasks[i].cursor[v] = sum;
+            sum += cnt;
+        }
+    }
+    csr->offsets[vertexNum] = sum;
+    /* 3. 分配边 */
+    csrRunPhase(tasks, threadNum, 1);
+    for (int i = 0; i < threadNum; i++) {
+        free(tasks[i].cursor);
+    }
+    free(tasks);
+    return csr;
+}
+
+/* 将邻接表转换为 CSR ，顶点编号为其在 heads 数组中的索引 */
+GraphCSR *graphAdjListToCSR(GraphAdjList *graph) {
+    int n = graph->size;
+    GraphCSR *csr = malloc(sizeof(GraphCSR));
+    csr->vertexNum = n;
+    csr->offsets = malloc(sizeof(long long) * (n + 1));
+    csr->vertices = malloc(sizeof(Vertex *) * (n + 1));
+    // 建立顶点编号，避免 findNode 的线性查找
+    VertexIndex *index = newVertexIndex(graph);
+    csr->offsets[0] = 0;
+    for (int i = 0; i < n; i++) {
+        csr->vertices[i] = graph->heads[i]->vertex;
+        // 统计度
+        int degree = 0;
+        for (AdjListNode *node = graph->heads[i]->next; node != NULL; node = node->next) {
+            degree++;
+        }
+        csr->offsets[i + 1] = csr->offsets[i] + degree;
+    }
+    csr->edgeNum = csr->offsets[n];
+    csr->neighbors = malloc(sizeof(int) * (csr->edgeNum + 1));
+    // 添加过带权边时同时转换边权
+    csr->weights = graph->weighted ? malloc(sizeof(int) * (csr->edgeNum + 1)) : NULL;
+    // 按链表顺序写入邻接顶点编号
+    for (int i = 0; i < n; i++) {
+        long long pos = csr->offsets[i];
+        for (AdjListNode *node = graph->heads[i]->next; node != NULL; node = node->next) {
+            if (csr->weights != NULL) {
+                csr->weights[pos] = node->weight;
+            }
+            csr->neighbors[pos++] = vertexId(index, node->vertex);
+        }
+    }
+    delVertexIndex(index);
+    return csr;
+}
+
+/* 广度优先遍历：结果写入 res（顶点编号），返回访问的顶点数量 */
+int csrBFS(GraphCSR *csr, int start, int *res) {
+    bool *visited = calloc(csr->vertexNum, sizeof(bool));
+    // res 同时作为队列使用：[front, rear) 为待出队的顶点
+    int front = 0, rear = 0;
+    res[rear++] = start;
+    visited[start] = true;
+    while (front < rear) {
+        int v = res[front++];
+        // 邻接顶点为连续数组，顺序扫描
+        long long end = csr->offsets[v + 1];
+        for (long long i = csr->offsets[v]; i < end; i++) {
+            int u = csr->neighbors[i];
+            if (!visited[u]) {
+                visited[u] = true;
+                res[rear++] = u;
+            }
+        }
+    }
+    free(visited);
+    return rear;
+}
+
+/* 打印 CSR */
+void printGraphCSR(GraphCSR *csr) {
+    printf("CSR =\n");
+    for (int v = 0; v < csr->vertexNum; v++) {
+        printf("%d: [", csr->vertices == NULL ? v : csr->vertices[v]->val);
+        for (long long i = csr->offsets[v]; i < csr->offsets[v + 1]; i++) {
+            int u = csr->neighbors[i];
+            printf(i == csr->offsets[v] ? "%d" : ", %d", csr->vertices == NULL ? u : csr->vertices[u]->val);
+            if (csr->weights != NULL) {
+                printf("(%d)", csr->weights[i]);
+            }
+        }
+        printf("]\n");
+    }
+}
@@ -0,0 +1,201 @@
+/**
+ * @FileName    :graph_csr_test.c
+ * @Date        :2026-10-19 16:58:37
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :CSR 图测试程序
+ * @Description :1. 基本操作测试：邻接表转换为 CSR 、由边表建图（含带权图）、广度优先遍历
+ *               2. 单线程与多线程建图结果一致性检查
+ *               3. 性能对比：随机图上单线程 / 多线程建图耗时，链表邻接表 vs CSR 的 BFS 耗时
+ *                  链表邻接表与 GraphAdjList 结构相同（每条边一个 AdjListNode ，头插法），
+ *                  按顶点编号直接建立，避免 addEdge 中 findNode 的线性查找。
+ *                  默认 10^6 个顶点、8 * 10^6 条无向边，可通过 -DBENCH_VERTICES / -DBENCH_EDGES 调整。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_csr.c"
+
+#ifndef BENCH_VERTICES
+#define BENCH_VERTICES 1000000
+#endif
+#ifndef BENCH_EDGES
+#define BENCH_EDGES 8000000
+#endif
+// 多线程建图使用的线程数量
+#define BENCH_THREADS 4
+
+/* 基本操作测试 */
+void testBasic() {
+    // 初始化无向图（与 graph_bfs.c 相同的 3 x 3 网格）
+    int vals[] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    int size = sizeof(vals) / sizeof(vals[0]);
+    Vertex **v = valsToVets(vals, size);
+    Vertex *edges[][2] = {{v[0], v[1]}, {v[0], v[3]}, {v[1], v[2]}, {v[1], v[4]}, {v[2], v[5]}, {v[3], v[4]}, {v[3], v[6]}, {v[4], v[5]}, {v[4], v[7]}, {v[5], v[8]}, {v[6], v[7]}, {v[7], v[8]}};
+    int egdeSize = sizeof(edges) / sizeof(edges[0]);
+    GraphAdjList *graph = newGraphAdjList();
+    for (int i = 0; i < size; i++) {
+        addVertex(graph, v[i]);
+    }
+    for (int i = 0; i < egdeSize; i++) {
+        addEdge(graph, edges[i][0], edges[i][1]);
+    }
+
+    /* 邻接表转换为 CSR */
+    GraphCSR *csr = graphAdjListToCSR(graph);
+    printf("邻接表转换为 CSR 后，顶点数量为 %d ，有向边数量为 %lld\n", csr->vertexNum, csr->edgeNum);
+    printGraphCSR(csr);
+
+    /* 广度优先遍历，结果通过 vertices 映射回原顶点 */
+    int res[9];
+    int resSize = csrBFS(csr, 0, res);
+    for (int i = 0; i < resSize; i++) {
+        res[i] = csr->vertices[res[i]]->val;
+    }
+    printf("广度优先遍历（BFS）顶点序列为\n");
+    printArray(res, resSize);
+    delGraphCSR(csr);
+
+    /* 由边表建立带权有向图 */
+    int src[] = {0, 0, 1, 2, 2, 3};
+    int dst[] = {2, 1, 3, 3, 0, 0};
+    int weights[] = {5, 1, 2, 7, 3, 4};
+    csr = newGraphCSRFromEdges(4, src, dst, weights, 6, false, 1);
+    printf("\n由边表建立的带权有向图\n");
+    printGraphCSR(csr);
+    // 邻接顶点按边表顺序排列
+    assert(csrDegree(csr, 0) == 2 && csrNeighbors(csr, 0)[0] == 2 && csr->weights[csr->offsets[0]] == 5);
+    delGraphCSR(csr);
+
+    delGraphAdjList(graph);
+    free(v);
+}
+
+/* 生成随机边表 */
+void genRandomEdges(int vertexNum, int *src, int *dst, long long edgeNum) {
+    srand(2026);
+    for (long long i = 0; i < edgeNum; i++) {
+        src[i] = ((long long)rand() * RAND_MAX + rand()) % vertexNum;
+        dst[i] = ((long long)rand() * RAND_MAX + rand()) % vertexNum;
+    }
+}
+
+/* 单线程与多线程建图结果一致性检查 */
+void testParallelBuild() {
+    int n = 1000;
+    long long m = 20000;
+    int *src = malloc(sizeof(int) * m);
+    int *dst = malloc(sizeof(int) * m);
+    int *weights = malloc(sizeof(int) * m);
+    genRandomEdges(n, src, dst, m);
+    for (long long i = 0; i < m; i++) {
+        weights[i] = rand() % 100;
+    }
+    GraphCSR *a = newGraphCSRFromEdges(n, src, dst, weights, m, true, 1);
+    GraphCSR *b = newGraphCSRFromEdges(n, src, dst, weights, m, true, BENCH_THREADS);
+    assert(memcmp(a->offsets, b->offsets, sizeof(long long) * (n + 1)) == 0);
+    assert(memcmp(a->neighbors, b->neighbors, sizeof(int) * a->edgeNum) == 0);
+    assert(memcmp(a->weights, b->weights, sizeof(int) * a->edgeNum) == 0);
+    printf("单线程与 %d 线程建图结果一致\n", BENCH_THREADS);
+    delGraphCSR(a);
+    delGraphCSR(b);
+    free(src);
+    free(dst);
+    free(weights);
+}
+
+/* 链表邻接表上的广度优先遍历（与 graphBFS 相同的访问方式，visited 使用数组） */
+int listBFS(AdjListNode **heads, int vertexNum, int start, int *res) {
+    bool *visited = calloc(vertexNum, sizeof(bool));
+    int front = 0, rear = 0;
+    res[rear++] = start;
+    visited[start] = true;
+    while (front < rear) {
+        int v = res[front++];
+        for (AdjListNode *node = heads[v]; node != NULL; node = node->next) {
+            int u = node->vertex->val;
+            if (!visited[u]) {
+                visited[u] = true;
+                res[rear++] = u;
+            }
+        }
+    }
+    free(visited);
+    return rear;
+}
+
+/* 性能对比 */
+void testBenchmark() {
+    int n = BENCH_VERTICES;
+    long long m = BENCH_EDGES;
+    int *src = malloc(sizeof(int) * m);
+    int *dst = malloc(sizeof(int) * m);
+    genRandomEdges(n, src, dst, m);
+    printf("\n随机无向图：顶点数量 %d ，边数量 %lld\n", n, m);
+    double start;
+
+    /* 建图 */
+    start = wallSeconds();
+    GraphCSR *csr = newGraphCSRFromEdges(n, src, dst, NULL, m, true, 1);
+    printf("CSR 单线程建图耗时 %.3f s\n", wallSeconds() - start);
+    delGraphCSR(csr);
+    start = wallSeconds();
+    csr = newGraphCSRFromEdges(n, src, dst, NULL, m, true, BENCH_THREADS);
+    printf("CSR %d 线程建图耗时 %.3f s\n", BENCH_THREADS, wallSeconds() - start);
+
+    /* 链表邻接表：按随机边表顺序头插 */
+    Vertex **v = malloc(sizeof(Vertex *) * n);
+    for (int i = 0; i < n; i++) {
+        v[i] = newVertex(i);
+    }
+    AdjListNode **heads = calloc(n, sizeof(AdjListNode *));
+    start = wallSeconds();
+    for (long long i = 0; i < m; i++) {
+        AdjListNode *node1 = malloc(sizeof(AdjListNode));
+        node1->vertex = v[dst[i]];
+        node1->next = heads[src[i]];
+        heads[src[i]] = node1;
+        AdjListNode *node2 = malloc(sizeof(AdjListNode));
+        node2->vertex = v[src[i]];
+        node2->next = heads[dst[i]];
+        heads[dst[i]] = node2;
+    }
+    printf("链表邻接表建图耗时 %.3f s\n", wallSeconds() - start);
+
+    /* 广度优先遍历 */
+    int *res = malloc(sizeof(int) * n);
+    start = wallSeconds();
+    int cnt1 = listBFS(heads, n, 0, res);
+    double t1 = wallSeconds() - start;
+    start = wallSeconds();
+    int cnt2 = csrBFS(csr, 0, res);
+    double t2 = wallSeconds() - start;
+    assert(cnt1 == cnt2);
+    printf("BFS 访问顶点 %d 个：链表邻接表 %.3f s, CSR %.3f s\n", cnt2, t1, t2);
+    printf("内存占用：链表邻接表 %.1f MB, CSR %.1f MB\n",
+           (sizeof(AdjListNode) * 2.0 * m + sizeof(AdjListNode *) * (double)n) / 1048576,
+           (sizeof(int) * (double)csr->edgeNum + sizeof(long long) * (n + 1.0)) / 1048576);
+
+    for (int i = 0; i < n; i++) {
+        AdjListNode *node = heads[i];
+        while (node != NULL) {
+            AdjListNode *next = node->next;
+            free(node);
+            node = next;
+        }
+        free(v[i]);
+    }
+    free(heads);
+    free(v);
+    free(res);
+    delGraphCSR(csr);
+    free(src);
+    free(dst);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testParallelBuild", testParallelBuild);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -5,45 +5,55 @@
  * @Version     :V1.0.0
  * @Brief       :图的深度优先遍历（DFS）
  * @Description :深度优先遍历是一种优先走到底、无路可走再回头的遍历方式。
- *               这种“走到尽头再返回”的算法范式通常基于递归来实现。
+ *               这种“走到尽头再返回”的算法范式通常基于递归来实现，这里使用显式栈模拟递归，避免深度过大时栈溢出。
+ *               与 BFS 相同，使用顶点编号（VertexIndex）和时间戳数组（VisitedSet）在 O(1) 时间内判断顶点是否已访问，
+ *               并通过 heads[id] 直接访问链表，总复杂度为 O(V + E) 。
  */
 
-#include "graph_adjacency_list.c"
+#include "vertex_index.c"
 
-// 假设节点最大数量为 100
-#define MAX_SIZE 100
+/* 栈帧：顶点编号与下一个待检查的邻接节点 */
+typedef struct {
+    int id;
+    AdjListNode *next;
+} DFSFrame;
 
-/* 检查顶点是否已被访问 */
-bool isVisisted(Vertex **res, int size, Vertex *vet) {
-    // 遍历查找节点，使用 O(n) 时间
-    for (int i = 0; i < size; i++) {
-        if (res[i] == vet) {
-            return true;
-        }
-    }
-    return false;
-}
-
-/* 深度优先遍历辅助函数 */
-void dfsHelper(GraphAdjList *graph, Vertex **res, int *resSize, Vertex *vet) {
+/* 深度优先遍历 */
+// 使用邻接表来表示图，以便获取指定顶点的所有邻接顶点；visited 在函数开始时清空（O(1)），可在多次遍历间复用
+// 用可扩容的显式栈代替递归，访问顺序与递归实现相同，长链状图也不会栈溢出
+void graphDFS(GraphAdjList *graph, VertexIndex *index, VisitedSet *visited,
+              Vertex *startVet, Vertex **res, int *resSize) {
+    visitedClear(visited);
+    int capacity = MAX_SIZE, size = 0;
+    DFSFrame *stack = malloc(sizeof(DFSFrame) * capacity);
+    int start = vertexId(index, startVet);
     // 记录访问顶点
-    res[(*resSize)++] = vet;
-    // 遍历该顶点的所有邻接顶点
-    AdjListNode *node = findNode(graph, vet);
-    while (node != NULL) {
+    visitedMark(visited, start);
+    res[(*resSize)++] = startVet;
+    stack[size++] = (DFSFrame){start, graph->heads[start]->next};
+    while (size > 0) {
+        DFSFrame *top = &stack[size - 1];
+        // 当前顶点的邻接顶点已全部检查，回溯
+        if (top->next == NULL) {
+            size--;
+            continue;
+        }
+        Vertex *vet = top->next->vertex;
+        top->next = top->next->next;
+        int id = vertexId(index, vet);
         // 跳过已被访问的顶点
-        if (!isVisisted(res, *resSize, node->vertex)) {
-            // 递归访问邻接顶点
-            dfsHelper(graph, res, resSize, node->vertex);
+        if (!visitedMark(visited, id)) {
+            continue;
+        }
+        // 访问邻接顶点，相当于递归调用
+        res[(*resSize)++] = vet;
+        if (size == capacity) {
+            capacity *= 2;
+            stack = realloc(stack, sizeof(DFSFrame) * capacity);
         }
-        node = node->next;
+        stack[size++] = (DFSFrame){id, graph->heads[id]->next};
     }
-}
-
-/* 深度优先遍历 */
-// 使用邻接表来表示图，以便获取指定顶点的所有邻接顶点
-void graphDFS(GraphAdjList *graph, Vertex *startVet, Vertex **res, int *resSize) {
-    dfsHelper(graph, res, resSize, startVet);
+    free(stack);
 }
 
 /* Driver Code */
@@ -68,11 +78,15 @@ int main() {
     // 深度优先遍历
     Vertex *res[MAX_SIZE];
     int resSize = 0;
-    graphDFS(graph, v[0], res, &resSize);
+    VertexIndex *index = newVertexIndex(graph);
+    VisitedSet *visited = newVisitedSet(graph->size);
+    graphDFS(graph, index, visited, v[0], res, &resSize);
     printf("\n深度优先遍历（DFS）顶点序列为\n");
     printArray(vetsToVals(res, resSize), resSize);
 
     // 释放内存
+    delVertexIndex(index);
+    delVisitedSet(visited);
     delGraphAdjList(graph);
     free(v);
     return 0;
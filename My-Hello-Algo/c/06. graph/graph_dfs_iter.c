@@ -0,0 +1,233 @@
+/**
+ * @FileName    :graph_dfs_iter.c
+ * @Date        :2026-10-19 19:02:26
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :基于显式栈的迭代深度优先遍历，及拓扑排序、强连通分量、环检测
+ * @Description :递归 DFS 每访问一个顶点占用一层调用栈，长链状图（深度 10^6）会导致栈溢出。
+ *               这里用可扩容的显式栈代替递归，栈帧记录（顶点，下一条待检查的边），与递归的执行顺序完全相同。
+ *               顶点颜色：WHITE 未访问，GRAY 在栈中（已进入未退出），BLACK 已退出。
+ *               遍历过程中通过回调通知事件（DFSVisitor），回调为 NULL 表示忽略该事件：
+ *                  enter(u, v)     ：进入顶点 v ，u 为树中的父顶点（根为 -1），对应先序；
+ *                  exit(u, v)      ：退出顶点 v ，对应后序；
+ *                  treeEdge(u, v)  ：树边，v 未访问；
+ *                  backEdge(u, v)  ：回边，v 为 GRAY ，有向图中存在回边当且仅当有环；
+ *                  crossEdge(u, v) ：前向边或横叉边，v 为 BLACK 。
+ *               基于该引擎实现（均为 O(V + E)）：
+ *                  1. 拓扑排序：按退出顺序的逆序排列，遇到回边说明有环；
+ *                  2. 强连通分量（Tarjan）：进入时记录 dfn 与 low ，回边与指向栈中顶点的横叉边更新 low ，
+ *                     退出时若 low == dfn 则弹出一个强连通分量，并用 low 更新父顶点；
+ *                  3. 环检测：是否存在回边。
+ *               图为 CSR 有向图。
+ */
+
+#include "graph_csr.c"
+
+/* 顶点颜色 */
+enum {
+    DFS_WHITE,
+    DFS_GRAY,
+    DFS_BLACK
+};
+
+/* 事件回调，ctx 为用户数据 */
+typedef void (*DFSCallback)(void *ctx, int u, int v);
+
+/* 遍历事件回调集合 */
+typedef struct {
+    void *ctx;
+    DFSCallback enter;
+    DFSCallback exit;
+    DFSCallback treeEdge;
+    DFSCallback backEdge;
+    DFSCallback crossEdge;
+} DFSVisitor;
+
+/* 栈帧：顶点与下一条待检查的边 */
+typedef struct {
+    int v;
+    long long e;
+} DFSFrame;
+
+/* 可扩容的显式栈 */
+typedef struct {
+    DFSFrame *frames;
+    int size, capacity;
+} DFSStack;
+
+/* 构造函数 */
+DFSStack *newDFSStack() {
+    DFSStack *stack = malloc(sizeof(DFSStack));
+    stack->capacity = 64;
+    stack->size = 0;
+    stack->frames = malloc(sizeof(DFSFrame) * stack->capacity);
+    return stack;
+}
+
+/* 析构函数 */
+void delDFSStack(DFSStack *stack) {
+    free(stack->frames);
+    free(stack);
+}
+
+/* 入栈 */
+void dfsStackPush(DFSStack *stack, int v, long long e) {
+    if (stack->size == stack->capacity) {
+        stack->capacity *= 2;
+        stack->frames = realloc(stack->frames, sizeof(DFSFrame) * stack->capacity);
+    }
+    stack->frames[stack->size].v = v;
+    stack->frames[stack->size].e = e;
+    stack->size++;
+}
+
+/* 从 root 开始迭代深度优先遍历，color 在多次调用间共享，已访问的顶点不会重复访问 */
+void csrDFSFrom(GraphCSR *csr, int root, unsigned char *color, DFSStack *stack, DFSVisitor *vis) {
+    if (color[root] != DFS_WHITE) {
+        return;
+    }
+    color[root] = DFS_GRAY;
+    if (vis->enter != NULL) {
+        vis->enter(vis->ctx, -1, root);
+    }
+    dfsStackPush(stack, root, csr->offsets[root]);
+    while (stack->size > 0) {
+        // 入栈可能导致扩容，每次循环重新获取栈顶
+        DFSFrame *top = &stack->frames[stack->size - 1];
+        int u = top->v;
+        if (top->e < csr->offsets[u + 1]) {
+            int v = csr->neighbors[top->e++];
+            if (color[v] == DFS_WHITE) {
+                if (vis->treeEdge != NULL) {
+                    vis->treeEdge(vis->ctx, u, v);
+                }
+                color[v] = DFS_GRAY;
+                if (vis->enter != NULL) {
+                    vis->enter(vis->ctx, u, v);
+                }
+                dfsStackPush(stack, v, csr->offsets[v]);
+            } else if (color[v] == DFS_GRAY) {
+                if (vis->backEdge != NULL) {
+                    vis->backEdge(vis->ctx, u, v);
+                }
+            } else if (vis->crossEdge != NULL) {
+                vis->crossEdge(vis->ctx, u, v);
+            }
+        } else {
+            // 所有边检查完毕，退出顶点
+            stack->size--;
+            color[u] = DFS_BLACK;
+            if (vis->exit != NULL) {
+                vis->exit(vis->ctx, stack->size > 0 ? stack->frames[stack->size - 1].v : -1, u);
+            }
+        }
+    }
+}
+
+/* 从所有未访问的顶点依次开始遍历，覆盖整个图 */
+void csrDFSAll(GraphCSR *csr, DFSVisitor *vis) {
+    unsigned char *color = calloc(csr->vertexNum, sizeof(unsigned char));
+    DFSStack *stack = newDFSStack();
+    for (int v = 0; v < csr->vertexNum; v++) {
+        csrDFSFrom(csr, v, color, stack, vis);
+    }
+    delDFSStack(stack);
+    free(color);
+}
+
+/* 拓扑排序上下文 */
+typedef struct {
+    int *order; // 结果，从末尾向前填写
+    int pos;    // 下一个填写位置
+    bool hasCycle;
+} TopoContext;
+
+/* 退出顶点：逆后序即拓扑序 */
+void topoOnExit(void *ctx, int u, int v) {
+    (void)u;
+    TopoContext *c = ctx;
+    c->order[--c->pos] = v;
+}
+
+/* 回边：存在环 */
+void topoOnBackEdge(void *ctx, int u, int v) {
+    (void)u;
+    (void)v;
+    ((TopoContext *)ctx)->hasCycle = true;
+}
+
+/* 拓扑排序，结果写入 order ，图中有环时返回 false */
+bool csrTopoSort(GraphCSR *csr, int *order) {
+    TopoContext ctx = {order, csr->vertexNum, false};
+    DFSVisitor vis = {&ctx, NULL, topoOnExit, NULL, topoOnBackEdge, NULL};
+    csrDFSAll(csr, &vis);
+    return !ctx.hasCycle;
+}
+
+/* 环检测 */
+bool csrHasCycle(GraphCSR *csr) {
+    int *order = malloc(sizeof(int) * (csr->vertexNum + 1));
+    bool acyclic = csrTopoSort(csr, order);
+    free(order);
+    return !acyclic;
+}
+
+/* Tarjan 强连通分量上下文 */
+typedef struct {
+    int *dfn;      // 进入顺序
+    int *low;      // 能到达的栈中顶点的最小 dfn
+    int *stack;    // 尚未归入分量的顶点栈
+    int top;
+    bool *onStack;
+    int *comp;     // 每个顶点所属分量编号
+    int counter;   // dfn 计数
+    int compNum;   // 分量数量
+} TarjanContext;
+
+/* 进入顶点：初始化 dfn 与 low 并入栈 */
+void tarjanOnEnter(void *ctx, int u, int v) {
+    (void)u;
+    TarjanContext *c = ctx;
+    c->dfn[v] = c->low[v] = c->counter++;
+    c->stack[c->top++] = v;
+    c->onStack[v] = true;
+}
+
+/* 回边或指向栈中顶点的横叉边：用 dfn[v] 更新 low[u] */
+void tarjanOnNonTreeEdge(void *ctx, int u, int v) {
+    TarjanContext *c = ctx;
+    if (c->onStack[v] && c->dfn[v] < c->low[u]) {
+        c->low[u] = c->dfn[v];
+    }
+}
+
+/* 退出顶点：low == dfn 时弹出一个分量，并用 low[v] 更新父顶点 */
+void tarjanOnExit(void *ctx, int u, int v) {
+    TarjanContext *c = ctx;
+    if (c->low[v] == c->dfn[v]) {
+        int w;
+        do {
+            w = c->stack[--c->top];
+            c->onStack[w] = false;
+            c->comp[w] = c->compNum;
+        } while (w != v);
+        c->compNum++;
+    }
+    if (u != -1 && c->low[v] < c->low[u]) {
+        c->low[u] = c->low[v];
+    }
+}
+
+/* 求强连通分量，comp[v] 为顶点 v 所属分量编号（按逆拓扑序编号），返回分量数量 */
+int csrTarjanSCC(GraphCSR *csr, int *comp) {
+    int n = csr->vertexNum;
+    TarjanContext ctx = {malloc(sizeof(int) * (n + 1)), malloc(sizeof(int) * (n + 1)),
+                         malloc(sizeof(int) * (n + 1)), 0, calloc(n + 1, sizeof(bool)), comp, 0, 0};
+    DFSVisitor vis = {&ctx, tarjanOnEnter, tarjanOnExit, NULL, tarjanOnNonTreeEdge, tarjanOnNonTreeEdge};
+    csrDFSAll(csr, &vis);
+    free(ctx.dfn);
+    free(ctx.low);
+    free(ctx.stack);
+    free(ctx.onStack);
+    return ctx.compNum;
+}
@@ -0,0 +1,206 @@
+/**
+ * @FileName    :graph_dfs_iter_test.c
+ * @Date        :2026-10-19 19:30:51
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :迭代深度优先遍历测试程序
+ * @Description :1. 基本测试：事件回调顺序、拓扑排序、强连通分量、环检测
+ *               2. 随机图上与暴力结果对比：拓扑序满足所有边的先后关系，强连通分量与两两可达性一致
+ *               3. 性能：深度为 BENCH_DEPTH 的长链（默认 10^6 ，可通过 -DBENCH_DEPTH 调整），
+ *                  递归 DFS 在该深度下会栈溢出；首尾相连后整条链为一个强连通分量。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_dfs_iter.c"
+
+#ifndef BENCH_DEPTH
+#define BENCH_DEPTH 1000000
+#endif
+
+/* 打印事件 */
+void printEnter(void *ctx, int u, int v) {
+    (void)ctx;
+    (void)u;
+    printf("enter %d, ", v);
+}
+void printExit(void *ctx, int u, int v) {
+    (void)ctx;
+    (void)u;
+    printf("exit %d, ", v);
+}
+void printTreeEdge(void *ctx, int u, int v) {
+    (void)ctx;
+    printf("tree %d->%d, ", u, v);
+}
+void printBackEdge(void *ctx, int u, int v) {
+    (void)ctx;
+    printf("back %d->%d, ", u, v);
+}
+void printCrossEdge(void *ctx, int u, int v) {
+    (void)ctx;
+    printf("cross %d->%d, ", u, v);
+}
+
+/* 基本测试 */
+void testBasic() {
+    // 0 -> 1 -> 2 -> 0 构成环，2 -> 3 -> 4 ，3 -> 5 -> 4
+    int src[] = {0, 1, 2, 2, 3, 3, 5};
+    int dst[] = {1, 2, 0, 3, 4, 5, 4};
+    GraphCSR *csr = newGraphCSRFromEdges(6, src, dst, NULL, 7, false, 1);
+    DFSVisitor vis = {NULL, printEnter, printExit, printTreeEdge, printBackEdge, printCrossEdge};
+    printf("遍历事件：");
+    csrDFSAll(csr, &vis);
+    printf("\n");
+
+    int comp[6], order[6];
+    int compNum = csrTarjanSCC(csr, comp);
+    printf("强连通分量数量为 %d ，各顶点所属分量为 ", compNum);
+    printArray(comp, 6);
+    assert(compNum == 4 && comp[0] == comp[1] && comp[1] == comp[2]);
+    printf("是否有环 %d\n", csrHasCycle(csr));
+    delGraphCSR(csr);
+
+    // 去掉边 2 -> 0 后为有向无环图
+    src[2] = 1;
+    dst[2] = 3;
+    csr = newGraphCSRFromEdges(6, src, dst, NULL, 7, false, 1);
+    assert(csrTopoSort(csr, order));
+    printf("拓扑序为 ");
+    printArray(order, 6);
+    printf("是否有环 %d\n", csrHasCycle(csr));
+    delGraphCSR(csr);
+}
+
+/* 暴力求可达性：reach[u * n + v] 表示 u 能否到达 v */
+bool *bruteReach(GraphCSR *csr) {
+    int n = csr->vertexNum;
+    bool *reach = calloc((size_t)n * n, sizeof(bool));
+    int *queue = malloc(sizeof(int) * n);
+    for (int s = 0; s < n; s++) {
+        int front = 0, rear = 0;
+        queue[rear++] = s;
+        reach[s * n + s] = true;
+        while (front < rear) {
+            int u = queue[front++];
+            for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+                int v = csr->neighbors[e];
+                if (!reach[s * n + v]) {
+                    reach[s * n + v] = true;
+                    queue[rear++] = v;
+                }
+            }
+        }
+    }
+    free(queue);
+    return reach;
+}
+
+/* 随机图上与暴力结果对比 */
+void testRandom() {
+    int n = 300, m = 450;
+    int *src = malloc(sizeof(int) * m);
+    int *dst = malloc(sizeof(int) * m);
+    int *comp = malloc(sizeof(int) * n);
+    int *order = malloc(sizeof(int) * n);
+    int *pos = malloc(sizeof(int) * n);
+    srand(2026);
+    for (int round = 0; round < 20; round++) {
+        bool dag = round % 2 == 0;
+        for (int i = 0; i < m; i++) {
+            src[i] = rand() % n;
+            dst[i] = rand() % n;
+            // 有向无环图：只保留从小编号指向大编号的边
+            if (dag && src[i] >= dst[i]) {
+                src[i] = dst[i] == 0 ? 0 : rand() % dst[i];
+                dst[i] = src[i] == dst[i] ? dst[i] + 1 : dst[i];
+            }
+        }
+        GraphCSR *csr = newGraphCSRFromEdges(n, src, dst, NULL, m, false, 1);
+        bool *reach = bruteReach(csr);
+        csrTarjanSCC(csr, comp);
+        bool cyclic = false;
+        for (int u = 0; u < n; u++) {
+            for (int v = 0; v < n; v++) {
+                bool mutual = reach[u * n + v] && reach[v * n + u];
+                assert((comp[u] == comp[v]) == mutual);
+                cyclic |= u != v && mutual;
+            }
+        }
+        // 自环也是环
+        for (int i = 0; i < m; i++) {
+            cyclic |= src[i] == dst[i];
+        }
+        assert(csrHasCycle(csr) == cyclic);
+        if (dag) {
+            assert(csrTopoSort(csr, order));
+            for (int i = 0; i < n; i++) {
+                pos[order[i]] = i;
+            }
+            for (int i = 0; i < m; i++) {
+                assert(pos[src[i]] < pos[dst[i]]);
+            }
+        }
+        free(reach);
+        delGraphCSR(csr);
+    }
+    printf("随机图测试通过：拓扑排序、强连通分量、环检测与暴力结果一致\n");
+    free(src);
+    free(dst);
+    free(comp);
+    free(order);
+    free(pos);
+}
+
+/* 性能测试：长链 */
+void testBenchmark() {
+    int n = BENCH_DEPTH;
+    int *src = malloc(sizeof(int) * n);
+    int *dst = malloc(sizeof(int) * n);
+    for (int i = 0; i < n - 1; i++) {
+        src[i] = i;
+        dst[i] = i + 1;
+    }
+    int *order = malloc(sizeof(int) * n);
+    int *comp = malloc(sizeof(int) * n);
+    clock_t start;
+
+    /* 长链：有向无环 */
+    GraphCSR *csr = newGraphCSRFromEdges(n, src, dst, NULL, n - 1, false, 1);
+    start = clock();
+    bool ok = csrTopoSort(csr, order);
+    double tTopo = (double)(clock() - start) / CLOCKS_PER_SEC;
+    assert(ok && order[0] == 0 && order[n - 1] == n - 1);
+    start = clock();
+    int compNum = csrTarjanSCC(csr, comp);
+    double tSCC = (double)(clock() - start) / CLOCKS_PER_SEC;
+    assert(compNum == n);
+    printf("\n深度 %d 的长链：拓扑排序 %.3f s ，强连通分量 %.3f s（%d 个）\n", n, tTopo, tSCC, compNum);
+    delGraphCSR(csr);
+
+    /* 首尾相连：整个环为一个强连通分量 */
+    src[n - 1] = n - 1;
+    dst[n - 1] = 0;
+    csr = newGraphCSRFromEdges(n, src, dst, NULL, n, false, 1);
+    start = clock();
+    bool cyclic = csrHasCycle(csr);
+    double tCycle = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    compNum = csrTarjanSCC(csr, comp);
+    tSCC = (double)(clock() - start) / CLOCKS_PER_SEC;
+    assert(cyclic && compNum == 1);
+    printf("长度 %d 的环：环检测 %.3f s ，强连通分量 %.3f s（%d 个）\n", n, tCycle, tSCC, compNum);
+    delGraphCSR(csr);
+
+    free(src);
+    free(dst);
+    free(order);
+    free(comp);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testRandom", testRandom);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
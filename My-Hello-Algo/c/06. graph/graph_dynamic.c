@@ -0,0 +1,530 @@
+/**
+ * @FileName    :graph_dynamic.c
+ * @Date        :2026-10-20 01:02:36
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :支持频繁增删边的动态无向图
+ * @Description :顶点使用 0 ~ n-1 的连续编号，每个顶点的邻接顶点存放在一个可增长的数组块（DynAdjBlock）中：
+ *               1. 添加边：追加到数组末尾，容量不足时翻倍，均摊 O(1) 。
+ *               2. 删除边：将对应位置标记为墓碑（DYN_TOMBSTONE），不移动其他元素；
+ *                  墓碑数量超过有效边数时压缩数组块（墓碑压缩），均摊 O(1) 。
+ *               3. 查找边：度数不超过 DYN_HASH_THRESHOLD 时顺序扫描连续数组；超过后为数组块建立开放寻址哈希索引
+ *                  （邻接顶点 -> 数组下标），查找、删除均为 O(1) 。
+ *               4. 删除顶点：只需删除其邻接边，O(deg) ，编号不移动（不像 GraphAdjList 那样移动 heads 数组）。
+ *               5. 批量更新：将无向边拆成两条有向更新，按起点计数排序（稳定，同一条边的更新保持原有顺序），
+ *                  各线程负责一段起点，每个数组块只被一个线程修改，无需加锁。
+ *               6. 快照（写时复制）：快照复制数组块指针并增加引用计数，O(n) ；
+ *                  写入时若数组块被快照共享（引用计数 > 1），先复制再修改，读者看到的数组块永不变化。
+ *                  快照由写线程创建后可交给任意线程读取，释放快照可在任意线程进行（引用计数为原子操作）。
+ */
+
+#include <pthread.h>
+
+#include "graph_csr.c"
+
+// 删除的邻接顶点
+#define DYN_TOMBSTONE -1
+// 数组块的初始容量
+#define DYN_INIT_CAPACITY 4
+// 度数超过该值时建立哈希索引
+#define DYN_HASH_THRESHOLD 16
+// 哈希索引的空槽与已删除槽
+#define DYN_HASH_EMPTY -1
+#define DYN_HASH_DELETED -2
+
+/* 邻接数组块 */
+typedef struct {
+    int refCount; // 引用计数（图本身与共享该块的快照）
+    int size;     // 已使用的长度（含墓碑）
+    int capacity; // 容量
+    int live;     // 有效邻接顶点数量
+    int *nbrs;    // 邻接顶点，删除的位置为 DYN_TOMBSTONE
+    int *hash;    // 哈希索引，存放 nbrs 的下标，为 NULL 表示未建立
+    int hashCap;  // 哈希索引容量（2 的幂）
+} DynAdjBlock;
+
+/* 动态图 */
+typedef struct {
+    DynAdjBlock **blocks; // 各顶点的数组块，已删除的顶点为 NULL
+    int vertexNum;        // 顶点编号上界
+    int capacity;         // blocks 数组容量
+    long long edgeNum;    // 无向边数量
+} DynGraph;
+
+/* 只读快照 */
+typedef struct {
+    DynAdjBlock **blocks;
+    int vertexNum;
+    long long edgeNum;
+} DynSnapshot;
+
+/* 边更新 */
+typedef struct {
+    int u, v;
+    bool insert; // true 为添加，false 为删除
+} DynEdgeUpdate;
+
+/* 构造数组块 */
+DynAdjBlock *newDynAdjBlock(int capacity) {
+    DynAdjBlock *b = malloc(sizeof(DynAdjBlock));
+    b->refCount = 1;
+    b->size = b->live = 0;
+    b->capacity = capacity < DYN_INIT_CAPACITY ? DYN_INIT_CAPACITY : capacity;
+    b->nbrs = malloc(sizeof(int) * b->capacity);
+    b->hash = NULL;
+    b->hashCap = 0;
+    return b;
+}
+
+/* 析构数组块 */
+void delDynAdjBlock(DynAdjBlock *b) {
+    free(b->nbrs);
+    free(b->hash);
+    free(b);
+}
+
+/* 减少引用计数，减为 0 时释放 */
+void dynBlockRelease(DynAdjBlock *b) {
+    if (b != NULL && __atomic_sub_fetch(&b->refCount, 1, __ATOMIC_ACQ_REL) == 0) {
+        delDynAdjBlock(b);
+    }
+}
+
+/* 整数哈希 */
+unsigned dynHash(int v) {
+    unsigned x = (unsigned)v;
+    x ^= x >> 16;
+    x *= 0x45D9F3B;
+    x ^= x >> 16;
+    return x;
+}
+
+/* 重建哈希索引：容量为不小于 4 * capacity 的 2 的幂，保证追加到 capacity 之前装载率不超过 1/4 */
+void dynBlockRehash(DynAdjBlock *b) {
+    int cap = 16;
+    while (cap < 4 * b->capacity) {
+        cap *= 2;
+    }
+    if (cap != b->hashCap) {
+        free(b->hash);
+        b->hash = malloc(sizeof(int) * cap);
+        b->hashCap = cap;
+    }
+    for (int i = 0; i < cap; i++) {
+        b->hash[i] = DYN_HASH_EMPTY;
+    }
+    for (int i = 0; i < b->size; i++) {
+        if (b->nbrs[i] == DYN_TOMBSTONE) {
+            continue;
+        }
+        unsigned slot = dynHash(b->nbrs[i]) & (cap - 1);
+        while (b->hash[slot] != DYN_HASH_EMPTY) {
+            slot = (slot + 1) & (cap - 1);
+        }
+        b->hash[slot] = i;
+    }
+}
+
+/* 查找邻接顶点 v 在哈希索引中的槽位，不存在时返回 -1 */
+int dynBlockHashSlot(DynAdjBlock *b, int v) {
+    unsigned mask = b->hashCap - 1, slot = dynHash(v) & mask;
+    while (b->hash[slot] != DYN_HASH_EMPTY) {
+        if (b->hash[slot] >= 0 && b->nbrs[b->hash[slot]] == v) {
+            return (int)slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+/* 查找邻接顶点 v 在 nbrs 中的下标，不存在时返回 -1 */
+int dynBlockFind(DynAdjBlock *b, int v) {
+    if (b->hash != NULL) {
+        int slot = dynBlockHashSlot(b, v);
+        return slot < 0 ? -1 : b->hash[slot];
+    }
+    for (int i = 0; i < b->size; i++) {
+        if (b->nbrs[i] == v) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* 墓碑压缩：将有效邻接顶点移到数组前部 */
+void dynBlockCompact(DynAdjBlock *b) {
+    int j = 0;
+    for (int i = 0; i < b->size; i++) {
+        if (b->nbrs[i] != DYN_TOMBSTONE) {
+            b->nbrs[j++] = b->nbrs[i];
+        }
+    }
+    b->size = j;
+    // 有效边很少时缩小容量
+    if (b->capacity > DYN_INIT_CAPACITY && 4 * b->size < b->capacity) {
+        b->capacity = b->size * 2 > DYN_INIT_CAPACITY ? b->size * 2 : DYN_INIT_CAPACITY;
+        b->nbrs = realloc(b->nbrs, sizeof(int) * b->capacity);
+    }
+    if (b->live <= DYN_HASH_THRESHOLD) {
+        free(b->hash);
+        b->hash = NULL;
+        b->hashCap = 0;
+    } else {
+        dynBlockRehash(b);
+    }
+}
+
+/* 复制数组块（同时完成压缩），用于写时复制 */
+DynAdjBlock *dynBlockClone(DynAdjBlock *b) {
+    DynAdjBlock *c = newDynAdjBlock(b->live * 2);
+    for (int i = 0; i < b->size; i++) {
+        if (b->nbrs[i] != DYN_TOMBSTONE) {
+            c->nbrs[c->size++] = b->nbrs[i];
+        }
+    }
+    c->live = c->size;
+    if (c->live > DYN_HASH_THRESHOLD) {
+        dynBlockRehash(c);
+    }
+    return c;
+}
+
+/* 向数组块添加邻接顶点 v ，已存在时返回 false */
+bool dynBlockInsert(DynAdjBlock *b, int v) {
+    if (dynBlockFind(b, v) >= 0) {
+        return false;
+    }
+    if (b->size == b->capacity) {
+        if (2 * b->live <= b->size) {
+            // 一半以上是墓碑，压缩即可腾出空间
+            dynBlockCompact(b);
+        } else {
+            b->capacity *= 2;
+            b->nbrs = realloc(b->nbrs, sizeof(int) * b->capacity);
+            if (b->hash != NULL) {
+                dynBlockRehash(b);
+            }
+        }
+    }
+    int pos = b->size++;
+    b->nbrs[pos] = v;
+    b->live++;
+    if (b->hash != NULL) {
+        unsigned mask = b->hashCap - 1, slot = dynHash(v) & mask;
+        // 已删除槽可以复用
+        while (b->hash[slot] >= 0) {
+            slot = (slot + 1) & mask;
+        }
+        b->hash[slot] = pos;
+    } else if (b->live > DYN_HASH_THRESHOLD) {
+        dynBlockRehash(b);
+    }
+    return true;
+}
+
+/* 从数组块删除邻接顶点 v ，不存在时返回 false */
+bool dynBlockRemove(DynAdjBlock *b, int v) {
+    int pos;
+    if (b->hash != NULL) {
+        int slot = dynBlockHashSlot(b, v);
+        if (slot < 0) {
+            return false;
+        }
+        pos = b->hash[slot];
+        b->hash[slot] = DYN_HASH_DELETED;
+    } else {
+        pos = dynBlockFind(b, v);
+        if (pos < 0) {
+            return false;
+        }
+    }
+    b->nbrs[pos] = DYN_TOMBSTONE;
+    b->live--;
+    // 墓碑多于有效边时压缩
+    if (b->size - b->live > b->live && b->size > DYN_INIT_CAPACITY) {
+        dynBlockCompact(b);
+    }
+    return true;
+}
+
+/* 构造函数 */
+DynGraph *newDynGraph(int vertexNum) {
+    DynGraph *g = malloc(sizeof(DynGraph));
+    g->vertexNum = vertexNum;
+    g->capacity = vertexNum < 16 ? 16 : vertexNum;
+    g->blocks = malloc(sizeof(DynAdjBlock *) * g->capacity);
+    for (int v = 0; v < vertexNum; v++) {
+        g->blocks[v] = newDynAdjBlock(DYN_INIT_CAPACITY);
+    }
+    g->edgeNum = 0;
+    return g;
+}
+
+/* 析构函数（被快照共享的数组块在快照释放时才释放） */
+void delDynGraph(DynGraph *g) {
+    for (int v = 0; v < g->vertexNum; v++) {
+        dynBlockRelease(g->blocks[v]);
+    }
+    free(g->blocks);
+    free(g);
+}
+
+/* 判断顶点是否存在 */
+bool dynHasVertex(DynGraph *g, int v) {
+    return v >= 0 && v < g->vertexNum && g->blocks[v] != NULL;
+}
+
+/* 获取可修改的数组块：被快照共享时先复制 */
+DynAdjBlock *dynWritable(DynGraph *g, int v) {
+    DynAdjBlock *b = g->blocks[v];
+    if (__atomic_load_n(&b->refCount, __ATOMIC_ACQUIRE) > 1) {
+        DynAdjBlock *c = dynBlockClone(b);
+        dynBlockRelease(b);
+        g->blocks[v] = b = c;
+    }
+    return b;
+}
+
+/* 添加顶点，返回其编号 */
+int dynAddVertex(DynGraph *g) {
+    if (g->vertexNum == g->capacity) {
+        g->capacity *= 2;
+        g->blocks = realloc(g->blocks, sizeof(DynAdjBlock *) * g->capacity);
+    }
+    g->blocks[g->vertexNum] = newDynAdjBlock(DYN_INIT_CAPACITY);
+    return g->vertexNum++;
+}
+
+/* 添加边，边已存在或顶点不合法时返回 false */
+bool dynAddEdge(DynGraph *g, int u, int v) {
+    if (u == v || !dynHasVertex(g, u) || !dynHasVertex(g, v)) {
+        return false;
+    }
+    if (!dynBlockInsert(dynWritable(g, u), v)) {
+        return false;
+    }
+    dynBlockInsert(dynWritable(g, v), u);
+    g->edgeNum++;
+    return true;
+}
+
+/* 删除边，边不存在时返回 false */
+bool dynRemoveEdge(DynGraph *g, int u, int v) {
+    if (u == v || !dynHasVertex(g, u) || !dynHasVertex(g, v)) {
+        return false;
+    }
+    // 先确认边存在，避免对被共享的块做无意义的复制
+    if (dynBlockFind(g->blocks[u], v) < 0) {
+        return false;
+    }
+    dynBlockRemove(dynWritable(g, u), v);
+    dynBlockRemove(dynWritable(g, v), u);
+    g->edgeNum--;
+    return true;
+}
+
+/* 判断边是否存在 */
+bool dynHasEdge(DynGraph *g, int u, int v) {
+    return dynHasVertex(g, u) && dynHasVertex(g, v) && dynBlockFind(g->blocks[u], v) >= 0;
+}
+
+/* 删除顶点及其所有边，编号不再使用 */
+void dynRemoveVertex(DynGraph *g, int v) {
+    if (!dynHasVertex(g, v)) {
+        printf("Vertex is not existent!\n");
+        return;
+    }
+    DynAdjBlock *b = g->blocks[v];
+    for (int i = 0; i < b->size; i++) {
+        if (b->nbrs[i] != DYN_TOMBSTONE) {
+            dynBlockRemove(dynWritable(g, b->nbrs[i]), v);
+            g->edgeNum--;
+        }
+    }
+    dynBlockRelease(b);
+    g->blocks[v] = NULL;
+}
+
+/* 获取顶点的度 */
+int dynDegree(DynGraph *g, int v) {
+    return dynHasVertex(g, v) ? g->blocks[v]->live : 0;
+}
+
+/* 批量更新的线程参数 */
+typedef struct {
+    DynGraph *g;
+    int *offsets;        // 起点 u 的有向更新位于 ops[offsets[u], offsets[u + 1])
+    DynEdgeUpdate *ops;  // 按起点排序的有向更新
+    int begin, end;      // 负责的起点区间
+    long long changed;   // 成功的有向更新数量（添加为正，删除为负）
+} DynBatchTask;
+
+/* 线程函数：依次执行区间内各起点的更新 */
+void *dynBatchWorker(void *arg) {
+    DynBatchTask *t = arg;
+    DynGraph *g = t->g;
+    for (int u = t->begin; u < t->end; u++) {
+        if (t->offsets[u] == t->offsets[u + 1] || g->blocks[u] == NULL) {
+            continue;
+        }
+        DynAdjBlock *b = dynWritable(g, u);
+        for (int i = t->offsets[u]; i < t->offsets[u + 1]; i++) {
+            DynEdgeUpdate *op = &t->ops[i];
+            if (op->insert) {
+                t->changed += dynBlockInsert(b, op->v);
+            } else {
+                t->changed -= dynBlockRemove(b, op->v);
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  批量更新
+ * @param  g            动态图
+ * @param  updates      无向边更新，按数组顺序生效（同一条边先添加后删除，结果为删除）
+ * @param  count        更新数量
+ * @param  threadNum    线程数量
+ * @retval long long    边数量的变化量
+ * @note   不合法的更新（自环、顶点不存在）被忽略。两个方向的有向更新在各自的起点上以相同的相对顺序执行，
+ *         因此无向边的两个方向始终保持一致。
+ */
+long long dynApplyBatch(DynGraph *g, DynEdgeUpdate *updates, int count, int threadNum) {
+    int n = g->vertexNum;
+    if (threadNum < 1) {
+        threadNum = 1;
+    }
+    /* 1. 拆成有向更新并按起点计数排序 */
+    int *offsets = calloc(n + 1, sizeof(int));
+    for (int i = 0; i < count; i++) {
+        DynEdgeUpdate *up = &updates[i];
+        if (up->u != up->v && dynHasVertex(g, up->u) && dynHasVertex(g, up->v)) {
+            offsets[up->u + 1]++;
+            offsets[up->v + 1]++;
+        }
+    }
+    for (int u = 0; u < n; u++) {
+        offsets[u + 1] += offsets[u];
+    }
+    DynEdgeUpdate *ops = malloc(sizeof(DynEdgeUpdate) * (offsets[n] + 1));
+    int *cursor = malloc(sizeof(int) * (n + 1));
+    memcpy(cursor, offsets, sizeof(int) * (n + 1));
+    for (int i = 0; i < count; i++) {
+        DynEdgeUpdate *up = &updates[i];
+        if (up->u != up->v && dynHasVertex(g, up->u) && dynHasVertex(g, up->v)) {
+            ops[cursor[up->u]++] = (DynEdgeUpdate){up->u, up->v, up->insert};
+            ops[cursor[up->v]++] = (DynEdgeUpdate){up->v, up->u, up->insert};
+        }
+    }
+    free(cursor);
+
+    /* 2. 按有向更新数量均分起点区间，各线程并行执行 */
+    DynBatchTask *tasks = malloc(sizeof(DynBatchTask) * threadNum);
+    pthread_t *tids = malloc(sizeof(pthread_t) * threadNum);
+    int u = 0;
+    for (int i = 0; i < threadNum; i++) {
+        long long target = (long long)offsets[n] * (i + 1) / threadNum;
+        int begin = u;
+        while (u < n && (i == threadNum - 1 || offsets[u + 1] <= target)) {
+            u++;
+        }
+        tasks[i] = (DynBatchTask){g, offsets, ops, begin, u, 0};
+    }
+    for (int i = 1; i < threadNum; i++) {
+        pthread_create(&tids[i], NULL, dynBatchWorker, &tasks[i]);
+    }
+    dynBatchWorker(&tasks[0]);
+    long long changed = tasks[0].changed;
+    for (int i = 1; i < threadNum; i++) {
+        pthread_join(tids[i], NULL);
+        changed += tasks[i].changed;
+    }
+    // 每条无向边对应两条有向更新
+    g->edgeNum += changed / 2;
+
+    free(tasks);
+    free(tids);
+    free(offsets);
+    free(ops);
+    return changed / 2;
+}
+
+/* 创建快照：共享当前所有数组块 */
+DynSnapshot *dynSnapshot(DynGraph *g) {
+    DynSnapshot *s = malloc(sizeof(DynSnapshot));
+    s->vertexNum = g->vertexNum;
+    s->edgeNum = g->edgeNum;
+    s->blocks = malloc(sizeof(DynAdjBlock *) * (g->vertexNum + 1));
+    for (int v = 0; v < g->vertexNum; v++) {
+        s->blocks[v] = g->blocks[v];
+        if (s->blocks[v] != NULL) {
+            __atomic_add_fetch(&s->blocks[v]->refCount, 1, __ATOMIC_ACQ_REL);
+        }
+    }
+    return s;
+}
+
+/* 释放快照 */
+void delDynSnapshot(DynSnapshot *s) {
+    for (int v = 0; v < s->vertexNum; v++) {
+        dynBlockRelease(s->blocks[v]);
+    }
+    free(s->blocks);
+    free(s);
+}
+
+/* 将快照中顶点 v 的有效邻接顶点写入 out ，返回数量 */
+int dynSnapshotNeighbors(DynSnapshot *s, int v, int *out) {
+    DynAdjBlock *b = s->blocks[v];
+    int cnt = 0;
+    if (b == NULL) {
+        return 0;
+    }
+    for (int i = 0; i < b->size; i++) {
+        if (b->nbrs[i] != DYN_TOMBSTONE) {
+            out[cnt++] = b->nbrs[i];
+        }
+    }
+    return cnt;
+}
+
+/* 将快照转换为 CSR ，以便使用 CSR 上的各种算法 */
+GraphCSR *dynSnapshotToCSR(DynSnapshot *s) {
+    int n = s->vertexNum;
+    GraphCSR *csr = malloc(sizeof(GraphCSR));
+    csr->vertexNum = n;
+    csr->offsets = malloc(sizeof(long long) * (n + 1));
+    csr->offsets[0] = 0;
+    for (int v = 0; v < n; v++) {
+        csr->offsets[v + 1] = csr->offsets[v] + (s->blocks[v] == NULL ? 0 : s->blocks[v]->live);
+    }
+    csr->edgeNum = csr->offsets[n];
+    csr->neighbors = malloc(sizeof(int) * (csr->edgeNum + 1));
+    csr->weights = NULL;
+    csr->vertices = NULL;
+    for (int v = 0; v < n; v++) {
+        dynSnapshotNeighbors(s, v, csr->neighbors + csr->offsets[v]);
+    }
+    return csr;
+}
+
+/* 打印动态图 */
+void printDynGraph(DynGraph *g) {
+    printf("动态图 =\n");
+    for (int v = 0; v < g->vertexNum; v++) {
+        DynAdjBlock *b = g->blocks[v];
+        if (b == NULL) {
+            continue;
+        }
+        printf("%d: [", v);
+        bool first = true;
+        for (int i = 0; i < b->size; i++) {
+            if (b->nbrs[i] != DYN_TOMBSTONE) {
+                printf(first ? "%d" : ", %d", b->nbrs[i]);
+                first = false;
+            }
+        }
+        printf("]（容量 %d ，墓碑 %d）\n", b->capacity, b->size - b->live);
+    }
+}
@@ -0,0 +1,345 @@
+/**
+ * @FileName    :graph_dynamic_test.c
+ * @Date        :2026-10-20 01:31:08
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :动态图测试程序
+ * @Description :1. 基本测试：与 graph_adjacency_list_test.c 相同的操作序列
+ *               2. 正确性：随机的单条 / 批量（1 ~ 4 线程）增删边与删除顶点，与邻接矩阵暴力结果对比；
+ *                  快照在之后的修改中保持不变
+ *               3. 并发读：读线程在快照上反复 BFS ，写线程同时批量更新
+ *               4. 性能：默认 10^5 个顶点（-DBENCH_VERTICES 调整）上添加 BENCH_UPDATES 条随机边再删除一半，
+ *                  对比链表邻接表（直接调用 addEdgeHelper / removeEdgeHelper ，不经过 O(n) 的 findNode）、
+ *                  动态图逐条更新与批量更新（1 / 2 / 4 线程）的吞吐量。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_dynamic.c"
+
+#ifndef BENCH_VERTICES
+#define BENCH_VERTICES 100000
+#endif
+#ifndef BENCH_UPDATES
+#define BENCH_UPDATES 2000000
+#endif
+// 批量更新的批大小
+#define BENCH_BATCH 100000
+
+/* 基本测试 */
+void testBasic() {
+    // 顶点 0 ~ 4 对应 graph_adjacency_list_test.c 中的顶点 1, 3, 2, 5, 4
+    DynGraph *g = newDynGraph(5);
+    int edges[][2] = {{0, 1}, {0, 3}, {1, 2}, {2, 3}, {2, 4}, {3, 4}};
+    for (int i = 0; i < 6; i++) {
+        dynAddEdge(g, edges[i][0], edges[i][1]);
+    }
+    printf("\n初始化后，图为\n");
+    printDynGraph(g);
+
+    /* 添加边 */
+    dynAddEdge(g, 0, 2);
+    printf("\n添加边 0-2 后，图为\n");
+    printDynGraph(g);
+
+    /* 删除边 */
+    dynRemoveEdge(g, 0, 1);
+    printf("\n删除边 0-1 后，图为\n");
+    printDynGraph(g);
+
+    /* 添加顶点 */
+    int v = dynAddVertex(g);
+    printf("\n添加顶点 %d 后，图为\n", v);
+    printDynGraph(g);
+
+    /* 删除顶点：其他顶点编号不变 */
+    dynRemoveVertex(g, 1);
+    printf("\n删除顶点 1 后，图为\n");
+    printDynGraph(g);
+    assert(g->edgeNum == 5 && dynHasEdge(g, 0, 2) && !dynHasEdge(g, 1, 2));
+
+    /* 批量更新 */
+    DynEdgeUpdate batch[] = {{0, 4, true}, {4, 5, true}, {2, 3, false}, {4, 5, false}, {5, 0, true}};
+    long long changed = dynApplyBatch(g, batch, 5, 2);
+    printf("\n批量更新后（边数量变化 %lld），图为\n", changed);
+    printDynGraph(g);
+    assert(changed == 1 && g->edgeNum == 6 && !dynHasEdge(g, 4, 5) && dynHasEdge(g, 5, 0));
+
+    delDynGraph(g);
+}
+
+/* 对比动态图与邻接矩阵 */
+void checkMatrix(DynGraph *g, char *mat, int n) {
+    long long edges = 0;
+    for (int u = 0; u < n; u++) {
+        int deg = 0;
+        for (int v = 0; v < n; v++) {
+            assert(dynHasEdge(g, u, v) == mat[u * n + v]);
+            deg += mat[u * n + v];
+            edges += u < v && mat[u * n + v];
+        }
+        assert(dynDegree(g, u) == deg);
+    }
+    assert(g->edgeNum == edges);
+}
+
+/* 对比快照与邻接矩阵 */
+void checkSnapshot(DynSnapshot *s, char *mat, int n, int *buf) {
+    for (int u = 0; u < n; u++) {
+        int cnt = dynSnapshotNeighbors(s, u, buf), deg = 0;
+        for (int i = 0; i < cnt; i++) {
+            assert(mat[u * n + buf[i]]);
+        }
+        for (int v = 0; v < n; v++) {
+            deg += mat[u * n + v];
+        }
+        assert(cnt == deg);
+    }
+}
+
+/* 正确性 */
+void testRandom() {
+    int n = 200;
+    DynGraph *g = newDynGraph(n);
+    char *mat = calloc(n * n, 1), *snapMat = malloc(n * n);
+    bool *removed = calloc(n, sizeof(bool));
+    int *buf = malloc(sizeof(int) * n);
+    DynEdgeUpdate *batch = malloc(sizeof(DynEdgeUpdate) * 5000);
+    DynSnapshot *snap = NULL;
+    srand(2026);
+    for (int round = 0; round < 60; round++) {
+        /* 单条更新：前半段以添加为主，后半段以删除为主，触发扩容、哈希索引与墓碑压缩 */
+        int insertRate = round < 30 ? 70 : 30;
+        for (int i = 0; i < 3000; i++) {
+            int u = rand() % n, v = rand() % n;
+            bool ok = u != v && !removed[u] && !removed[v];
+            if (rand() % 100 < insertRate) {
+                assert(dynAddEdge(g, u, v) == (ok && !mat[u * n + v]));
+                if (ok) {
+                    mat[u * n + v] = mat[v * n + u] = 1;
+                }
+            } else {
+                assert(dynRemoveEdge(g, u, v) == (ok && mat[u * n + v]));
+                mat[u * n + v] = mat[v * n + u] = 0;
+            }
+        }
+        /* 批量更新 */
+        int count = 2000 + rand() % 3000;
+        for (int i = 0; i < count; i++) {
+            int u = rand() % n, v = rand() % n;
+            batch[i] = (DynEdgeUpdate){u, v, rand() % 100 < insertRate};
+            if (u != v && !removed[u] && !removed[v]) {
+                mat[u * n + v] = mat[v * n + u] = batch[i].insert;
+            }
+        }
+        dynApplyBatch(g, batch, count, round % 4 + 1);
+        /* 偶尔删除顶点 */
+        if (round % 10 == 9) {
+            int v = rand() % n;
+            if (!removed[v]) {
+                dynRemoveVertex(g, v);
+                removed[v] = true;
+                for (int u = 0; u < n; u++) {
+                    mat[u * n + v] = mat[v * n + u] = 0;
+                }
+            }
+        }
+        checkMatrix(g, mat, n);
+        /* 快照：检查上一个快照未被之后的修改影响，再创建新快照 */
+        if (round % 5 == 0) {
+            if (snap != NULL) {
+                checkSnapshot(snap, snapMat, n, buf);
+                delDynSnapshot(snap);
+            }
+            snap = dynSnapshot(g);
+            memcpy(snapMat, mat, n * n);
+        }
+    }
+    checkSnapshot(snap, snapMat, n, buf);
+    // 图先于快照释放，共享的数组块在快照释放时才释放
+    delDynGraph(g);
+    checkSnapshot(snap, snapMat, n, buf);
+    delDynSnapshot(snap);
+    printf("\n随机单条 / 批量更新、删除顶点与快照的结果均与邻接矩阵一致\n");
+    free(mat);
+    free(snapMat);
+    free(removed);
+    free(buf);
+    free(batch);
+}
+
+/* 读线程参数 */
+typedef struct {
+    DynSnapshot *snap;
+    long long visited; // BFS 访问的顶点总数
+    bool ok;
+} SnapReader;
+
+/* 读线程：在快照上反复 BFS ，检查快照的边数量不变 */
+void *snapReaderRun(void *arg) {
+    SnapReader *r = arg;
+    DynSnapshot *s = r->snap;
+    int n = s->vertexNum;
+    int *queue = malloc(sizeof(int) * n), *buf = malloc(sizeof(int) * n);
+    char *visited = malloc(n);
+    r->ok = true;
+    r->visited = 0;
+    for (int rep = 0; rep < 5; rep++) {
+        long long degSum = 0;
+        memset(visited, 0, n);
+        for (int src = 0; src < n; src++) {
+            if (visited[src] || s->blocks[src] == NULL) {
+                continue;
+            }
+            int front = 0, rear = 0;
+            queue[rear++] = src;
+            visited[src] = 1;
+            while (front < rear) {
+                int v = queue[front++];
+                int cnt = dynSnapshotNeighbors(s, v, buf);
+                degSum += cnt;
+                for (int i = 0; i < cnt; i++) {
+                    if (!visited[buf[i]]) {
+                        visited[buf[i]] = 1;
+                        queue[rear++] = buf[i];
+                    }
+                }
+            }
+            r->visited += rear;
+        }
+        r->ok &= degSum == 2 * s->edgeNum;
+    }
+    free(queue);
+    free(buf);
+    free(visited);
+    return NULL;
+}
+
+/* 并发读：写线程批量更新的同时，读线程在快照上 BFS */
+void testConcurrentSnapshot() {
+    int n = 20000, count = 50000;
+    DynGraph *g = newDynGraph(n);
+    DynEdgeUpdate *batch = malloc(sizeof(DynEdgeUpdate) * count);
+    srand(7);
+    for (int i = 0; i < count; i++) {
+        batch[i] = (DynEdgeUpdate){rand() % n, rand() % n, true};
+    }
+    dynApplyBatch(g, batch, count, 1);
+    SnapReader readers[2];
+    pthread_t tids[2];
+    for (int i = 0; i < 2; i++) {
+        readers[i].snap = dynSnapshot(g);
+        pthread_create(&tids[i], NULL, snapReaderRun, &readers[i]);
+    }
+    // 读线程运行期间继续更新
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < count; i++) {
+            batch[i] = (DynEdgeUpdate){rand() % n, rand() % n, rand() % 2 == 0};
+        }
+        dynApplyBatch(g, batch, count, 2);
+    }
+    for (int i = 0; i < 2; i++) {
+        pthread_join(tids[i], NULL);
+        assert(readers[i].ok);
+        delDynSnapshot(readers[i].snap);
+    }
+    printf("\n写线程更新的同时，读线程在快照上 BFS 访问了 %lld 个顶点，快照保持一致\n", readers[0].visited);
+    free(batch);
+    delDynGraph(g);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    int n = BENCH_VERTICES, m = BENCH_UPDATES, half = m / 2;
+    int *us = malloc(sizeof(int) * m), *vs = malloc(sizeof(int) * m);
+    srand(2026);
+    for (int i = 0; i < m; i++) {
+        us[i] = rand() % n;
+        vs[i] = (us[i] + 1 + rand() % (n - 1)) % n;
+    }
+    printf("\n%d 个顶点，添加 %d 条随机边，再删除其中 %d 条（吞吐量单位：百万条/秒）\n", n, m, half);
+
+    /* 链表邻接表 */
+    int *vals = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        vals[i] = i;
+    }
+    Vertex **vets = valsToVets(vals, n);
+    GraphAdjList *list = newGraphAdjList();
+    for (int i = 0; i < n; i++) {
+        addVertex(list, vets[i]);
+    }
+    double start = wallSeconds();
+    for (int i = 0; i < m; i++) {
+        addEdgeHelper(list->heads[us[i]], vets[vs[i]]);
+        addEdgeHelper(list->heads[vs[i]], vets[us[i]]);
+    }
+    double insertTime = wallSeconds() - start;
+    start = wallSeconds();
+    for (int i = 0; i < half; i++) {
+        removeEdgeHelper(list->heads[us[i]], vets[vs[i]]);
+        removeEdgeHelper(list->heads[vs[i]], vets[us[i]]);
+    }
+    double removeTime = wallSeconds() - start;
+    printf("%-24s 添加 %6.2f  删除 %6.2f\n", "链表邻接表", m / insertTime / 1e6, half / removeTime / 1e6);
+    delGraphAdjList(list);
+    free(vets);
+    free(vals);
+
+    /* 动态图逐条更新 */
+    DynGraph *g = newDynGraph(n);
+    start = wallSeconds();
+    for (int i = 0; i < m; i++) {
+        dynAddEdge(g, us[i], vs[i]);
+    }
+    insertTime = wallSeconds() - start;
+    long long expect = g->edgeNum;
+    start = wallSeconds();
+    for (int i = 0; i < half; i++) {
+        dynRemoveEdge(g, us[i], vs[i]);
+    }
+    removeTime = wallSeconds() - start;
+    long long expectAfter = g->edgeNum;
+    printf("%-24s 添加 %6.2f  删除 %6.2f\n", "动态图（逐条）", m / insertTime / 1e6, half / removeTime / 1e6);
+    delDynGraph(g);
+
+    /* 动态图批量更新 */
+    DynEdgeUpdate *ups = malloc(sizeof(DynEdgeUpdate) * m);
+    for (int threadNum = 1; threadNum <= 4; threadNum *= 2) {
+        g = newDynGraph(n);
+        for (int i = 0; i < m; i++) {
+            ups[i] = (DynEdgeUpdate){us[i], vs[i], true};
+        }
+        start = wallSeconds();
+        for (int i = 0; i < m; i += BENCH_BATCH) {
+            dynApplyBatch(g, ups + i, m - i < BENCH_BATCH ? m - i : BENCH_BATCH, threadNum);
+        }
+        insertTime = wallSeconds() - start;
+        assert(g->edgeNum == expect);
+        for (int i = 0; i < half; i++) {
+            ups[i].insert = false;
+        }
+        start = wallSeconds();
+        for (int i = 0; i < half; i += BENCH_BATCH) {
+            dynApplyBatch(g, ups + i, half - i < BENCH_BATCH ? half - i : BENCH_BATCH, threadNum);
+        }
+        removeTime = wallSeconds() - start;
+        assert(g->edgeNum == expectAfter);
+        char name[64];
+        snprintf(name, sizeof(name), "动态图（批量，%d 线程）", threadNum);
+        printf("%-24s 添加 %6.2f  删除 %6.2f\n", name, m / insertTime / 1e6, half / removeTime / 1e6);
+        delDynGraph(g);
+    }
+
+    free(ups);
+    free(us);
+    free(vs);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testRandom", testRandom);
+    runTest("testConcurrentSnapshot", testConcurrentSnapshot);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
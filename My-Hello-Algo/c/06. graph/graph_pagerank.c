@@ -0,0 +1,425 @@
+/**
+ * @FileName    :graph_pagerank.c
+ * @Date        :2026-10-20 00:05:47
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :PageRank 与个性化 PageRank
+ * @Description :rank 为随机游走的平稳分布：每一步以概率 d（阻尼系数）沿随机出边前进，以概率 1 - d 跳转到传送分布 t ：
+ *                  全局 PageRank 中 t 为均匀分布，个性化 PageRank（PPR）中 t 集中在起点 source 上。
+ *               没有出边的顶点（悬挂顶点）的 rank 按传送分布 t 重新分配。
+ *               1. 拉取式（pull）幂迭代，与稀疏矩阵乘向量（SpMV）相同：
+ *                  contrib[u] = rank[u] / outDeg(u) ，next[v] = (1 - d) t(v) + d (Σ_{u -> v} contrib[u] + dangling t(v)) ，
+ *                  每个顶点只写自己的 next[v] ，无需原子操作；当 ||next - rank||_1 < tolerance 或达到最大迭代次数时停止。
+ *                  需要入边：无向图（每条边双向存储）直接使用原图，有向图需传入 csrTranspose 得到的转置图。
+ *                  内层循环为按邻接顶点编号的间接求和，x86 上运行时分发到 AVX2 gather 实现。
+ *                  多线程使用 barrier 同步的常驻线程池，顶点划分支持两种调度方式：
+ *                      静态调度：按入边数量均分顶点区间，每轮划分相同，无调度开销；
+ *                      动态调度：线程每次原子地领取 chunk 个顶点，适合度数分布极不均匀的幂律图。
+ *               2. 推送式（push）个性化 PageRank（Andersen-Chung-Lang）：维护估计值 p 与残差 r（初始 r[source] = 1），
+ *                  每次选取 r[u] > epsilon * outDeg(u) 的顶点 u ：p[u] += (1 - d) r[u] ，
+ *                  再将 d r[u] 平均推给出边邻居，r[u] = 0 ；只访问 source 附近的顶点，
+ *                  总推送量为 O(1 / ((1 - d) epsilon)) ，与图的规模无关。误差满足 ||ppr - p||_1 <= Σ r 。
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "graph_csr.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PAGERANK_X86
+#endif
+
+/* 调度方式 */
+typedef enum {
+    PR_STATIC,  // 静态调度
+    PR_DYNAMIC, // 动态调度
+} PRSchedule;
+
+/* PageRank 参数 */
+typedef struct {
+    double damping;      // 阻尼系数
+    double tolerance;    // 收敛阈值（相邻两轮 rank 之差的 L1 范数）
+    int maxIters;        // 最大迭代次数
+    int threadNum;       // 线程数量
+    PRSchedule schedule; // 调度方式
+    int chunk;           // 动态调度每次领取的顶点数量
+    int source;          // 个性化 PageRank 的起点，-1 表示全局 PageRank
+} PageRankOptions;
+
+/* 默认参数 */
+PageRankOptions pageRankDefaultOptions() {
+    return (PageRankOptions){0.85, 1e-6, 100, 1, PR_STATIC, 1024, -1};
+}
+
+/* 转置图：边 u -> v 变为 v -> u ，用于有向图的拉取式迭代 */
+GraphCSR *csrTranspose(GraphCSR *csr) {
+    int n = csr->vertexNum;
+    // 原图的邻接顶点即为转置图的起点，原图的起点即为转置图的终点
+    int *dst = malloc(sizeof(int) * (csr->edgeNum + 1));
+    for (int u = 0; u < n; u++) {
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            dst[e] = u;
+        }
+    }
+    GraphCSR *res = newGraphCSRFromEdges(n, csr->neighbors, dst, csr->weights, csr->edgeNum, false, 1);
+    free(dst);
+    return res;
+}
+
+/* 间接求和：Σ contrib[idx[i]] ，0 <= i < len */
+typedef double (*PRGatherSumFunc)(const double *contrib, const int *idx, int len);
+
+/* 通用实现：4 路展开，减少浮点加法的依赖链 */
+double prGatherSumGeneric(const double *contrib, const int *idx, int len) {
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        s0 += contrib[idx[i]];
+        s1 += contrib[idx[i + 1]];
+        s2 += contrib[idx[i + 2]];
+        s3 += contrib[idx[i + 3]];
+    }
+    for (; i < len; i++) {
+        s0 += contrib[idx[i]];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+#ifdef PAGERANK_X86
+/* AVX2 实现：每次 gather 4 个 double ，两个累加器交替使用 */
+__attribute__((target("avx2"))) double prGatherSumAVX2(const double *contrib, const int *idx, int len) {
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m128i i0 = _mm_loadu_si128((const __m128i *)(idx + i));
+        __m128i i1 = _mm_loadu_si128((const __m128i *)(idx + i + 4));
+        acc0 = _mm256_add_pd(acc0, _mm256_i32gather_pd(contrib, i0, 8));
+        acc1 = _mm256_add_pd(acc1, _mm256_i32gather_pd(contrib, i1, 8));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+    double sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    for (; i < len; i++) {
+        sum += contrib[idx[i]];
+    }
+    return sum;
+}
+#endif
+
+/* 根据 CPU 支持的指令集选择实现 */
+PRGatherSumFunc prGatherSumSelect() {
+#ifdef PAGERANK_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return prGatherSumAVX2;
+    }
+#endif
+    return prGatherSumGeneric;
+}
+
+// 间接求和的实现，为 NULL 时在 pageRankPull 开始时（创建线程前）完成分发
+PRGatherSumFunc prGatherSum = NULL;
+
+/* 每个线程的部分和，填充到缓存行大小，减少伪共享 */
+typedef struct {
+    double dangling; // 悬挂顶点的 rank 之和
+    double diff;     // |next - rank| 之和
+    char pad[48];
+} PRPartial;
+
+/* 拉取式迭代的共享状态 */
+typedef struct {
+    GraphCSR *out, *in;     // 出边图与入边图
+    const PageRankOptions *opt;
+    double *rank, *next;    // 本轮与下一轮的 rank
+    double *contrib;        // rank[u] / outDeg(u)
+    double dangling;        // 本轮悬挂顶点的 rank 之和
+    int *bounds;            // 静态调度：线程 t 负责顶点 [bounds[t], bounds[t + 1])
+    int cursor;             // 动态调度：下一个待领取的顶点
+    PRPartial *partial;
+    int phase;              // 0 ：计算 contrib ；1 ：拉取求和
+    bool done;              // 通知线程退出
+    pthread_barrier_t barrier;
+} PRState;
+
+/* 线程参数 */
+typedef struct {
+    PRState *state;
+    int tid;
+} PRWorker;
+
+/* 计算区间内顶点的 contrib ，累加悬挂顶点的 rank */
+void prContribRange(PRState *s, int begin, int end, PRPartial *part) {
+    GraphCSR *out = s->out;
+    double dangling = 0;
+    for (int u = begin; u < end; u++) {
+        long long d = out->offsets[u + 1] - out->offsets[u];
+        if (d == 0) {
+            dangling += s->rank[u];
+            s->contrib[u] = 0;
+        } else {
+            s->contrib[u] = s->rank[u] / d;
+        }
+    }
+    part->dangling += dangling;
+}
+
+/* 拉取求和：计算区间内顶点的 next ，累加变化量 */
+void prPullRange(PRState *s, int begin, int end, PRPartial *part) {
+    GraphCSR *in = s->in;
+    int n = in->vertexNum, source = s->opt->source;
+    double d = s->opt->damping;
+    // 全局 PageRank 的传送分布为均匀分布；个性化 PageRank 只在 source 处非零
+    double teleport = source < 0 ? 1.0 / n : 0;
+    double base = (1 - d) * teleport + d * s->dangling * teleport;
+    double diff = 0;
+    for (int v = begin; v < end; v++) {
+        long long e = in->offsets[v];
+        double sum = prGatherSum(s->contrib, in->neighbors + e, (int)(in->offsets[v + 1] - e));
+        double x = base + d * sum;
+        if (v == source) {
+            x += (1 - d) + d * s->dangling;
+        }
+        diff += fabs(x - s->rank[v]);
+        s->next[v] = x;
+    }
+    part->diff += diff;
+}
+
+/* 执行本线程在当前阶段的工作 */
+void prRunPart(PRState *s, int tid) {
+    PRPartial *part = &s->partial[tid];
+    int threadNum = s->opt->threadNum, n = s->in->vertexNum;
+    if (s->phase == 0) {
+        // contrib 每个顶点工作量相同，按顶点数均分
+        prContribRange(s, (int)((long long)n * tid / threadNum), (int)((long long)n * (tid + 1) / threadNum), part);
+    } else if (s->opt->schedule == PR_STATIC) {
+        prPullRange(s, s->bounds[tid], s->bounds[tid + 1], part);
+    } else {
+        int chunk = s->opt->chunk;
+        while (true) {
+            int begin = __atomic_fetch_add(&s->cursor, chunk, __ATOMIC_RELAXED);
+            if (begin >= n) {
+                break;
+            }
+            prPullRange(s, begin, begin + chunk < n ? begin + chunk : n, part);
+        }
+    }
+}
+
+/* 工作线程：等待阶段开始 -> 计算 -> 等待阶段结束 */
+void *prWorkerRun(void *arg) {
+    PRWorker *w = arg;
+    PRState *s = w->state;
+    while (true) {
+        pthread_barrier_wait(&s->barrier);
+        if (s->done) {
+            break;
+        }
+        prRunPart(s, w->tid);
+        pthread_barrier_wait(&s->barrier);
+    }
+    return NULL;
+}
+
+/* 由主线程（tid 0）发起一个阶段 */
+void prRunPhase(PRState *s, int phase) {
+    int threadNum = s->opt->threadNum;
+    s->phase = phase;
+    s->cursor = 0;
+    for (int t = 0; t < threadNum; t++) {
+        s->partial[t].dangling = s->partial[t].diff = 0;
+    }
+    if (threadNum > 1) {
+        pthread_barrier_wait(&s->barrier);
+    }
+    prRunPart(s, 0);
+    if (threadNum > 1) {
+        pthread_barrier_wait(&s->barrier);
+    }
+}
+
+/* 静态调度：按入边数量均分顶点区间 */
+void prStaticBounds(GraphCSR *in, int threadNum, int *bounds) {
+    int n = in->vertexNum;
+    bounds[0] = 0;
+    for (int t = 1; t < threadNum; t++) {
+        // 每个顶点额外计 1 ，使孤立顶点较多时也能大致均分
+        long long target = (in->edgeNum + n) * t / threadNum;
+        int lo = bounds[t - 1], hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (in->offsets[mid] + mid < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        bounds[t] = lo;
+    }
+    bounds[threadNum] = n;
+}
+
+/**
+ * @brief  拉取式 PageRank
+ * @param  csr          图（出边）
+ * @param  transpose    转置图（入边），无向图传 NULL
+ * @param  opt          参数，为 NULL 时使用默认参数
+ * @param  rank         输出：各顶点的 rank ，总和为 1
+ * @retval int          迭代次数，未在 maxIters 轮内收敛时返回 -1
+ */
+int pageRankPull(GraphCSR *csr, GraphCSR *transpose, const PageRankOptions *opt, double *rank) {
+    PageRankOptions defaults = pageRankDefaultOptions();
+    if (opt == NULL) {
+        opt = &defaults;
+    }
+    int n = csr->vertexNum, threadNum = opt->threadNum < 1 ? 1 : opt->threadNum;
+    if (n == 0) {
+        return 0;
+    }
+    if (prGatherSum == NULL) {
+        prGatherSum = prGatherSumSelect();
+    }
+    // 线程数量修正后的参数副本，供各线程读取
+    PageRankOptions o = *opt;
+    o.threadNum = threadNum;
+    if (o.chunk < 1) {
+        o.chunk = 1;
+    }
+    PRState s;
+    s.out = csr;
+    s.in = transpose == NULL ? csr : transpose;
+    s.opt = &o;
+    s.rank = rank;
+    s.next = malloc(sizeof(double) * n);
+    s.contrib = malloc(sizeof(double) * n);
+    s.bounds = malloc(sizeof(int) * (threadNum + 1));
+    s.partial = malloc(sizeof(PRPartial) * threadNum);
+    s.done = false;
+    prStaticBounds(s.in, threadNum, s.bounds);
+    for (int v = 0; v < n; v++) {
+        rank[v] = o.source < 0 ? 1.0 / n : v == o.source;
+    }
+
+    pthread_t *tids = malloc(sizeof(pthread_t) * threadNum);
+    PRWorker *workers = malloc(sizeof(PRWorker) * threadNum);
+    if (threadNum > 1) {
+        pthread_barrier_init(&s.barrier, NULL, threadNum);
+        for (int i = 1; i < threadNum; i++) {
+            workers[i] = (PRWorker){&s, i};
+            pthread_create(&tids[i], NULL, prWorkerRun, &workers[i]);
+        }
+    }
+
+    int iters = -1;
+    for (int it = 1; it <= o.maxIters; it++) {
+        /* 1. contrib 与悬挂顶点的 rank 之和 */
+        prRunPhase(&s, 0);
+        s.dangling = 0;
+        for (int t = 0; t < threadNum; t++) {
+            s.dangling += s.partial[t].dangling;
+        }
+        /* 2. 拉取求和 */
+        prRunPhase(&s, 1);
+        double diff = 0;
+        for (int t = 0; t < threadNum; t++) {
+            diff += s.partial[t].diff;
+        }
+        double *tmp = s.rank;
+        s.rank = s.next;
+        s.next = tmp;
+        if (diff < o.tolerance) {
+            iters = it;
+            break;
+        }
+    }
+    // 奇数次交换后最新结果位于工作数组中
+    if (s.rank != rank) {
+        memcpy(rank, s.rank, sizeof(double) * n);
+        s.next = s.rank;
+    }
+
+    if (threadNum > 1) {
+        s.done = true;
+        pthread_barrier_wait(&s.barrier);
+        for (int i = 1; i < threadNum; i++) {
+            pthread_join(tids[i], NULL);
+        }
+        pthread_barrier_destroy(&s.barrier);
+    }
+    free(tids);
+    free(workers);
+    free(s.next);
+    free(s.contrib);
+    free(s.bounds);
+    free(s.partial);
+    return iters;
+}
+
+/**
+ * @brief  推送式个性化 PageRank
+ * @param  csr          图（出边）
+ * @param  source       起点
+ * @param  damping      阻尼系数
+ * @param  epsilon      残差阈值，越小越精确
+ * @param  p            输出：PPR 估计值
+ * @param  r            输出：剩余残差
+ * @retval long long    推送次数
+ */
+long long pprPush(GraphCSR *csr, int source, double damping, double epsilon, double *p, double *r) {
+    int n = csr->vertexNum;
+    for (int v = 0; v < n; v++) {
+        p[v] = r[v] = 0;
+    }
+    r[source] = 1;
+    // 先进先出的待推送队列（环形），inQueue 避免重复入队
+    int capacity = 1024, head = 0, size = 0;
+    int *queue = malloc(sizeof(int) * capacity);
+    bool *inQueue = calloc(n, sizeof(bool));
+    queue[size++] = source;
+    inQueue[source] = true;
+    long long pushes = 0;
+    while (size > 0) {
+        int u = queue[head];
+        head = (head + 1) % capacity;
+        size--;
+        inQueue[u] = false;
+        long long deg = csr->offsets[u + 1] - csr->offsets[u];
+        double ru = r[u];
+        if (ru <= epsilon * (deg == 0 ? 1 : deg)) {
+            continue;
+        }
+        pushes++;
+        p[u] += (1 - damping) * ru;
+        r[u] = 0;
+        // 悬挂顶点的游走回到起点，与拉取式的传送分布一致
+        int *targets = deg == 0 ? &source : csr->neighbors + csr->offsets[u];
+        double share = damping * ru / (deg == 0 ? 1 : deg);
+        for (long long i = 0; i < (deg == 0 ? 1 : deg); i++) {
+            int v = targets[i];
+            r[v] += share;
+            long long dv = csr->offsets[v + 1] - csr->offsets[v];
+            if (!inQueue[v] && r[v] > epsilon * (dv == 0 ? 1 : dv)) {
+                // 队列已满时扩容，并将环形的两段展开
+                if (size == capacity) {
+                    int *data = malloc(sizeof(int) * capacity * 2);
+                    for (int j = 0; j < size; j++) {
+                        data[j] = queue[(head + j) % capacity];
+                    }
+                    free(queue);
+                    queue = data;
+                    head = 0;
+                    capacity *= 2;
+                }
+                queue[(head + size) % capacity] = v;
+                size++;
+                inQueue[v] = true;
+            }
+        }
+    }
+    free(queue);
+    free(inQueue);
+    return pushes;
+}
@@ -0,0 +1,237 @@
+/**
+ * @FileName    :graph_pagerank_test.c
+ * @Date        :2026-10-20 00:34:12
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :PageRank 测试程序
+ * @Description :1. 基本测试：含悬挂顶点的小型有向图上的 PageRank 与个性化 PageRank
+ *               2. 正确性：随机有向图上，与朴素推送式幂迭代对比；通用 / AVX2 实现、静态 / 动态调度、1 ~ 4 线程结果一致；
+ *                  推送式 PPR 与拉取式 PPR 的误差不超过剩余残差之和
+ *               3. 性能：Kronecker 图（默认 scale 20 ，约 3.4 * 10^7 条有向边；-DBENCH_SCALE=22 约 1.3 * 10^8 条），
+ *                  固定迭代次数，对比各实现与调度方式的每秒迭代次数，以及推送式与拉取式 PPR 的单次查询耗时。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_pagerank.c"
+
+#ifndef BENCH_SCALE
+#define BENCH_SCALE 20
+#endif
+// 性能测试的迭代次数
+#define BENCH_ITERS 10
+
+/* 朴素实现：沿出边推送的幂迭代，固定迭代次数 */
+void pageRankNaive(GraphCSR *csr, double damping, int source, int iters, double *rank) {
+    int n = csr->vertexNum;
+    double *next = malloc(sizeof(double) * n);
+    for (int v = 0; v < n; v++) {
+        rank[v] = source < 0 ? 1.0 / n : v == source;
+    }
+    for (int it = 0; it < iters; it++) {
+        double dangling = 0;
+        for (int v = 0; v < n; v++) {
+            next[v] = 0;
+        }
+        for (int u = 0; u < n; u++) {
+            int d = csrDegree(csr, u);
+            if (d == 0) {
+                dangling += rank[u];
+            }
+            for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+                next[csr->neighbors[e]] += rank[u] / d;
+            }
+        }
+        for (int v = 0; v < n; v++) {
+            double t = source < 0 ? 1.0 / n : v == source;
+            rank[v] = (1 - damping) * t + damping * (next[v] + dangling * t);
+        }
+    }
+    free(next);
+}
+
+/* 两个向量之差的 L1 范数 */
+double l1Diff(double *a, double *b, int n) {
+    double sum = 0;
+    for (int v = 0; v < n; v++) {
+        sum += fabs(a[v] - b[v]);
+    }
+    return sum;
+}
+
+/* 基本测试 */
+void testBasic() {
+    // 有向图，顶点 4 没有出边
+    int src[] = {0, 0, 1, 2, 2, 3, 3};
+    int dst[] = {1, 2, 2, 0, 3, 0, 4};
+    GraphCSR *csr = newGraphCSRFromEdges(5, src, dst, NULL, 7, false, 1);
+    GraphCSR *transpose = csrTranspose(csr);
+    printGraphCSR(csr);
+
+    double rank[5], expect[5], p[5], r[5];
+    PageRankOptions opt = pageRankDefaultOptions();
+    opt.tolerance = 1e-12;
+    int iters = pageRankPull(csr, transpose, &opt, rank);
+    printf("PageRank（%d 轮收敛）：", iters);
+    for (int v = 0; v < 5; v++) {
+        printf("%.4f ", rank[v]);
+    }
+    pageRankNaive(csr, opt.damping, -1, 200, expect);
+    assert(iters > 0 && l1Diff(rank, expect, 5) < 1e-10);
+
+    opt.source = 0;
+    iters = pageRankPull(csr, transpose, &opt, rank);
+    printf("\n以顶点 0 为起点的个性化 PageRank（%d 轮收敛）：", iters);
+    for (int v = 0; v < 5; v++) {
+        printf("%.4f ", rank[v]);
+    }
+    long long pushes = pprPush(csr, 0, opt.damping, 1e-10, p, r);
+    printf("\n推送式（%lld 次推送）：", pushes);
+    for (int v = 0; v < 5; v++) {
+        printf("%.4f ", p[v]);
+    }
+    printf("\n");
+    assert(l1Diff(rank, p, 5) < 1e-8);
+
+    delGraphCSR(csr);
+    delGraphCSR(transpose);
+}
+
+/* 正确性 */
+void testValidate() {
+    int n = 3000;
+    long long m = 15000;
+    int *src = malloc(sizeof(int) * m), *dst = malloc(sizeof(int) * m);
+    srand(2026);
+    for (long long i = 0; i < m; i++) {
+        // 约一半的顶点没有出边
+        src[i] = rand() % (n / 2);
+        dst[i] = rand() % n;
+    }
+    GraphCSR *csr = newGraphCSRFromEdges(n, src, dst, NULL, m, false, 1);
+    GraphCSR *transpose = csrTranspose(csr);
+    double *expect = malloc(sizeof(double) * n), *rank = malloc(sizeof(double) * n);
+    double *p = malloc(sizeof(double) * n), *r = malloc(sizeof(double) * n);
+    PageRankOptions opt = pageRankDefaultOptions();
+    opt.tolerance = 0;
+    opt.maxIters = 50;
+    opt.chunk = 64;
+
+    PRGatherSumFunc funcs[] = {prGatherSumGeneric, prGatherSumSelect()};
+    for (int source = -1; source < 3; source += 2) {
+        pageRankNaive(csr, opt.damping, source, opt.maxIters, expect);
+        opt.source = source;
+        for (int k = 0; k < 2; k++) {
+            prGatherSum = funcs[k];
+            for (int threadNum = 1; threadNum <= 4; threadNum++) {
+                for (int schedule = PR_STATIC; schedule <= PR_DYNAMIC; schedule++) {
+                    opt.threadNum = threadNum;
+                    opt.schedule = schedule;
+                    assert(pageRankPull(csr, transpose, &opt, rank) == -1);
+                    assert(l1Diff(rank, expect, n) < 1e-10);
+                }
+            }
+        }
+    }
+    prGatherSum = NULL;
+
+    /* 推送式 PPR 与收敛后的拉取式 PPR 对比 */
+    opt = pageRankDefaultOptions();
+    opt.tolerance = 1e-13;
+    opt.maxIters = 1000;
+    double eps[] = {1e-4, 1e-6, 1e-8};
+    for (int source = 0; source < 5; source++) {
+        opt.source = source;
+        pageRankPull(csr, transpose, &opt, rank);
+        for (int i = 0; i < 3; i++) {
+            pprPush(csr, source, opt.damping, eps[i], p, r);
+            double residual = 0;
+            for (int v = 0; v < n; v++) {
+                residual += r[v];
+            }
+            assert(l1Diff(rank, p, n) <= residual + 1e-9);
+        }
+    }
+    printf("随机有向图上各实现、调度方式与线程数量的结果一致，推送式 PPR 误差不超过剩余残差\n");
+
+    free(src);
+    free(dst);
+    free(expect);
+    free(rank);
+    free(p);
+    free(r);
+    delGraphCSR(csr);
+    delGraphCSR(transpose);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    double start = wallSeconds();
+    int *src, *dst;
+    long long m = genKroneckerEdges(BENCH_SCALE, 16, BENCH_SCALE, &src, &dst);
+    GraphCSR *csr = newGraphCSRFromEdges(1 << BENCH_SCALE, src, dst, NULL, m, true, 1);
+    free(src);
+    free(dst);
+    int n = csr->vertexNum;
+    printf("\nKronecker 图：%d 个顶点，%lld 条有向边，生成耗时 %.3f s\n", n, csr->edgeNum, wallSeconds() - start);
+    double *rank = malloc(sizeof(double) * n), *expect = malloc(sizeof(double) * n);
+    PageRankOptions opt = pageRankDefaultOptions();
+    opt.tolerance = 0;
+    opt.maxIters = BENCH_ITERS;
+
+    /* 内层求和的实现 */
+    const char *names[] = {"通用", "运行时分发"};
+    PRGatherSumFunc funcs[] = {prGatherSumGeneric, prGatherSumSelect()};
+    for (int k = 0; k < 2; k++) {
+        prGatherSum = funcs[k];
+        start = wallSeconds();
+        pageRankPull(csr, NULL, &opt, k == 0 ? expect : rank);
+        double t = wallSeconds() - start;
+        printf("%-16s 1 线程  %.2f 轮/s ，%.1f M 边/s\n", names[k], BENCH_ITERS / t, csr->edgeNum * BENCH_ITERS / t / 1e6);
+    }
+    assert(l1Diff(rank, expect, n) < 1e-9);
+
+    /* 调度方式与线程数量 */
+    prGatherSum = prGatherSumSelect();
+    const char *schedules[] = {"静态调度", "动态调度"};
+    for (int schedule = PR_STATIC; schedule <= PR_DYNAMIC; schedule++) {
+        printf("%-16s", schedules[schedule]);
+        for (int threadNum = 1; threadNum <= 8; threadNum *= 2) {
+            opt.threadNum = threadNum;
+            opt.schedule = schedule;
+            start = wallSeconds();
+            pageRankPull(csr, NULL, &opt, rank);
+            printf("  %d 线程 %.2f 轮/s", threadNum, BENCH_ITERS / (wallSeconds() - start));
+            assert(l1Diff(rank, expect, n) < 1e-9);
+        }
+        printf("\n");
+    }
+
+    /* 个性化 PageRank 查询：推送式只访问起点附近的顶点 */
+    opt = pageRankDefaultOptions();
+    opt.source = 1;
+    start = wallSeconds();
+    int iters = pageRankPull(csr, NULL, &opt, expect);
+    printf("拉取式 PPR（tolerance = %g）%d 轮收敛，耗时 %.3f s\n", opt.tolerance, iters, wallSeconds() - start);
+    double *p = malloc(sizeof(double) * n), *r = malloc(sizeof(double) * n);
+    double eps[] = {1e-6, 1e-7, 1e-8};
+    for (int i = 0; i < 3; i++) {
+        start = wallSeconds();
+        long long pushes = pprPush(csr, opt.source, opt.damping, eps[i], p, r);
+        printf("推送式 PPR（epsilon = %g）%lld 次推送，耗时 %.3f s ，与拉取式的 L1 误差 %.2e\n",
+               eps[i], pushes, wallSeconds() - start, l1Diff(p, expect, n));
+    }
+
+    free(rank);
+    free(expect);
+    free(p);
+    free(r);
+    delGraphCSR(csr);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,285 @@
+/**
+ * @FileName    :graph_reorder_test.c
+ * @Date        :2026-10-19 23:36:25
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :顶点重排序测试程序
+ * @Description :1. 基本测试：按插入顺序编号的小图，三种重排方式得到的排列与重建后的 CSR
+ *               2. 正确性：随机图上排列合法、重建后边集不变，BFS 层数与 PageRank 映射回原编号后与原图一致
+ *               3. 性能：编号被随机打乱的网格道路网络（默认边长 1000 ，-DBENCH_SIDE 调整）与
+ *                  Kronecker 幂律图（默认 scale 18 ，-DBENCH_SCALE 调整）上，
+ *                  对比原始编号与三种重排后的平均对数间距、BFS 与 PageRank 耗时（含重排耗时）。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_reorder.c"
+
+#ifndef BENCH_SIDE
+#define BENCH_SIDE 1000
+#endif
+#ifndef BENCH_SCALE
+#define BENCH_SCALE 18
+#endif
+// PageRank 迭代次数
+#define PR_ITERS 20
+// BFS 起点数量
+#define BFS_ROOTS 8
+
+/* 生成 side x side 的网格（随机删去约 10% 的边），顶点编号随机打乱 */
+GraphCSR *newShuffledGrid(int side) {
+    int n = side * side;
+    int *src = malloc(sizeof(int) * 2 * n), *dst = malloc(sizeof(int) * 2 * n);
+    long long m = 0;
+    unsigned long long x = side;
+    for (int v = 0; v < n; v++) {
+        if (v % side + 1 < side && randU32(&x) % 10 != 0) {
+            src[m] = v;
+            dst[m++] = v + 1;
+        }
+        if (v / side + 1 < side && randU32(&x) % 10 != 0) {
+            src[m] = v;
+            dst[m++] = v + side;
+        }
+    }
+    shuffleVertexIds(src, dst, m, n, &x);
+    GraphCSR *csr = newGraphCSRFromEdges(n, src, dst, NULL, m, true, 1);
+    free(src);
+    free(dst);
+    return csr;
+}
+
+/* 生成 Kronecker 无向图（A = 0.57, B = C = 0.19, 边因子 16），顶点编号随机打乱 */
+GraphCSR *newKroneckerGraph(int scale) {
+    int *src, *dst;
+    long long m = genKroneckerEdges(scale, 16, scale, &src, &dst);
+    GraphCSR *csr = newGraphCSRFromEdges(1 << scale, src, dst, NULL, m, true, 1);
+    free(src);
+    free(dst);
+    return csr;
+}
+
+/* BFS 求各顶点的层数，不可达为 -1 ，queue 为工作区 */
+void bfsLevels(GraphCSR *csr, int source, int *level, int *queue) {
+    for (int v = 0; v < csr->vertexNum; v++) {
+        level[v] = -1;
+    }
+    int front = 0, rear = 0;
+    queue[rear++] = source;
+    level[source] = 0;
+    while (front < rear) {
+        int v = queue[front++];
+        for (long long e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+            int u = csr->neighbors[e];
+            if (level[u] == -1) {
+                level[u] = level[v] + 1;
+                queue[rear++] = u;
+            }
+        }
+    }
+}
+
+/* 拉取式 PageRank（阻尼系数 0.85 ，固定迭代次数），contrib 为工作区 */
+void pageRankSweep(GraphCSR *csr, int iters, double *rank, double *contrib) {
+    int n = csr->vertexNum;
+    for (int v = 0; v < n; v++) {
+        rank[v] = 1.0 / n;
+    }
+    for (int it = 0; it < iters; it++) {
+        for (int v = 0; v < n; v++) {
+            int d = csrDegree(csr, v);
+            contrib[v] = d == 0 ? 0 : rank[v] / d;
+        }
+        for (int v = 0; v < n; v++) {
+            double sum = 0;
+            for (long long e = csr->offsets[v]; e < csr->offsets[v + 1]; e++) {
+                sum += contrib[csr->neighbors[e]];
+            }
+            rank[v] = 0.15 / n + 0.85 * sum;
+        }
+    }
+}
+
+/* 重排函数 */
+typedef void (*ReorderFunc)(GraphCSR *csr, int *perm);
+
+/* 检查 perm 为排列，且重建后的边集与原图一致 */
+bool checkPermute(GraphCSR *csr, GraphCSR *res, int *perm) {
+    int n = csr->vertexNum;
+    bool *seen = calloc(n + 1, sizeof(bool));
+    bool ok = res->edgeNum == csr->edgeNum;
+    for (int v = 0; v < n && ok; v++) {
+        ok = perm[v] >= 0 && perm[v] < n && !seen[perm[v]];
+        seen[perm[v]] = true;
+    }
+    // 邻接顶点按新编号升序，逐条二分查找
+    for (int v = 0; v < n && ok; v++) {
+        int nv = perm[v];
+        ok = csrDegree(res, nv) == csrDegree(csr, v);
+        for (long long e = csr->offsets[v]; e < csr->offsets[v + 1] && ok; e++) {
+            int target = perm[csr->neighbors[e]];
+            int *row = csrNeighbors(res, nv);
+            int lo = 0, hi = csrDegree(res, nv) - 1;
+            while (lo < hi) {
+                int mid = (lo + hi) / 2;
+                if (row[mid] < target) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            ok = hi >= 0 && row[lo] == target;
+        }
+    }
+    free(seen);
+    return ok;
+}
+
+/* 基本测试 */
+void testBasic() {
+    // 一条路径 1 - 2 - ... - 8 ，顶点按打乱的顺序插入
+    int vals[] = {5, 1, 8, 3, 6, 2, 7, 4};
+    int size = sizeof(vals) / sizeof(vals[0]);
+    Vertex **v = valsToVets(vals, size);
+    GraphAdjList *graph = newGraphAdjList();
+    for (int i = 0; i < size; i++) {
+        addVertex(graph, v[i]);
+    }
+    // 值为 k 的顶点的下标
+    int pos[9];
+    for (int i = 0; i < size; i++) {
+        pos[vals[i]] = i;
+    }
+    for (int k = 1; k < 8; k++) {
+        addEdge(graph, v[pos[k]], v[pos[k + 1]]);
+    }
+    // 增加一条弦 2 - 6
+    addEdge(graph, v[pos[2]], v[pos[6]]);
+    GraphCSR *csr = graphAdjListToCSR(graph);
+    printf("按插入顺序编号，带宽为 %d\n", csrBandwidth(csr));
+    printGraphCSR(csr);
+
+    const char *names[] = {"度数降序", "RCM", "Gorder"};
+    ReorderFunc funcs[] = {reorderDegree, reorderRCM, reorderGorder};
+    int perm[8], res[8], inv[8];
+    for (int k = 0; k < 3; k++) {
+        funcs[k](csr, perm);
+        GraphCSR *reordered = csrPermute(csr, perm);
+        assert(checkPermute(csr, reordered, perm));
+        printf("\n%s：perm = ", names[k]);
+        printArray(perm, size);
+        printf("带宽为 %d ，新编号下的图为\n", csrBandwidth(reordered));
+        printGraphCSR(reordered);
+        // 在新图上 BFS ，再映射回原编号
+        int len = csrBFS(reordered, perm[pos[1]], res);
+        reorderMapIds(perm, size, res, len, inv);
+        printf("从顶点 1 出发的 BFS 序列（原编号）为 ");
+        for (int i = 0; i < len; i++) {
+            printf(i == 0 ? "[%d" : ", %d", csr->vertices[res[i]]->val);
+        }
+        printf("]\n");
+        assert(len == size && res[0] == pos[1]);
+        delGraphCSR(reordered);
+    }
+
+    delGraphCSR(csr);
+    delGraphAdjList(graph);
+    free(v);
+}
+
+/* 正确性 */
+void testValidate() {
+    GraphCSR *graphs[] = {newShuffledGrid(60), newKroneckerGraph(12)};
+    ReorderFunc funcs[] = {reorderDegree, reorderRCM, reorderGorder};
+    for (int g = 0; g < 2; g++) {
+        GraphCSR *csr = graphs[g];
+        int n = csr->vertexNum;
+        int *perm = malloc(sizeof(int) * n), *queue = malloc(sizeof(int) * n);
+        int *expect = malloc(sizeof(int) * n), *level = malloc(sizeof(int) * n), *mapped = malloc(sizeof(int) * n);
+        double *rankExpect = malloc(sizeof(double) * n), *rank = malloc(sizeof(double) * n);
+        double *rankMapped = malloc(sizeof(double) * n), *contrib = malloc(sizeof(double) * n);
+        pageRankSweep(csr, PR_ITERS, rankExpect, contrib);
+        for (int k = 0; k < 3; k++) {
+            funcs[k](csr, perm);
+            GraphCSR *reordered = csrPermute(csr, perm);
+            assert(checkPermute(csr, reordered, perm));
+            for (int source = 0; source < n; source += n / 7) {
+                bfsLevels(csr, source, expect, queue);
+                bfsLevels(reordered, perm[source], level, queue);
+                reorderMapValues(perm, n, level, mapped, sizeof(int));
+                assert(memcmp(mapped, expect, sizeof(int) * n) == 0);
+            }
+            pageRankSweep(reordered, PR_ITERS, rank, contrib);
+            reorderMapValues(perm, n, rank, rankMapped, sizeof(double));
+            for (int v = 0; v < n; v++) {
+                assert(fabs(rankMapped[v] - rankExpect[v]) < 1e-12);
+            }
+            delGraphCSR(reordered);
+        }
+        free(perm);
+        free(queue);
+        free(expect);
+        free(level);
+        free(mapped);
+        free(rankExpect);
+        free(rank);
+        free(rankMapped);
+        free(contrib);
+        delGraphCSR(csr);
+    }
+    printf("网格与 Kronecker 图上重排合法，BFS 层数与 PageRank 映射回原编号后与原图一致\n");
+}
+
+/* 在 csr 上执行 BFS 与 PageRank 并输出耗时，perm 为 NULL 表示原始编号 */
+void benchTraversal(const char *name, GraphCSR *csr, int *perm, double reorderTime) {
+    int n = csr->vertexNum;
+    int *level = malloc(sizeof(int) * n), *queue = malloc(sizeof(int) * n);
+    double *rank = malloc(sizeof(double) * n), *contrib = malloc(sizeof(double) * n);
+    // 各排序下使用相同的起点（原编号），映射为新编号
+    double start = wallSeconds();
+    for (int r = 0; r < BFS_ROOTS; r++) {
+        int source = (int)((long long)n * r / BFS_ROOTS);
+        bfsLevels(csr, perm == NULL ? source : perm[source], level, queue);
+    }
+    double bfsTime = (wallSeconds() - start) / BFS_ROOTS;
+    start = wallSeconds();
+    pageRankSweep(csr, PR_ITERS, rank, contrib);
+    double prTime = wallSeconds() - start;
+    printf("%-10s 重排 %7.3f s  对数间距 %5.2f  BFS %7.3f s  PageRank(%d 轮) %7.3f s\n",
+           name, reorderTime, csrLogGap(csr), bfsTime, PR_ITERS, prTime);
+    free(level);
+    free(queue);
+    free(rank);
+    free(contrib);
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    GraphCSR *graphs[] = {newShuffledGrid(BENCH_SIDE), newKroneckerGraph(BENCH_SCALE)};
+    const char *graphNames[] = {"打乱编号的网格", "Kronecker 图"};
+    const char *names[] = {"度数降序", "RCM", "Gorder"};
+    ReorderFunc funcs[] = {reorderDegree, reorderRCM, reorderGorder};
+    for (int g = 0; g < 2; g++) {
+        GraphCSR *csr = graphs[g];
+        printf("\n%s：%d 个顶点，%lld 条有向边\n", graphNames[g], csr->vertexNum, csr->edgeNum);
+        benchTraversal("原始编号", csr, NULL, 0);
+        int *perm = malloc(sizeof(int) * csr->vertexNum);
+        for (int k = 0; k < 3; k++) {
+            double start = wallSeconds();
+            funcs[k](csr, perm);
+            GraphCSR *reordered = csrPermute(csr, perm);
+            double reorderTime = wallSeconds() - start;
+            benchTraversal(names[k], reordered, perm, reorderTime);
+            delGraphCSR(reordered);
+        }
+        free(perm);
+        delGraphCSR(csr);
+    }
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
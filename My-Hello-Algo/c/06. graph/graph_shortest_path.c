@@ -0,0 +1,595 @@
+/**
+ * @FileName    :graph_shortest_path.c
+ * @Date        :2026-10-19 20:04:33
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :带权图单源最短路径：Dijkstra 、delta-stepping 、A*
+ * @Description :图为带非负整数边权的 CSR 图（weights 不为 NULL），可由边表建立、由 addWeightedEdge 建立的邻接表转换，
+ *               或从 DIMACS 最短路格式（"p sp n m" / "a u v w"）文件读取。距离为 int ，不可达为 SP_INF 。
+ *               1. Dijkstra（基数堆）：Dijkstra 出堆的距离单调不减，满足基数堆的使用条件；
+ *                  采用惰性删除，松弛时直接入堆，出堆时跳过过期的元素。
+ *               2. Dijkstra（可寻址二叉堆）：堆中记录每个顶点的位置 pos[v] ，松弛时原地减小键值（decrease-key），
+ *                  堆中每个顶点至多出现一次。
+ *               3. delta-stepping ：按距离将顶点分入宽度为 delta 的桶，依次处理每个桶；
+ *                  桶内反复松弛轻边（w <= delta）直到桶为空，再统一松弛重边。同一桶内的顶点可并行松弛，
+ *                  多线程时各线程处理桶的一段，用 CAS 原子地更新 dist ，被更新的顶点写入线程私有列表，
+ *                  线程在每个阶段之间使用 barrier 同步，避免频繁创建线程。
+ *               4. A* ：按 f = g + h 从可寻址二叉堆中取顶点，h 为可插拔的启发函数，
+ *                  h 满足一致性（h(u) <= w(u, v) + h(v)）时第一次取出终点即为最短路径。
+ *               parent[v] 为最短路径树中的前驱顶点，可用于还原路径。
+ *               delta-stepping 将距离与前驱打包为一个 64 位整数，一次 CAS 同时更新，有向图与零权边下前驱同样正确。
+ */
+
+#include <pthread.h>
+
+#include "../05. heap/radix_heap.c"
+#include "graph_csr.c"
+
+// 不可达距离
+#define SP_INF INT_MAX
+
+/* 初始化 dist 与 parent */
+void spInit(int n, int source, int *dist, int *parent) {
+    for (int v = 0; v < n; v++) {
+        dist[v] = SP_INF;
+        if (parent != NULL) {
+            parent[v] = -1;
+        }
+    }
+    dist[source] = 0;
+    if (parent != NULL) {
+        parent[source] = source;
+    }
+}
+
+/* Dijkstra（基数堆），parent 可为 NULL */
+void dijkstraRadix(GraphCSR *csr, int source, int *dist, int *parent) {
+    spInit(csr->vertexNum, source, dist, parent);
+    RadixHeap *heap = newRadixHeap();
+    radixHeapPushPair(heap, 0, source);
+    while (!radixHeapIsEmpty(heap)) {
+        int u;
+        int d = radixHeapPopPair(heap, &u);
+        // 惰性删除：跳过过期的元素
+        if (d != dist[u]) {
+            continue;
+        }
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int v = csr->neighbors[e];
+            int nd = d + csr->weights[e];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                if (parent != NULL) {
+                    parent[v] = u;
+                }
+                radixHeapPushPair(heap, nd, v);
+            }
+        }
+    }
+    delRadixHeap(heap);
+}
+
+/* 可寻址小顶堆：堆中存放顶点，键值为 key[v] ，pos[v] 为顶点在堆中的位置（不在堆中为 -1） */
+typedef struct {
+    int *heap;
+    int *pos;
+    int *key;
+    int size;
+} IndexedHeap;
+
+/* 构造函数，key 由调用者维护 */
+IndexedHeap *newIndexedHeap(int n, int *key) {
+    IndexedHeap *h = malloc(sizeof(IndexedHeap));
+    h->heap = malloc(sizeof(int) * (n + 1));
+    h->pos = malloc(sizeof(int) * (n + 1));
+    for (int v = 0; v < n; v++) {
+        h->pos[v] = -1;
+    }
+    h->key = key;
+    h->size = 0;
+    return h;
+}
+
+/* 析构函数 */
+void delIndexedHeap(IndexedHeap *h) {
+    free(h->heap);
+    free(h->pos);
+    free(h);
+}
+
+/* 从位置 i 开始向上堆化（空穴法） */
+void indexedHeapSiftUp(IndexedHeap *h, int i) {
+    int v = h->heap[i];
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (h->key[h->heap[p]] <= h->key[v]) {
+            break;
+        }
+        h->heap[i] = h->heap[p];
+        h->pos[h->heap[i]] = i;
+        i = p;
+    }
+    h->heap[i] = v;
+    h->pos[v] = i;
+}
+
+/* 从位置 i 开始向下堆化（空穴法） */
+void indexedHeapSiftDown(IndexedHeap *h, int i) {
+    int v = h->heap[i];
+    while (true) {
+        int c = 2 * i + 1;
+        if (c >= h->size) {
+            break;
+        }
+        if (c + 1 < h->size && h->key[h->heap[c + 1]] < h->key[h->heap[c]]) {
+            c++;
+        }
+        if (h->key[v] <= h->key[h->heap[c]]) {
+            break;
+        }
+        h->heap[i] = h->heap[c];
+        h->pos[h->heap[i]] = i;
+        i = c;
+    }
+    h->heap[i] = v;
+    h->pos[v] = i;
+}
+
+/* 插入顶点，或在 key[v] 减小后调整其位置 */
+void indexedHeapPushOrDecrease(IndexedHeap *h, int v) {
+    if (h->pos[v] == -1) {
+        h->heap[h->size] = v;
+        h->pos[v] = h->size++;
+    }
+    indexedHeapSiftUp(h, h->pos[v]);
+}
+
+/* 弹出键值最小的顶点 */
+int indexedHeapPop(IndexedHeap *h) {
+    int v = h->heap[0];
+    h->pos[v] = -1;
+    if (--h->size > 0) {
+        h->heap[0] = h->heap[h->size];
+        indexedHeapSiftDown(h, 0);
+    }
+    return v;
+}
+
+/* Dijkstra（可寻址二叉堆），parent 可为 NULL */
+void dijkstraIndexed(GraphCSR *csr, int source, int *dist, int *parent) {
+    spInit(csr->vertexNum, source, dist, parent);
+    IndexedHeap *heap = newIndexedHeap(csr->vertexNum, dist);
+    indexedHeapPushOrDecrease(heap, source);
+    while (heap->size > 0) {
+        int u = indexedHeapPop(heap);
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int v = csr->neighbors[e];
+            int nd = dist[u] + csr->weights[e];
+            if (nd < dist[v]) {
+                dist[v] = nd;
+                if (parent != NULL) {
+                    parent[v] = u;
+                }
+                indexedHeapPushOrDecrease(heap, v);
+            }
+        }
+    }
+    delIndexedHeap(heap);
+}
+
+/* 启发函数：估计 v 到 target 的距离 */
+typedef int (*AStarHeuristic)(void *ctx, int v, int target);
+
+/* 零启发函数，A* 退化为 Dijkstra */
+int astarZero(void *ctx, int v, int target) {
+    (void)ctx;
+    (void)v;
+    (void)target;
+    return 0;
+}
+
+/* 平面坐标，用于几何启发函数 */
+typedef struct {
+    int *x, *y;
+    int minCost; // 单位距离的最小边权，保证启发函数不高估
+} GeoContext;
+
+/* 曼哈顿距离启发函数（适用于只沿坐标轴方向连边的网格） */
+int astarManhattan(void *ctx, int v, int target) {
+    GeoContext *g = ctx;
+    return (abs(g->x[v] - g->x[target]) + abs(g->y[v] - g->y[target])) * g->minCost;
+}
+
+/* 整数平方根：返回 floor(sqrt(n)) （牛顿迭代，无需链接 libm） */
+unsigned long long isqrtU64(unsigned long long n) {
+    if (n < 2) {
+        return n;
+    }
+    unsigned long long x = n, y = (x + 1) / 2;
+    while (y < x) {
+        x = y;
+        y = (x + n / x) / 2;
+    }
+    return x;
+}
+
+/* 欧几里得距离启发函数：floor(sqrt((dx^2 + dy^2) * minCost^2)) ，向下取整保持一致性 */
+int astarEuclidean(void *ctx, int v, int target) {
+    GeoContext *g = ctx;
+    long long dx = g->x[v] - g->x[target], dy = g->y[v] - g->y[target];
+    unsigned long long c = g->minCost;
+    return (int)isqrtU64((unsigned long long)(dx * dx + dy * dy) * c * c);
+}
+
+/**
+ * @brief  A* 搜索
+ * @param  csr      带权图
+ * @param  source   起点
+ * @param  target   终点
+ * @param  h        启发函数
+ * @param  ctx      启发函数的用户数据
+ * @param  parent   前驱顶点，可为 NULL
+ * @param  expanded 取出（扩展）的顶点数量，可为 NULL
+ * @retval int      最短路径长度，不可达为 SP_INF
+ */
+int astarSearch(GraphCSR *csr, int source, int target, AStarHeuristic h, void *ctx, int *parent, int *expanded) {
+    int n = csr->vertexNum;
+    int *g = malloc(sizeof(int) * n);
+    int *f = malloc(sizeof(int) * n);
+    spInit(n, source, g, parent);
+    IndexedHeap *heap = newIndexedHeap(n, f);
+    f[source] = h(ctx, source, target);
+    indexedHeapPushOrDecrease(heap, source);
+    int count = 0, res = SP_INF;
+    while (heap->size > 0) {
+        int u = indexedHeapPop(heap);
+        count++;
+        if (u == target) {
+            res = g[u];
+            break;
+        }
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int v = csr->neighbors[e];
+            int ng = g[u] + csr->weights[e];
+            if (ng < g[v]) {
+                g[v] = ng;
+                f[v] = ng + h(ctx, v, target);
+                if (parent != NULL) {
+                    parent[v] = u;
+                }
+                indexedHeapPushOrDecrease(heap, v);
+            }
+        }
+    }
+    if (expanded != NULL) {
+        *expanded = count;
+    }
+    delIndexedHeap(heap);
+    free(g);
+    free(f);
+    return res;
+}
+
+/* 可扩容的顶点列表 */
+typedef struct {
+    int *data;
+    int size, capacity;
+} VertexList;
+
+/* 向列表末尾添加顶点 */
+void vertexListPush(VertexList *list, int v) {
+    if (list->size == list->capacity) {
+        list->capacity = list->capacity == 0 ? 64 : list->capacity * 2;
+        list->data = realloc(list->data, sizeof(int) * list->capacity);
+    }
+    list->data[list->size++] = v;
+}
+
+/* delta-stepping 的桶：buckets[i] 存放距离位于 [i * delta, (i + 1) * delta) 的顶点，
+   顶点可能因距离更新而在旧桶中残留，取出时过滤 */
+typedef struct {
+    VertexList *buckets;
+    int num, capacity; // 已使用的桶数量、桶数组容量
+} DeltaBuckets;
+
+/* 将顶点 v 加入第 b 个桶 */
+void deltaBucketsPush(DeltaBuckets *bq, int b, int v) {
+    if (b >= bq->capacity) {
+        int newCap = bq->capacity;
+        while (newCap <= b) {
+            newCap *= 2;
+        }
+        bq->buckets = realloc(bq->buckets, sizeof(VertexList) * newCap);
+        memset(bq->buckets + bq->capacity, 0, sizeof(VertexList) * (newCap - bq->capacity));
+        bq->capacity = newCap;
+    }
+    if (b + 1 > bq->num) {
+        bq->num = b + 1;
+    }
+    vertexListPush(&bq->buckets[b], v);
+}
+
+// delta-stepping 的顶点标签：高 32 位为距离，低 32 位为前驱（距离非负，按整数比较即按距离比较）
+#define DELTA_PACK(d, p) ((unsigned long long)(unsigned)(d) << 32 | (unsigned)(p))
+#define DELTA_DIST(label) ((int)((label) >> 32))
+#define DELTA_PARENT(label) ((int)(unsigned)(label))
+
+/* delta-stepping 共享状态 */
+typedef struct {
+    GraphCSR *csr;
+    unsigned long long *label; // 各顶点的距离与前驱
+    int delta;
+    int threadNum;
+    VertexList *updated; // 各线程被更新的顶点
+    int *work;           // 本阶段待松弛的顶点
+    int workSize;
+    bool light;          // 本阶段松弛轻边还是重边
+    bool done;           // 通知线程退出
+    pthread_barrier_t barrier;
+} DeltaState;
+
+/* 线程参数 */
+typedef struct {
+    DeltaState *state;
+    int tid;
+} DeltaWorker;
+
+/* 原子地将 v 的距离更新为更小的 nd 、前驱更新为 u ，成功时返回 true
+   距离与前驱在同一次 CAS 中写入，最终的前驱一定对应最终的距离 */
+bool deltaRelax(DeltaState *s, int v, int nd, int u) {
+    unsigned long long old = __atomic_load_n(&s->label[v], __ATOMIC_RELAXED);
+    while (nd < DELTA_DIST(old)) {
+        if (__atomic_compare_exchange_n(&s->label[v], &old, DELTA_PACK(nd, u), true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* 松弛 work 中属于本线程的一段顶点的轻边或重边 */
+void deltaRelaxPhase(DeltaState *s, int tid) {
+    GraphCSR *csr = s->csr;
+    int begin = (int)((long long)s->workSize * tid / s->threadNum);
+    int end = (int)((long long)s->workSize * (tid + 1) / s->threadNum);
+    VertexList *out = &s->updated[tid];
+    for (int i = begin; i < end; i++) {
+        int u = s->work[i];
+        int du = DELTA_DIST(__atomic_load_n(&s->label[u], __ATOMIC_RELAXED));
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            int w = csr->weights[e];
+            if ((w <= s->delta) != s->light) {
+                continue;
+            }
+            int v = csr->neighbors[e];
+            if (deltaRelax(s, v, du + w, u)) {
+                vertexListPush(out, v);
+            }
+        }
+    }
+}
+
+/* 工作线程：等待阶段开始 -> 松弛 -> 等待阶段结束 */
+void *deltaWorkerRun(void *arg) {
+    DeltaWorker *w = arg;
+    DeltaState *s = w->state;
+    while (true) {
+        pthread_barrier_wait(&s->barrier);
+        if (s->done) {
+            break;
+        }
+        deltaRelaxPhase(s, w->tid);
+        pthread_barrier_wait(&s->barrier);
+    }
+    return NULL;
+}
+
+/* 将各线程被更新的顶点按新距离加入对应的桶 */
+void deltaCollect(DeltaState *s, DeltaBuckets *bq) {
+    for (int t = 0; t < s->threadNum; t++) {
+        for (int i = 0; i < s->updated[t].size; i++) {
+            int v = s->updated[t].data[i];
+            deltaBucketsPush(bq, DELTA_DIST(s->label[v]) / s->delta, v);
+        }
+    }
+}
+
+/* 由主线程（tid 0）发起一个松弛阶段 */
+void deltaRunPhase(DeltaState *s, bool light) {
+    s->light = light;
+    for (int i = 0; i < s->threadNum; i++) {
+        s->updated[i].size = 0;
+    }
+    if (s->threadNum == 1) {
+        deltaRelaxPhase(s, 0);
+        return;
+    }
+    pthread_barrier_wait(&s->barrier);
+    deltaRelaxPhase(s, 0);
+    pthread_barrier_wait(&s->barrier);
+}
+
+/**
+ * @brief  delta-stepping 单源最短路径
+ * @param  csr          带权图（有向或无向，边权非负）
+ * @param  source       起点
+ * @param  dist         距离
+ * @param  parent       前驱顶点，可为 NULL
+ * @param  delta        桶宽度，通常取平均边权的若干倍；delta = 1 时接近 Dijkstra ，delta 很大时接近 Bellman-Ford
+ * @param  threadNum    线程数量
+ */
+void deltaStepping(GraphCSR *csr, int source, int *dist, int *parent, int delta, int threadNum) {
+    int n = csr->vertexNum;
+    if (threadNum < 1) {
+        threadNum = 1;
+    }
+    DeltaState s;
+    s.csr = csr;
+    s.label = malloc(sizeof(unsigned long long) * n);
+    for (int v = 0; v < n; v++) {
+        s.label[v] = DELTA_PACK(SP_INF, -1);
+    }
+    s.label[source] = DELTA_PACK(0, source);
+    s.delta = delta;
+    s.threadNum = threadNum;
+    s.updated = calloc(threadNum, sizeof(VertexList));
+    s.done = false;
+    DeltaBuckets bq = {calloc(64, sizeof(VertexList)), 0, 64};
+    deltaBucketsPush(&bq, 0, source);
+    // stamp[v] 记录顶点最近一次被加入 work 的阶段，用于去重
+    int *stamp = calloc(n, sizeof(int));
+    int phase = 0;
+    VertexList work = {NULL, 0, 0}, settled = {NULL, 0, 0};
+    pthread_t *tids = malloc(sizeof(pthread_t) * threadNum);
+    DeltaWorker *workers = malloc(sizeof(DeltaWorker) * threadNum);
+    if (threadNum > 1) {
+        pthread_barrier_init(&s.barrier, NULL, threadNum);
+        for (int i = 1; i < threadNum; i++) {
+            workers[i] = (DeltaWorker){&s, i};
+            pthread_create(&tids[i], NULL, deltaWorkerRun, &workers[i]);
+        }
+    }
+
+    for (int cur = 0; cur < bq.num; cur++) {
+        settled.size = 0;
+        while (bq.buckets[cur].size > 0) {
+            /* 取出当前桶，过滤过期与重复的顶点 */
+            phase++;
+            work.size = 0;
+            for (int i = 0; i < bq.buckets[cur].size; i++) {
+                int v = bq.buckets[cur].data[i];
+                if (DELTA_DIST(s.label[v]) / delta == cur && stamp[v] != phase) {
+                    stamp[v] = phase;
+                    vertexListPush(&work, v);
+                    vertexListPush(&settled, v);
+                }
+            }
+            bq.buckets[cur].size = 0;
+            /* 松弛轻边，被更新的顶点加入对应的桶（可能仍是当前桶） */
+            s.work = work.data;
+            s.workSize = work.size;
+            deltaRunPhase(&s, true);
+            deltaCollect(&s, &bq);
+        }
+        /* 当前桶的顶点距离已确定，统一松弛重边（目标必在之后的桶中） */
+        s.work = settled.data;
+        s.workSize = settled.size;
+        deltaRunPhase(&s, false);
+        deltaCollect(&s, &bq);
+        // 当前桶之后不再使用，释放其空间
+        free(bq.buckets[cur].data);
+        bq.buckets[cur] = (VertexList){NULL, 0, 0};
+    }
+
+    /* 拆分距离与前驱 */
+    for (int v = 0; v < n; v++) {
+        dist[v] = DELTA_DIST(s.label[v]);
+        if (parent != NULL) {
+            parent[v] = DELTA_PARENT(s.label[v]);
+        }
+    }
+    if (threadNum > 1) {
+        s.done = true;
+        pthread_barrier_wait(&s.barrier);
+        for (int i = 1; i < threadNum; i++) {
+            pthread_join(tids[i], NULL);
+        }
+        pthread_barrier_destroy(&s.barrier);
+    }
+    for (int t = 0; t < threadNum; t++) {
+        free(s.updated[t].data);
+    }
+    free(s.updated);
+    free(s.label);
+    free(bq.buckets);
+    free(stamp);
+    free(work.data);
+    free(settled.data);
+    free(tids);
+    free(workers);
+}
+
+/**
+ * @brief  从 DIMACS 最短路格式读取有向带权图，文件中顶点编号从 1 开始，读入后从 0 开始
+ * @note   problem 行须唯一且位于所有弧之前，n > 0 、m >= 0 ；每条弧须满足 1 <= u, v <= n 、w >= 0 ，
+ *         弧的数量须恰好为 m 。格式错误时打印原因并返回 NULL
+ */
+GraphCSR *loadDimacsGraph(FILE *fp) {
+    int n = 0;
+    long long m = 0, cnt = 0, lineNo = 0;
+    int *src = NULL, *dst = NULL, *weights = NULL;
+    bool ok = true;
+    char line[256];
+    while (ok && fgets(line, sizeof(line), fp) != NULL) {
+        lineNo++;
+        if (line[0] == 'p') {
+            if (src != NULL) {
+                printf("DIMACS line %lld: duplicate problem line!\n", lineNo);
+                ok = false;
+            } else if (sscanf(line, "p sp %d %lld", &n, &m) != 2 || n <= 0 || m < 0 ||
+                       m >= (long long)(SIZE_MAX / sizeof(int))) {
+                printf("DIMACS line %lld: invalid problem line!\n", lineNo);
+                ok = false;
+            } else {
+                src = malloc(sizeof(int) * (m + 1));
+                dst = malloc(sizeof(int) * (m + 1));
+                weights = malloc(sizeof(int) * (m + 1));
+                if (src == NULL || dst == NULL || weights == NULL) {
+                    printf("DIMACS problem line declares too many arcs (%lld)!\n", m);
+                    ok = false;
+                }
+            }
+        } else if (line[0] == 'a') {
+            int u, v, w;
+            if (src == NULL) {
+                printf("DIMACS line %lld: arc before problem line!\n", lineNo);
+                ok = false;
+            } else if (cnt >= m) {
+                printf("DIMACS line %lld: more arcs than the declared %lld!\n", lineNo, m);
+                ok = false;
+            } else if (sscanf(line, "a %d %d %d", &u, &v, &w) != 3 || u < 1 || u > n || v < 1 || v > n ||
+                       w < 0) {
+                printf("DIMACS line %lld: invalid arc!\n", lineNo);
+                ok = false;
+            } else {
+                src[cnt] = u - 1;
+                dst[cnt] = v - 1;
+                weights[cnt] = w;
+                cnt++;
+            }
+        }
+        // 以 'c' 开头的注释行忽略
+    }
+    if (ok && src == NULL) {
+        printf("DIMACS file has no problem line!\n");
+        ok = false;
+    }
+    if (ok && cnt != m) {
+        printf("DIMACS file has %lld arcs, but the problem line declares %lld!\n", cnt, m);
+        ok = false;
+    }
+    GraphCSR *csr = ok ? newGraphCSRFromEdges(n, src, dst, weights, cnt, false, 1) : NULL;
+    free(src);
+    free(dst);
+    free(weights);
+    return csr;
+}
+
+/* 由 parent 还原 source 到 target 的路径，返回路径顶点数量（不可达为 0） */
+int spPath(int *parent, int source, int target, int *path) {
+    if (parent[target] == -1) {
+        return 0;
+    }
+    int len = 0;
+    for (int v = target; v != source; v = parent[v]) {
+        path[len++] = v;
+    }
+    path[len++] = source;
+    // 反转为从 source 到 target
+    for (int i = 0; i < len / 2; i++) {
+        int tmp = path[i];
+        path[i] = path[len - 1 - i];
+        path[len - 1 - i] = tmp;
+    }
+    return len;
+}
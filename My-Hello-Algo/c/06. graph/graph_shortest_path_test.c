@@ -0,0 +1,306 @@
+/**
+ * @FileName    :graph_shortest_path_test.c
+ * @Date        :2026-10-19 20:41:15
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :带权图最短路径测试程序
+ * @Description :1. 基本测试：由 addWeightedEdge 建立的邻接表转换为 CSR ，求最短距离与路径
+ *               2. 正确性：随机道路网络上各算法的距离一致，前驱构成最短路径树；
+ *                  含零权边的随机有向图上 delta-stepping 的前驱同样构成最短路径树（无环）
+ *               3. 非法 DIMACS 输入：缺少或重复 problem 行、顶点编号越界、负权边、弧数量与 m 不符时返回 NULL
+ *               4. 性能：本地生成 DIMACS 格式的道路网络（网格 + 随机删边，边权为带随机扰动的通行时间），
+ *                  写入临时文件后读取，对比 Dijkstra（基数堆 / 可寻址二叉堆）、delta-stepping（1 / 4 线程）
+ *                  的单源最短路径耗时，以及 A*（零 / 曼哈顿 / 欧几里得启发函数）的点到点查询扩展顶点数与耗时。
+ *                  默认网格边长为 1000（10^6 个顶点），可通过 -DBENCH_SIDE=3163 测试 10^7 个顶点。
+ */
+
+#include "../utils/bench_util.h"
+#include "graph_shortest_path.c"
+
+#ifndef BENCH_SIDE
+#define BENCH_SIDE 1000
+#endif
+// 单位长度道路的最小通行时间
+#define ROAD_UNIT 100
+// 多线程测试使用的线程数量
+#define BENCH_THREADS 4
+
+/* 生成 side x side 的道路网络，以 DIMACS 格式写入 fp ，坐标写入 geo */
+void genRoadNetwork(FILE *fp, int side, GeoContext *geo) {
+    int n = side * side;
+    geo->x = malloc(sizeof(int) * n);
+    geo->y = malloc(sizeof(int) * n);
+    geo->minCost = ROAD_UNIT;
+    srand(side);
+    // 先统计边数：每个顶点向右、向下连边，删去约 10% 的道路
+    long long m = 0;
+    char *keep = malloc((size_t)n * 2);
+    for (int v = 0; v < n; v++) {
+        geo->x[v] = v % side;
+        geo->y[v] = v / side;
+        keep[2 * v] = geo->x[v] + 1 < side && rand() % 10 != 0;
+        keep[2 * v + 1] = geo->y[v] + 1 < side && rand() % 10 != 0;
+        m += 2 * (keep[2 * v] + keep[2 * v + 1]);
+    }
+    fprintf(fp, "c generated road network %d x %d\n", side, side);
+    fprintf(fp, "p sp %d %lld\n", n, m);
+    for (int v = 0; v < n; v++) {
+        for (int d = 0; d < 2; d++) {
+            if (!keep[2 * v + d]) {
+                continue;
+            }
+            int u = d == 0 ? v + 1 : v + side;
+            // 通行时间为单位时间的 1 ~ 3 倍，双向道路
+            int w = ROAD_UNIT + rand() % (2 * ROAD_UNIT);
+            fprintf(fp, "a %d %d %d\na %d %d %d\n", v + 1, u + 1, w, u + 1, v + 1, w);
+        }
+    }
+    free(keep);
+}
+
+/* 生成道路网络并通过 DIMACS 文件读入 */
+GraphCSR *newRoadNetwork(int side, GeoContext *geo) {
+    FILE *fp = tmpfile();
+    genRoadNetwork(fp, side, geo);
+    rewind(fp);
+    GraphCSR *csr = loadDimacsGraph(fp);
+    fclose(fp);
+    return csr;
+}
+
+/* 从字符串读取 DIMACS 图 */
+GraphCSR *loadDimacsString(const char *text) {
+    FILE *fp = tmpfile();
+    fputs(text, fp);
+    rewind(fp);
+    GraphCSR *csr = loadDimacsGraph(fp);
+    fclose(fp);
+    return csr;
+}
+
+/* 检查前驱构成最短路径树 */
+bool checkParent(GraphCSR *csr, int source, int *dist, int *parent) {
+    for (int v = 0; v < csr->vertexNum; v++) {
+        if (v == source || dist[v] == SP_INF) {
+            continue;
+        }
+        int u = parent[v];
+        bool ok = false;
+        for (long long e = csr->offsets[u]; e < csr->offsets[u + 1]; e++) {
+            ok |= csr->neighbors[e] == v && dist[u] + csr->weights[e] == dist[v];
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 检查前驱无环：从每个可达顶点出发沿前驱至多 n 步回到起点 */
+bool checkParentAcyclic(int n, int source, int *dist, int *parent) {
+    for (int v = 0; v < n; v++) {
+        if (dist[v] == SP_INF) {
+            continue;
+        }
+        int u = v, steps = 0;
+        while (u != source && steps <= n) {
+            u = parent[u];
+            steps++;
+        }
+        if (u != source) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 基本测试 */
+void testBasic() {
+    int vals[] = {0, 1, 2, 3, 4, 5};
+    int size = sizeof(vals) / sizeof(vals[0]);
+    Vertex **v = valsToVets(vals, size);
+    GraphAdjList *graph = newGraphAdjList();
+    for (int i = 0; i < size; i++) {
+        addVertex(graph, v[i]);
+    }
+    addWeightedEdge(graph, v[0], v[1], 7);
+    addWeightedEdge(graph, v[0], v[2], 9);
+    addWeightedEdge(graph, v[0], v[5], 14);
+    addWeightedEdge(graph, v[1], v[2], 10);
+    addWeightedEdge(graph, v[1], v[3], 15);
+    addWeightedEdge(graph, v[2], v[3], 11);
+    addWeightedEdge(graph, v[2], v[5], 2);
+    addWeightedEdge(graph, v[3], v[4], 6);
+    addWeightedEdge(graph, v[4], v[5], 9);
+    GraphCSR *csr = graphAdjListToCSR(graph);
+    printGraphCSR(csr);
+
+    int dist[6], parent[6], path[6];
+    dijkstraRadix(csr, 0, dist, parent);
+    printf("顶点 0 到各顶点的最短距离为 ");
+    printArray(dist, 6);
+    int len = spPath(parent, 0, 4, path);
+    printf("顶点 0 到顶点 4 的最短路径为 ");
+    printArray(path, len);
+    assert(dist[4] == 20 && len == 4);
+
+    delGraphCSR(csr);
+    delGraphAdjList(graph);
+    free(v);
+}
+
+/* 正确性 */
+void testValidate() {
+    GeoContext geo;
+    GraphCSR *csr = newRoadNetwork(120, &geo);
+    int n = csr->vertexNum;
+    int *dist1 = malloc(sizeof(int) * n), *dist2 = malloc(sizeof(int) * n), *dist3 = malloc(sizeof(int) * n);
+    int *parent = malloc(sizeof(int) * n);
+    AStarHeuristic hs[] = {astarZero, astarManhattan, astarEuclidean};
+    for (int r = 0; r < 6; r++) {
+        int source = rand() % n;
+        dijkstraRadix(csr, source, dist1, parent);
+        assert(checkParent(csr, source, dist1, parent));
+        dijkstraIndexed(csr, source, dist2, parent);
+        assert(checkParent(csr, source, dist2, parent));
+        assert(memcmp(dist1, dist2, sizeof(int) * n) == 0);
+        deltaStepping(csr, source, dist3, parent, 50 + r * 100, r % 4 + 1);
+        assert(memcmp(dist1, dist3, sizeof(int) * n) == 0);
+        assert(checkParent(csr, source, dist3, parent));
+        for (int i = 0; i < 20; i++) {
+            int target = rand() % n;
+            int d = astarSearch(csr, source, target, hs[i % 3], &geo, NULL, NULL);
+            assert(d == dist1[target]);
+        }
+    }
+    printf("随机道路网络上 Dijkstra 、delta-stepping 、A* 的结果一致\n");
+    for (unsigned long long k = 0; k < 100000; k++) {
+        unsigned long long r = isqrtU64(k * k + k * 2); // (k + 1)^2 - 1
+        assert(isqrtU64(k * k) == k && r == k);
+    }
+
+    /* 含零权边的随机有向图 */
+    int dn = 3000, dm = 15000;
+    int *src = malloc(sizeof(int) * dm), *dst = malloc(sizeof(int) * dm), *weights = malloc(sizeof(int) * dm);
+    unsigned long long x = 2026;
+    for (int i = 0; i < dm; i++) {
+        src[i] = (int)(randU32(&x) % dn);
+        dst[i] = (int)(randU32(&x) % dn);
+        weights[i] = (int)(randU32(&x) % 4); // 约四分之一为零权边
+    }
+    GraphCSR *directed = newGraphCSRFromEdges(dn, src, dst, weights, dm, false, 1);
+    for (int r = 0; r < 8; r++) {
+        int source = (int)(randU32(&x) % dn);
+        dijkstraRadix(directed, source, dist1, NULL);
+        deltaStepping(directed, source, dist3, parent, 1 + r % 3, r % 4 + 1);
+        assert(memcmp(dist1, dist3, sizeof(int) * dn) == 0);
+        assert(checkParent(directed, source, dist3, parent));
+        assert(checkParentAcyclic(dn, source, dist3, parent));
+    }
+    printf("含零权边的随机有向图上 delta-stepping 的距离与前驱正确\n");
+    delGraphCSR(directed);
+    free(src);
+    free(dst);
+    free(weights);
+    free(dist1);
+    free(dist2);
+    free(dist3);
+    free(parent);
+    free(geo.x);
+    free(geo.y);
+    delGraphCSR(csr);
+}
+
+/* 非法 DIMACS 输入 */
+void testDimacsErrors() {
+    GraphCSR *csr = loadDimacsString("c ok\np sp 3 2\na 1 2 5\na 2 3 0\n");
+    assert(csr != NULL && csr->vertexNum == 3);
+    delGraphCSR(csr);
+    const char *bad[] = {
+        "a 1 2 5\n",                            // 无 problem 行
+        "p sp 0 0\n",                           // 顶点数量非法
+        "p sp 3 -1\n",                          // 弧数量非法
+        "p sp 3 1\na 1 2 5\np sp 3 1\n",        // 重复的 problem 行
+        "p sp 3 1\na 0 2 5\n",                  // 顶点编号越界
+        "p sp 3 1\na 1 4 5\n",                  // 顶点编号越界
+        "p sp 3 1\na 1 2 -5\n",                 // 负权边
+        "p sp 3 1\na 1 2\n",                    // 弧字段不足
+        "p sp 3 1\na 1 2 5\na 2 3 5\n",         // 弧多于 m
+        "p sp 3 2\na 1 2 5\n",                  // 弧少于 m
+    };
+    for (int i = 0; i < (int)(sizeof(bad) / sizeof(bad[0])); i++) {
+        assert(loadDimacsString(bad[i]) == NULL);
+    }
+    printf("非法 DIMACS 输入均被拒绝\n");
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    GeoContext geo;
+    double start = wallSeconds();
+    GraphCSR *csr = newRoadNetwork(BENCH_SIDE, &geo);
+    int n = csr->vertexNum;
+    printf("\n道路网络：%d 个顶点，%lld 条有向边，生成并读取 DIMACS 文件耗时 %.3f s\n",
+           n, csr->edgeNum, wallSeconds() - start);
+    int *dist = malloc(sizeof(int) * n), *expect = malloc(sizeof(int) * n);
+    int *parent = malloc(sizeof(int) * n);
+    int source = n / 2 + BENCH_SIDE / 2;
+
+    /* 单源最短路径 */
+    start = wallSeconds();
+    dijkstraRadix(csr, source, expect, parent);
+    printf("Dijkstra（基数堆）          %.3f s\n", wallSeconds() - start);
+    start = wallSeconds();
+    dijkstraIndexed(csr, source, dist, parent);
+    printf("Dijkstra（可寻址二叉堆）    %.3f s\n", wallSeconds() - start);
+    assert(memcmp(dist, expect, sizeof(int) * n) == 0);
+    int deltas[] = {ROAD_UNIT, 4 * ROAD_UNIT, 16 * ROAD_UNIT};
+    for (int i = 0; i < 3; i++) {
+        for (int threadNum = 1; threadNum <= BENCH_THREADS; threadNum *= BENCH_THREADS) {
+            start = wallSeconds();
+            deltaStepping(csr, source, dist, NULL, deltas[i], threadNum);
+            printf("delta-stepping（delta = %4d, %d 线程） %.3f s\n", deltas[i], threadNum, wallSeconds() - start);
+            assert(memcmp(dist, expect, sizeof(int) * n) == 0);
+        }
+    }
+
+    /* 点到点查询：A* */
+    const char *names[] = {"零", "曼哈顿", "欧几里得"};
+    AStarHeuristic hs[] = {astarZero, astarManhattan, astarEuclidean};
+    int queries = 20;
+    int *sources = malloc(sizeof(int) * queries), *targets = malloc(sizeof(int) * queries);
+    srand(7);
+    for (int q = 0; q < queries; q++) {
+        sources[q] = rand() % n;
+        targets[q] = rand() % n;
+    }
+    for (int i = 0; i < 3; i++) {
+        long long expandedSum = 0;
+        start = wallSeconds();
+        for (int q = 0; q < queries; q++) {
+            int expanded;
+            astarSearch(csr, sources[q], targets[q], hs[i], &geo, NULL, &expanded);
+            expandedSum += expanded;
+        }
+        printf("A*（%s启发函数）平均扩展 %lld 个顶点，每次查询 %.2f ms\n",
+               names[i], expandedSum / queries, (wallSeconds() - start) / queries * 1000);
+    }
+
+    free(sources);
+    free(targets);
+    free(dist);
+    free(expect);
+    free(parent);
+    free(geo.x);
+    free(geo.y);
+    delGraphCSR(csr);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testDimacsErrors", testDimacsErrors);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
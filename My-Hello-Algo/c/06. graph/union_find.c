@@ -0,0 +1,114 @@
+/**
+ * @FileName    :union_find.c
+ * @Date        :2026-10-19 22:10:36
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :并查集（不相交集合）
+ * @Description :每个集合用一棵树表示，树根为集合的代表元，parent[x] == x 表示 x 为根。
+ *               1. 查找（find）：沿 parent 向上找到根，同时进行路径减半（path halving）：
+ *                  将经过的每个节点指向其祖父节点，只需一趟遍历，效果与路径压缩相近。
+ *               2. 合并（union）：按秩合并，将秩（树高上界）较小的根挂到较大的根下，秩相同时新根的秩加一。
+ *                  按秩合并 + 路径减半后，单次操作的均摊时间为 O(α(n)) 。
+ *               3. 并发合并：多个线程可同时调用 dsFindConcurrent / dsUnionConcurrent ，无需加锁。
+ *                  合并时总是将编号较大的根挂到编号较小的根下（代替按秩合并，避免同时修改秩），
+ *                  使用 CAS 将 parent[hi] 从 hi 改为 lo ，失败说明 hi 已不是根，重新查找后重试；
+ *                  路径减半只会把指针改为指向祖先，与其他线程的修改并发也不会破坏树结构。
+ *                  并发版本的根始终是集合中编号最小的元素。
+ */
+
+#include "../utils/common.h"
+
+/* 并查集结构体 */
+typedef struct {
+    int *parent;         // 父节点
+    unsigned char *rank; // 秩
+    int size;            // 元素数量
+    int count;           // 集合数量（仅串行接口维护）
+} DisjointSet;
+
+/* 构造函数：每个元素自成一个集合 */
+DisjointSet *newDisjointSet(int size) {
+    DisjointSet *ds = malloc(sizeof(DisjointSet));
+    ds->parent = malloc(sizeof(int) * (size + 1));
+    ds->rank = calloc(size + 1, sizeof(unsigned char));
+    for (int i = 0; i < size; i++) {
+        ds->parent[i] = i;
+    }
+    ds->size = size;
+    ds->count = size;
+    return ds;
+}
+
+/* 析构函数 */
+void delDisjointSet(DisjointSet *ds) {
+    free(ds->parent);
+    free(ds->rank);
+    free(ds);
+}
+
+/* 查找根节点（路径减半） */
+int dsFind(DisjointSet *ds, int x) {
+    while (ds->parent[x] != x) {
+        ds->parent[x] = ds->parent[ds->parent[x]];
+        x = ds->parent[x];
+    }
+    return x;
+}
+
+/* 合并 x 与 y 所在的集合（按秩合并），原本不在同一集合时返回 true */
+bool dsUnion(DisjointSet *ds, int x, int y) {
+    int rx = dsFind(ds, x), ry = dsFind(ds, y);
+    if (rx == ry) {
+        return false;
+    }
+    if (ds->rank[rx] < ds->rank[ry]) {
+        int tmp = rx;
+        rx = ry;
+        ry = tmp;
+    }
+    ds->parent[ry] = rx;
+    if (ds->rank[rx] == ds->rank[ry]) {
+        ds->rank[rx]++;
+    }
+    ds->count--;
+    return true;
+}
+
+/* 判断 x 与 y 是否在同一集合 */
+bool dsConnected(DisjointSet *ds, int x, int y) {
+    return dsFind(ds, x) == dsFind(ds, y);
+}
+
+/* 获取集合数量 */
+int dsCount(DisjointSet *ds) {
+    return ds->count;
+}
+
+/* 并发查找根节点（路径减半） */
+int dsFindConcurrent(DisjointSet *ds, int x) {
+    int p = __atomic_load_n(&ds->parent[x], __ATOMIC_RELAXED);
+    while (p != x) {
+        int gp = __atomic_load_n(&ds->parent[p], __ATOMIC_RELAXED);
+        // 失败说明其他线程已修改 parent[x] ，新值同样指向祖先，直接继续即可
+        __atomic_compare_exchange_n(&ds->parent[x], &p, gp, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        x = p;
+        p = __atomic_load_n(&ds->parent[x], __ATOMIC_RELAXED);
+    }
+    return x;
+}
+
+/* 并发合并（无锁），原本不在同一集合时返回 true ；不维护 count */
+bool dsUnionConcurrent(DisjointSet *ds, int x, int y) {
+    while (true) {
+        int rx = dsFindConcurrent(ds, x), ry = dsFindConcurrent(ds, y);
+        if (rx == ry) {
+            return false;
+        }
+        // 编号较大的根挂到编号较小的根下
+        int hi = rx > ry ? rx : ry, lo = rx > ry ? ry : rx;
+        int expected = hi;
+        if (__atomic_compare_exchange_n(&ds->parent[hi], &expected, lo, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return true;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @FileName    :vertex_index.c
+ * @Date        :2026-10-19 17:25:46
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :顶点编号与已访问集合
+ * @Description :图遍历中两处线性查找使总复杂度退化为 O(V·E)：在 visited 数组中查找顶点、用 findNode 查找顶点的链表。
+ *               1. 顶点编号 VertexIndex ：将顶点映射为其在 heads 数组中的索引（0 ~ n-1 的连续编号），
+ *                  使用哈希表（uthash）实现 Vertex* -> 编号 的 O(1) 查找，编号即可直接访问 heads[id] 。
+ *                  编号在图结构（顶点）变化后失效，需要重新建立。
+ *               2. 已访问集合 VisitedSet ：基于时间戳（epoch）的数组，stamp[id] == epoch 表示已访问。
+ *                  每次遍历前只需将 epoch 加一，即可在 O(1) 时间内清空集合，重复遍历无需 memset ；
+ *                  epoch 溢出时才真正清零一次数组。
+ */
+
+#include "graph_adjacency_list.c"
+
+/* 哈希表项：顶点指针 -> 编号 */
+typedef struct {
+    Vertex *key;
+    int id;
+    UT_hash_handle hh;
+} VertexIndexEntry;
+
+/* 顶点编号 */
+typedef struct {
+    VertexIndexEntry *map;     // 哈希表
+    VertexIndexEntry *entries; // 哈希表项数组，一次性分配
+    int size;                  // 顶点数量
+} VertexIndex;
+
+/* 构造函数：按 heads 数组中的顺序为顶点编号 */
+VertexIndex *newVertexIndex(GraphAdjList *graph) {
+    VertexIndex *index = malloc(sizeof(VertexIndex));
+    index->map = NULL;
+    index->size = graph->size;
+    index->entries = malloc(sizeof(VertexIndexEntry) * (graph->size + 1));
+    for (int i = 0; i < graph->size; i++) {
+        index->entries[i].key = graph->heads[i]->vertex;
+        index->entries[i].id = i;
+        HASH_ADD_PTR(index->map, key, &index->entries[i]);
+    }
+    return index;
+}
+
+/* 析构函数 */
+void delVertexIndex(VertexIndex *index) {
+    HASH_CLEAR(hh, index->map);
+    free(index->entries);
+    free(index);
+}
+
+/* 获取顶点编号，顶点不存在时返回 -1 */
+int vertexId(VertexIndex *index, Vertex *vet) {
+    VertexIndexEntry *entry;
+    HASH_FIND_PTR(index->map, &vet, entry);
+    return entry == NULL ? -1 : entry->id;
+}
+
+/* 基于时间戳的已访问集合 */
+typedef struct {
+    unsigned *stamp; // stamp[id] == epoch 表示顶点 id 已访问
+    unsigned epoch;  // 当前时间戳
+    int size;        // 顶点数量
+} VisitedSet;
+
+/* 构造函数 */
+VisitedSet *newVisitedSet(int size) {
+    VisitedSet *set = malloc(sizeof(VisitedSet));
+    set->stamp = calloc(size + 1, sizeof(unsigned));
+    set->epoch = 1;
+    set->size = size;
+    return set;
+}
+
+/* 析构函数 */
+void delVisitedSet(VisitedSet *set) {
+    free(set->stamp);
+    free(set);
+}
+
+/* 清空集合：时间戳加一，O(1) */
+void visitedClear(VisitedSet *set) {
+    set->epoch++;
+    // 时间戳溢出回到 0 时，旧的标记可能与新时间戳相同，需真正清零
+    if (set->epoch == 0) {
+        memset(set->stamp, 0, sizeof(unsigned) * set->size);
+        set->epoch = 1;
+    }
+}
+
+/* 判断顶点是否已访问 */
+bool visitedTest(VisitedSet *set, int id) {
+    return set->stamp[id] == set->epoch;
+}
+
+/* 标记顶点为已访问，若此前未访问则返回 true */
+bool visitedMark(VisitedSet *set, int id) {
+    if (set->stamp[id] == set->epoch) {
+        return false;
+    }
+    set->stamp[id] = set->epoch;
+    return true;
+}
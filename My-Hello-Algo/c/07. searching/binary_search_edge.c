@@ -25,9 +25,12 @@
  *                          查找最左一个 target ：可以转化为查找 target - 0.5 ，并返回指针 i 。
  *                          查找最右一个 target ：可以转化为查找 target + 0.5 ，并返回指针 j 。
  *                      注：target 需要修改成浮点类型（float）
+ *
+ *               三、SIMD 加速：查找插入点改用 simd_search.c 中的 simdLowerBound ，其余步骤不变。
  */
 
 #include "../utils/common.h"
+#include "simd_search.c"
 
 /* 二分查找插入点（存在重复元素） */
 int binarySearchInsertion(int *nums, int len, int target) {
@@ -65,6 +68,15 @@ int binarySearchLeftEdge(int *nums, int len, int target) {
     return i;
 }
 
+/* 二分查找最左一个 target（SIMD 加速） */
+int binarySearchLeftEdgeSIMD(int *nums, int len, int target) {
+    int i = simdLowerBound(nums, len, target);
+    if (i == len || nums[i] != target) {
+        return -1;
+    }
+    return i;
+}
+
 /* 二分查找最右一个 target */
 int binarySearchRightEdge(int *nums, int len, int target) {
     // 转化为查找最左一个 target + 1
@@ -90,6 +102,8 @@ int main() {
     for (int i = 0; i < sizeof(targets) / sizeof(targets[0]); i++) {
         int index = binarySearchLeftEdge(nums, sizeof(nums) / sizeof(nums[0]), targets[i]);
         printf("最左一个元素 %d 的索引为 %d\n", targets[i], index);
+        index = binarySearchLeftEdgeSIMD(nums, sizeof(nums) / sizeof(nums[0]), targets[i]);
+        printf("最左一个元素 %d 的索引为 %d（SIMD）\n", targets[i], index);
         index = binarySearchRightEdge(nums, sizeof(nums) / sizeof(nums[0]), targets[i]);
         printf("最右一个元素 %d 的索引为 %d\n", targets[i], index);
     }
@@ -23,9 +23,14 @@
  *                      2. 当 nums[m] == target 时，说明小于 target 的元素在区间 [i, m -1] 中，
  *                         因此采用 j = m - 1 来缩小区间，从而使指针 j 向小于 target 的元素靠近。
  *                      循环完成后，i 指向最左边的 target ，j 指向首个小于 target 的元素，因此索引 i 就是插入点。
+ *
+ *               三、SIMD 加速：每轮比较结果难以预测，分支预测失败的代价远高于一次比较。
+ *                      先用无分支二分查找将区间缩小到几十个元素，再用 SIMD 指令一次比较 8 个元素，
+ *                      统计小于 target 的元素数量即为插入点（见 simd_search.c ，运行时选择 AVX2 / SSE4 / 无分支实现）。
  */
 
 #include "../utils/common.h"
+#include "simd_search.c"
 
 /* 二分查找插入点（无重复元素） */
 int binarySearchInsertionSimple(int *nums, int len, int target) {
@@ -72,6 +77,11 @@ int binarySearchInsertion(int *nums, int len, int target) {
     return i;
 }
 
+/* 二分查找插入点（存在重复元素，SIMD 加速） */
+int binarySearchInsertionSIMD(int *nums, int len, int target) {
+    return simdLowerBound(nums, len, target);
+}
+
 /* Driver Code */
 int main() {
     // 无重复元素的数组
@@ -94,6 +104,8 @@ int main() {
     for (int i = 0; i < sizeof(targets2) / sizeof(int); i++) {
         int index = binarySearchInsertion(nums2, sizeof(nums2) / sizeof(nums2[0]), targets2[i]);
         printf("元素 %d 的插入点的索引为 %d\n", targets2[i], index);
+        index = binarySearchInsertionSIMD(nums2, sizeof(nums2) / sizeof(nums2[0]), targets2[i]);
+        printf("元素 %d 的插入点的索引为 %d（SIMD）\n", targets2[i], index);
     }
 
     return 0;
@@ -0,0 +1,157 @@
+/**
+ * @FileName    :simd_search.c
+ * @Date        :2026-10-20 03:20:15
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :SIMD 有序数组查找（节点内查找与二分查找插入点）
+ * @Description :有序索引的节点内通常有几十到几百个有序键，逐个比较的循环每步都有难以预测的分支，
+ *               一次只用到缓存行中的一个键。本文件提供统一的节点内排名（rank）函数：返回 keys 中小于 key 的元素数量，
+ *               即 key 的插入点。
+ *               1. 朴素实现：逐个比较，遇到不小于 key 的键时退出。
+ *               2. 无分支实现：二分查找，用条件传送代替分支，循环次数固定为 log2(n) 。
+ *               3. SSE4 实现：一条指令比较 4 个 int ，movemask 取出比较结果，popcount 得到小于 key 的数量。
+ *               4. AVX2 实现：一条指令比较 8 个 int ，其余同上。
+ *               键有序，因此一旦某组中出现不小于 key 的键即可停止扫描。
+ *               运行时根据 CPU 支持的指令集选择实现（首次调用时分发），也可直接修改函数指针 nodeRank 指定实现。
+ *               对于较长的数组，先用无分支二分查找将区间缩小到 SIMD_SEARCH_WINDOW 个元素，再在窗口内调用 nodeRank 。
+ */
+
+#include "../utils/common.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SIMD_SEARCH_X86
+#endif
+
+// 长数组查找时，二分查找缩小到该窗口大小后改为 SIMD 扫描
+#ifndef SIMD_SEARCH_WINDOW
+#define SIMD_SEARCH_WINDOW 64
+#endif
+
+/* 节点内排名函数：返回有序数组 keys[0..n) 中小于 key 的元素数量 */
+typedef int (*NodeRankFunc)(const int *keys, int n, int key);
+
+/* 朴素实现 */
+int nodeRankScalar(const int *keys, int n, int key) {
+    int i = 0;
+    while (i < n && keys[i] < key) {
+        i++;
+    }
+    return i;
+}
+
+/* 无分支实现：每轮将区间减半，由比较结果决定是否移动 base */
+int nodeRankBranchless(const int *keys, int n, int key) {
+    if (n == 0) {
+        return 0;
+    }
+    const int *base = keys;
+    while (n > 1) {
+        int half = n / 2;
+        base = base[half - 1] < key ? base + half : base;
+        n -= half;
+    }
+    return (int)(base - keys) + (*base < key);
+}
+
+#ifdef SIMD_SEARCH_X86
+/* SSE4 实现：每次比较 4 个键 */
+__attribute__((target("sse4.2,popcnt"))) int nodeRankSSE4(const int *keys, int n, int key) {
+    __m128i k = _mm_set1_epi32(key);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(keys + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(k, v)));
+        if (mask != 0xF) {
+            return i + __builtin_popcount(mask);
+        }
+    }
+    while (i < n && keys[i] < key) {
+        i++;
+    }
+    return i;
+}
+
+/* AVX2 实现：每次比较 8 个键 */
+__attribute__((target("avx2,popcnt"))) int nodeRankAVX2(const int *keys, int n, int key) {
+    __m256i k = _mm256_set1_epi32(key);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(keys + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(k, v)));
+        if (mask != 0xFF) {
+            return i + __builtin_popcount(mask);
+        }
+    }
+    // 剩余不足 8 个键时用 SSE 比较一次
+    if (i + 4 <= n) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(keys + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(_mm256_castsi256_si128(k), v)));
+        if (mask != 0xF) {
+            return i + __builtin_popcount(mask);
+        }
+        i += 4;
+    }
+    while (i < n && keys[i] < key) {
+        i++;
+    }
+    return i;
+}
+#endif
+
+/* 可用的实现列表 */
+typedef struct {
+    const char *name;
+    NodeRankFunc func;
+} NodeRankKernel;
+
+/* 将当前 CPU 支持的实现写入 kernels（至少 4 个元素），返回数量 */
+int nodeRankKernels(NodeRankKernel *kernels) {
+    int cnt = 0;
+    kernels[cnt++] = (NodeRankKernel){"朴素", nodeRankScalar};
+    kernels[cnt++] = (NodeRankKernel){"无分支", nodeRankBranchless};
+#ifdef SIMD_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+        kernels[cnt++] = (NodeRankKernel){"SSE4", nodeRankSSE4};
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        kernels[cnt++] = (NodeRankKernel){"AVX2", nodeRankAVX2};
+    }
+#endif
+    return cnt;
+}
+
+/* 根据 CPU 支持的指令集选择实现：优先 AVX2 ，其次 SSE4 ，否则使用无分支实现 */
+NodeRankFunc nodeRankSelect() {
+    NodeRankKernel kernels[4];
+    int cnt = nodeRankKernels(kernels);
+    return kernels[cnt - 1].func;
+}
+
+/* 节点内排名函数指针，首次调用时完成分发 */
+int nodeRankDispatch(const int *keys, int n, int key);
+NodeRankFunc nodeRank = nodeRankDispatch;
+
+/* 首次调用：选择实现后转发 */
+int nodeRankDispatch(const int *keys, int n, int key) {
+    nodeRank = nodeRankSelect();
+    return nodeRank(keys, n, key);
+}
+
+/* 返回有序数组 keys[0..n) 中小于等于 key 的元素数量 */
+int nodeRankUpper(const int *keys, int n, int key) {
+    return key == INT_MAX ? n : nodeRank(keys, n, key + 1);
+}
+
+/* 长数组的插入点（首个不小于 target 的元素下标）：无分支二分查找缩小区间后，在窗口内调用 nodeRank */
+int simdLowerBound(const int *nums, int len, int target) {
+    const int *base = nums;
+    int n = len;
+    while (n > SIMD_SEARCH_WINDOW) {
+        int half = n / 2;
+        base = base[half - 1] < target ? base + half : base;
+        n -= half;
+    }
+    return (int)(base - nums) + nodeRank(base, n, target);
+}
@@ -0,0 +1,193 @@
+/**
+ * @FileName    :simd_search_test.c
+ * @Date        :2026-10-20 03:52:40
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :SIMD 有序数组查找测试程序
+ * @Description :1. 基本测试：各实现在小数组上的排名
+ *               2. 正确性：随机长度、含重复元素与 INT_MIN / INT_MAX 的有序数组上，各实现与逐个比较的结果一致；
+ *                  长数组的 simdLowerBound 与二分查找插入点的结果一致
+ *               3. 性能：各实现的节点内查找（16 ~ 256 个键，数据在缓存中）每次查询耗时；
+ *                  长数组（10^3 ~ 10^7 个元素）查找插入点，对比分支二分查找、无分支二分查找与 simdLowerBound 。
+ */
+
+#include "../utils/bench_util.h"
+#include "simd_search.c"
+
+// 每组性能测试的查询次数
+#ifndef BENCH_QUERIES
+#define BENCH_QUERIES 2000000
+#endif
+
+/* 二分查找插入点（存在重复元素），与 binary_search_insertion.c 中的实现等价 */
+int binarySearchInsertion(int *nums, int len, int target) {
+    int i = 0, j = len - 1;
+    while (i <= j) {
+        int m = i + (j - i) / 2;
+        if (nums[m] < target) {
+            i = m + 1;
+        } else {
+            j = m - 1;
+        }
+    }
+    return i;
+}
+
+/* 基本测试 */
+void testBasic() {
+    int keys[] = {1, 3, 6, 6, 6, 6, 6, 10, 12, 15, 23, 26, 31, 35};
+    int n = sizeof(keys) / sizeof(keys[0]);
+    int targets[] = {0, 6, 7, 35, 40};
+    printf("数组 keys = ");
+    printArray(keys, n);
+    NodeRankKernel kernels[4];
+    int kernelNum = nodeRankKernels(kernels);
+    for (int k = 0; k < kernelNum; k++) {
+        printf("%-8s", kernels[k].name);
+        for (int t = 0; t < 5; t++) {
+            int rank = kernels[k].func(keys, n, targets[t]);
+            printf("  rank(%d) = %2d", targets[t], rank);
+            assert(rank == nodeRankScalar(keys, n, targets[t]));
+        }
+        printf("\n");
+    }
+    assert(nodeRankUpper(keys, n, 6) == 7 && nodeRankUpper(keys, n, INT_MAX) == n);
+    printf("当前选择的实现：%s\n", kernels[kernelNum - 1].name);
+}
+
+/* 正确性 */
+void testValidate() {
+    NodeRankKernel kernels[4];
+    int kernelNum = nodeRankKernels(kernels);
+    unsigned long long x = 2026;
+    int *keys = malloc(sizeof(int) * 300);
+    for (int round = 0; round < 20000; round++) {
+        int n = randU32(&x) % 300;
+        // 值域较小时产生大量重复元素，偶尔加入极值
+        int range = round % 2 == 0 ? 50 : 1 << 30;
+        for (int i = 0; i < n; i++) {
+            int r = randU32(&x) % 100;
+            keys[i] = r == 0 ? INT_MIN : r == 1 ? INT_MAX : (int)(randU32(&x) % range) - range / 2;
+        }
+        qsort(keys, n, sizeof(int), cmpInt);
+        int target = round % 7 == 0 ? INT_MIN : round % 7 == 1 ? INT_MAX : (int)(randU32(&x) % range) - range / 2;
+        int expect = nodeRankScalar(keys, n, target);
+        for (int k = 0; k < kernelNum; k++) {
+            assert(kernels[k].func(keys, n, target) == expect);
+        }
+    }
+    free(keys);
+
+    int len = 1000003;
+    int *nums = malloc(sizeof(int) * len);
+    for (int i = 0; i < len; i++) {
+        nums[i] = (int)(randU32(&x) % (len / 4));
+    }
+    qsort(nums, len, sizeof(int), cmpInt);
+    for (int k = 0; k < kernelNum; k++) {
+        nodeRank = kernels[k].func;
+        for (int q = 0; q < 20000; q++) {
+            int target = (int)(randU32(&x) % (len / 4 + 2)) - 1;
+            int sub = randU32(&x) % len + 1;
+            assert(simdLowerBound(nums, sub, target) == binarySearchInsertion(nums, sub, target));
+        }
+    }
+    nodeRank = nodeRankSelect();
+    free(nums);
+    printf("各实现在随机有序数组上的结果一致\n");
+}
+
+/* 性能测试 */
+void testBenchmark() {
+    NodeRankKernel kernels[4];
+    int kernelNum = nodeRankKernels(kernels);
+    unsigned long long x = 0x9E3779B97F4A7C15ULL;
+    int *targets = malloc(sizeof(int) * BENCH_QUERIES);
+
+    /* 节点内查找：64 个节点轮流查询，数据常驻 L1 / L2 */
+    printf("节点内查找（ns / 次）\n%-8s", "键数量");
+    for (int k = 0; k < kernelNum; k++) {
+        printf("%10s", kernels[k].name);
+    }
+    printf("\n");
+    int nodeNum = 64;
+    for (int n = 16; n <= 256; n *= 2) {
+        int *nodes = malloc(sizeof(int) * n * nodeNum);
+        for (int i = 0; i < n * nodeNum; i++) {
+            nodes[i] = (int)(randU32(&x) % 100000);
+        }
+        for (int j = 0; j < nodeNum; j++) {
+            qsort(nodes + j * n, n, sizeof(int), cmpInt);
+        }
+        for (int q = 0; q < BENCH_QUERIES; q++) {
+            targets[q] = (int)(randU32(&x) % 100000);
+        }
+        printf("%-8d", n);
+        long long expect = -1;
+        for (int k = 0; k < kernelNum; k++) {
+            long long sum = 0;
+            double start = wallSeconds();
+            for (int q = 0; q < BENCH_QUERIES; q++) {
+                sum += kernels[k].func(nodes + (q % nodeNum) * n, n, targets[q]);
+            }
+            printf("%10.2f", (wallSeconds() - start) / BENCH_QUERIES * 1e9);
+            assert(expect < 0 || sum == expect);
+            expect = sum;
+        }
+        printf("\n");
+        free(nodes);
+    }
+
+    /* 长数组查找插入点 */
+    printf("\n长数组查找插入点（ns / 次，后 %d 列为 simdLowerBound 在窗口内使用的实现）\n", kernelNum);
+    printf("%-10s %10s %10s", "元素数量", "分支二分", "无分支二分");
+    for (int k = 0; k < kernelNum; k++) {
+        printf("%10s", kernels[k].name);
+    }
+    printf("\n");
+    for (int len = 1000; len <= 10000000; len *= 100) {
+        int *nums = malloc(sizeof(int) * len);
+        for (int i = 0; i < len; i++) {
+            nums[i] = (int)(randU32(&x) >> 1);
+        }
+        qsort(nums, len, sizeof(int), cmpInt);
+        for (int q = 0; q < BENCH_QUERIES; q++) {
+            targets[q] = (int)(randU32(&x) >> 1);
+        }
+        printf("%-10d", len);
+        long long expect = 0, sum = 0;
+        double start = wallSeconds();
+        for (int q = 0; q < BENCH_QUERIES; q++) {
+            expect += binarySearchInsertion(nums, len, targets[q]);
+        }
+        printf(" %10.2f", (wallSeconds() - start) / BENCH_QUERIES * 1e9);
+        start = wallSeconds();
+        for (int q = 0; q < BENCH_QUERIES; q++) {
+            sum += nodeRankBranchless(nums, len, targets[q]);
+        }
+        printf(" %10.2f", (wallSeconds() - start) / BENCH_QUERIES * 1e9);
+        assert(sum == expect);
+        for (int k = 0; k < kernelNum; k++) {
+            nodeRank = kernels[k].func;
+            sum = 0;
+            start = wallSeconds();
+            for (int q = 0; q < BENCH_QUERIES; q++) {
+                sum += simdLowerBound(nums, len, targets[q]);
+            }
+            printf("%10.2f", (wallSeconds() - start) / BENCH_QUERIES * 1e9);
+            assert(sum == expect);
+        }
+        printf("\n");
+        free(nums);
+    }
+    nodeRank = nodeRankSelect();
+    free(targets);
+}
+
+/* Driver Code */
+int main() {
+    runTest("testBasic", testBasic);
+    runTest("testValidate", testValidate);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
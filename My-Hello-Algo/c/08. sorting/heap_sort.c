@@ -0,0 +1,215 @@
+/**
+ * @FileName    :heap_sort.c
+ * @Date        :2026-10-19 13:02:26
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :堆排序（heap sort）及其自底向上优化
+ * @Description :一、经典堆排序
+ *               1. 输入数组并建立大顶堆，完成后最大元素位于堆顶。
+ *               2. 将堆顶元素与堆底元素交换，堆的长度减 1 ，已排序元素数量加 1 。
+ *               3. 从堆顶元素开始，从顶到底执行堆化。完成堆化后，堆的性质得到修复。
+ *               4. 循环执行第 2. 步和第 3. 步，循环 n - 1 轮后，即可完成数组排序。
+ *
+ *               二、自底向上堆化（Floyd / Wegener）
+ *               经典堆化每层比较 2 次；自底向上堆化让空位沿较大子节点下沉到叶节点（每层比较 1 次），
+ *               再将原值从叶节点向上回溯。出堆时换到堆顶的元素通常很小，回溯距离很短，总比较次数约为 n log n 。
+ *               下沉路径的每一步都依赖上一步的比较结果，因此在下沉时预取后两层的子节点块，以隐藏缓存未命中。
+ *
+ *               三、分块建堆
+ *               经典建堆按索引倒序处理，当数组超过 L2 缓存时，每个节点的子树分散在整个数组中，缓存命中率低。
+ *               分块建堆按深度优先（后序）处理节点：子树规模不超过 HEAP_BLOCK_SIZE 时整体在缓存中完成建堆，
+ *               更大的子树先递归处理左右子树再堆化根节点。
+ *
+ *               四、非原地全部出堆
+ *               将堆顶依次输出到另一个数组，堆顶空位直接下沉到叶节点后用堆尾元素填补，省去一次交换。
+ *
+ *               定义 HEAP_SORT_STATS 可统计元素比较次数。
+ */
+
+#include "../utils/common.h"
+
+// L2 缓存大小（字节），子树小于其一半时在缓存内完成建堆
+#define L2_CACHE_SIZE (1 << 20)
+#define HEAP_BLOCK_SIZE (L2_CACHE_SIZE / 2 / (int)sizeof(int))
+
+#ifdef HEAP_SORT_STATS
+// 元素比较次数
+long long heapCmpCount = 0;
+#define HEAP_CMP() (heapCmpCount++)
+#else
+#define HEAP_CMP() ((void)0)
+#endif
+
+/* 堆的长度为 n ，从节点 i 开始，从顶至底堆化 */
+void siftDown(int nums[], int n, int i) {
+    while (true) {
+        // 判断节点 i, l, r 中值最大的节点，记为 max
+        int l = 2 * i + 1;
+        int r = 2 * i + 2;
+        int max = i;
+        if (l < n && (HEAP_CMP(), nums[l] > nums[max])) {
+            max = l;
+        }
+        if (r < n && (HEAP_CMP(), nums[r] > nums[max])) {
+            max = r;
+        }
+        // 若节点 i 最大或索引 l, r 越界，则无须继续堆化，跳出
+        if (max == i) {
+            break;
+        }
+        // 交换两节点
+        int temp = nums[i];
+        nums[i] = nums[max];
+        nums[max] = temp;
+        // 循环向下堆化
+        i = max;
+    }
+}
+
+/* 空位从节点 i 沿较大子节点下沉到叶节点，返回空位最终的索引 */
+int siftHoleToLeaf(int nums[], int n, int i) {
+    int hole = i;
+    int l = 2 * hole + 1;
+    // 左右子节点都存在：比较 1 次选出较大者
+    while (l + 1 < n) {
+        // 预取后两层的子节点块，隐藏下沉路径上的缓存未命中
+        __builtin_prefetch(&nums[8 * (long long)hole + 7]);
+        __builtin_prefetch(&nums[16 * (long long)hole + 15]);
+        HEAP_CMP();
+        l += nums[l + 1] > nums[l];
+        nums[hole] = nums[l];
+        hole = l;
+        l = 2 * hole + 1;
+    }
+    // 只有左子节点
+    if (l < n) {
+        nums[hole] = nums[l];
+        hole = l;
+    }
+    return hole;
+}
+
+/* 将 val 放入空位 hole ，并向上回溯到正确位置（不越过节点 top ） */
+void siftUpFromHole(int nums[], int top, int hole, int val) {
+    while (hole > top) {
+        int p = (hole - 1) / 2;
+        HEAP_CMP();
+        if (nums[p] >= val) {
+            break;
+        }
+        nums[hole] = nums[p];
+        hole = p;
+    }
+    nums[hole] = val;
+}
+
+/* 堆的长度为 n ，从节点 i 开始，自底向上堆化 */
+void siftDownBottomUp(int nums[], int n, int i) {
+    int val = nums[i];
+    int hole = siftHoleToLeaf(nums, n, i);
+    siftUpFromHole(nums, i, hole, val);
+}
+
+/* 经典建堆：堆化除叶节点以外的其他所有节点 */
+void heapify(int nums[], int n) {
+    for (int i = n / 2 - 1; i >= 0; --i) {
+        siftDown(nums, n, i);
+    }
+}
+
+/* 在节点 i 的子树内按层倒序建堆（子树的每一层在数组中是连续区间） */
+void heapifySubtree(int nums[], int n, int i) {
+    // 找到子树的最后一层：第 k 层区间为 [(i + 1) * 2^k - 1, (i + 1) * 2^(k + 1) - 1)
+    long long lo = i, width = 1;
+    while (2 * lo + 1 < n) {
+        lo = 2 * lo + 1;
+        width *= 2;
+    }
+    // 从最后一层往上逐层处理，层内倒序
+    while (width >= 1) {
+        long long hi = lo + width < n ? lo + width : n;
+        for (long long j = hi - 1; j >= lo; j--) {
+            if (2 * j + 1 < n) {
+                siftDownBottomUp(nums, n, (int)j);
+            }
+        }
+        lo = (lo - 1) / 2;
+        width /= 2;
+    }
+}
+
+/* 深度优先建堆：子树足够小时在缓存内整体建堆 */
+void heapifyDFS(int nums[], int n, int i) {
+    // 叶节点无须堆化
+    if (2 * i + 1 >= n) {
+        return;
+    }
+    // 节点 i 的子树规模约为 n / (i + 1)
+    if (n / (i + 1) <= HEAP_BLOCK_SIZE) {
+        heapifySubtree(nums, n, i);
+        return;
+    }
+    heapifyDFS(nums, n, 2 * i + 1);
+    heapifyDFS(nums, n, 2 * i + 2);
+    siftDownBottomUp(nums, n, i);
+}
+
+/* 分块建堆：数组小于 L2 缓存时直接倒序建堆，否则深度优先建堆 */
+void heapifyBlocked(int nums[], int n) {
+    if (n <= HEAP_BLOCK_SIZE) {
+        for (int i = n / 2 - 1; i >= 0; --i) {
+            siftDownBottomUp(nums, n, i);
+        }
+    } else {
+        heapifyDFS(nums, n, 0);
+    }
+}
+
+/* 堆排序 */
+void heapSort(int nums[], int n) {
+    // 建堆操作：堆化除叶节点以外的其他所有节点
+    heapify(nums, n);
+    // 从堆中提取最大元素，循环 n-1 轮
+    for (int i = n - 1; i > 0; --i) {
+        // 交换根节点与最右叶节点（交换首元素与尾元素）
+        int tmp = nums[0];
+        nums[0] = nums[i];
+        nums[i] = tmp;
+        // 以根节点为起点，从顶至底进行堆化
+        siftDown(nums, i, 0);
+    }
+}
+
+/* 堆排序（自底向上堆化 + 分块建堆） */
+void heapSortBottomUp(int nums[], int n) {
+    heapifyBlocked(nums, n);
+    for (int i = n - 1; i > 0; --i) {
+        // 取出堆顶，堆顶空位下沉到叶节点后放入原堆尾元素并回溯
+        int top = nums[0];
+        int val = nums[i];
+        int hole = siftHoleToLeaf(nums, i, 0);
+        siftUpFromHole(nums, 0, hole, val);
+        nums[i] = top;
+    }
+}
+
+/* 非原地全部出堆：heap 为长度 n 的大顶堆，出堆结果按升序写入 out ，heap 内容被破坏 */
+void heapPopAll(int heap[], int n, int out[]) {
+    for (int i = n - 1; i >= 0; --i) {
+        out[i] = heap[0];
+        // 空位下沉到叶节点，再用堆尾元素填补
+        int hole = siftHoleToLeaf(heap, i + 1, 0);
+        if (hole != i) {
+            siftUpFromHole(heap, 0, hole, heap[i]);
+        }
+    }
+}
+
+/* 非原地堆排序：nums 保持不变，排序结果写入 out */
+void heapSortOutOfPlace(int nums[], int n, int out[]) {
+    int *heap = malloc(sizeof(int) * n);
+    memcpy(heap, nums, sizeof(int) * n);
+    heapifyBlocked(heap, n);
+    heapPopAll(heap, n, out);
+    free(heap);
+}
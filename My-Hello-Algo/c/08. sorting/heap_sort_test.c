@@ -0,0 +1,137 @@
+/**
+ * @FileName    :heap_sort_test.c
+ * @Date        :2026-10-19 13:02:26
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :堆排序测试程序
+ * @Description :1. 正确性测试：经典堆排序、自底向上堆排序、非原地堆排序
+ *               2. 性能对比：建堆与排序的耗时和比较次数
+ *                  默认规模为 10^7 ，可通过 -DBENCH_SIZE=100000000 测试 10^8 规模；
+ *                  比较次数需通过 -DHEAP_SORT_STATS 开启统计，指令数可配合 perf stat 测量。
+ */
+
+#include "../utils/bench_util.h"
+#include "heap_sort.c"
+
+#ifndef BENCH_SIZE
+#define BENCH_SIZE 10000000
+#endif
+
+/* 判断数组是否升序 */
+bool isSorted(int nums[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (nums[i - 1] > nums[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 判断数组是否为大顶堆 */
+bool isMaxHeap(int nums[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (nums[(i - 1) / 2] < nums[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 正确性测试 */
+void testSort() {
+    int nums[] = {4, 1, 3, 1, 5, 2};
+    int n = sizeof(nums) / sizeof(nums[0]);
+    int nums1[6], nums2[6], out[6];
+    memcpy(nums1, nums, sizeof(nums));
+    memcpy(nums2, nums, sizeof(nums));
+
+    heapSort(nums1, n);
+    printf("堆排序完成后 nums = ");
+    printArray(nums1, n);
+
+    heapSortBottomUp(nums2, n);
+    printf("自底向上堆排序完成后 nums = ");
+    printArray(nums2, n);
+
+    heapSortOutOfPlace(nums, n, out);
+    printf("非原地堆排序完成后 out = ");
+    printArray(out, n);
+
+    // 随机数组及各种长度的边界情况
+    for (int len = 0; len < 300; len++) {
+        int *a = malloc(sizeof(int) * (len + 1));
+        int *b = malloc(sizeof(int) * (len + 1));
+        for (int i = 0; i < len; i++) {
+            a[i] = rand() % 50;
+        }
+        heapSortOutOfPlace(a, len, b);
+        heapSortBottomUp(a, len);
+        assert(isSorted(a, len) && memcmp(a, b, sizeof(int) * len) == 0);
+        free(a);
+        free(b);
+    }
+}
+
+/* 统计并打印一次运行的耗时与比较次数 */
+void report(const char *name, clock_t start) {
+    printf("%-24s %8.3f s", name, (double)(clock() - start) / CLOCKS_PER_SEC);
+#ifdef HEAP_SORT_STATS
+    printf("  比较 %lld 次", heapCmpCount);
+    heapCmpCount = 0;
+#endif
+    printf("\n");
+}
+
+/* 性能对比 */
+void testBenchmark() {
+    int n = BENCH_SIZE;
+    int *src = malloc(sizeof(int) * n);
+    int *nums = malloc(sizeof(int) * n);
+    int *out = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        src[i] = rand();
+    }
+    printf("\n元素数量 %d\n", n);
+    clock_t start;
+
+    memcpy(nums, src, sizeof(int) * n);
+    start = clock();
+    heapify(nums, n);
+    report("经典建堆", start);
+    assert(isMaxHeap(nums, n));
+
+    memcpy(nums, src, sizeof(int) * n);
+    start = clock();
+    heapifyBlocked(nums, n);
+    report("分块自底向上建堆", start);
+    assert(isMaxHeap(nums, n));
+
+    memcpy(nums, src, sizeof(int) * n);
+    start = clock();
+    heapSort(nums, n);
+    report("经典堆排序", start);
+    assert(isSorted(nums, n));
+
+    memcpy(nums, src, sizeof(int) * n);
+    start = clock();
+    heapSortBottomUp(nums, n);
+    report("自底向上堆排序", start);
+    assert(isSorted(nums, n));
+
+    start = clock();
+    heapSortOutOfPlace(src, n, out);
+    report("非原地堆排序", start);
+    assert(isSorted(out, n));
+
+    free(src);
+    free(nums);
+    free(out);
+}
+
+/* Driver Code */
+int main() {
+    srand(2026);
+    runTest("testSort", testSort);
+    runTest("testBenchmark", testBenchmark);
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * @FileName    :bench_util.h
+ * @Date        :2026-10-20 15:02:37
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :测试与性能测试程序的公共函数
+ * @Description :1. wallSeconds ：墙上时间（秒），多线程测试也适用
+ *               2. randU32 ：xorshift64 随机数，比 rand 快且可由种子复现
+ *               3. cmpInt ：qsort 使用的升序比较函数
+ *               4. runTest ：打印 ==testXxx== 标题并运行测试，测试之间空一行
+ *               5. randUnit ：由 xorshift64 生成 [0, 1) 均匀随机数
+ *               6. shuffleVertexIds ：随机打乱边表中的顶点编号，消除编号与度、与位置的相关性
+ *               7. genKroneckerEdges ：生成 Graph500 Kronecker 图的边表（A = 0.57, B = C = 0.19），
+ *                  规模 scale 、边因子 edgeFactor 、种子 seed 相同时结果相同
+ */
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 计算耗时（秒），多线程下使用墙上时间 */
+double wallSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* 生成 32 位随机数（xorshift64） */
+unsigned int randU32(unsigned long long *x) {
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return (unsigned int)(*x >> 32);
+}
+
+/* 升序比较函数 */
+int cmpInt(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/* 生成 [0, 1) 均匀随机数（xorshift64） */
+double randUnit(unsigned long long *x) {
+    *x ^= *x << 13;
+    *x ^= *x >> 7;
+    *x ^= *x << 17;
+    return (*x >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* 随机打乱边表中的顶点编号（Fisher-Yates） */
+void shuffleVertexIds(int *src, int *dst, long long m, int n, unsigned long long *x) {
+    int *perm = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        perm[i] = i;
+    }
+    for (int i = n - 1; i > 0; i--) {
+        int j = (int)(randUnit(x) * (i + 1));
+        int tmp = perm[i];
+        perm[i] = perm[j];
+        perm[j] = tmp;
+    }
+    for (long long i = 0; i < m; i++) {
+        src[i] = perm[src[i]];
+        dst[i] = perm[dst[i]];
+    }
+    free(perm);
+}
+
+/**
+ * @brief  生成 Kronecker 图的边表：顶点数量 2^scale ，边数量 edgeFactor * 2^scale ，顶点编号随机打乱
+ * @param  src      输出，起点数组（由调用者 free）
+ * @param  dst      输出，终点数组（由调用者 free）
+ * @return 边数量
+ */
+long long genKroneckerEdges(int scale, int edgeFactor, unsigned long long seed, int **src, int **dst) {
+    int n = 1 << scale;
+    long long m = (long long)edgeFactor * n;
+    int *s = malloc(sizeof(int) * m), *d = malloc(sizeof(int) * m);
+    unsigned long long x = 0x9E3779B97F4A7C15ULL * (seed + 1);
+    for (long long i = 0; i < m; i++) {
+        int u = 0, v = 0;
+        // 每一位按概率选择邻接矩阵的一个象限
+        for (int bit = 0; bit < scale; bit++) {
+            double r = randUnit(&x);
+            if (r >= 0.57 && r < 0.76) {
+                v |= 1 << bit;
+            } else if (r >= 0.76 && r < 0.95) {
+                u |= 1 << bit;
+            } else if (r >= 0.95) {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        s[i] = u;
+        d[i] = v;
+    }
+    shuffleVertexIds(s, d, m, n, &x);
+    *src = s;
+    *dst = d;
+    return m;
+}
+
+/* 打印标题并运行测试 */
+void runTest(const char *name, void (*test)(void)) {
+    static int count = 0;
+    printf("%s==%s==\n", count++ > 0 ? "\n" : "", name);
+    test();
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BENCH_UTIL_H
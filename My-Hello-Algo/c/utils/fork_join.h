@@ -0,0 +1,277 @@
+/**
+ * @FileName    :fork_join.h
+ * @Date        :2026-10-20 11:40:18
+ * @Author      :LiuBaiWan (https://github.com/LiuBaiWan592)
+ * @Version     :V1.0.0
+ * @Brief       :基于 pthread 的工作窃取（work-stealing）fork-join 运行时
+ * @Description :分治算法的两个子问题互不依赖，可以交给不同的线程执行。
+ *               1. 线程池中每个工作线程有一个双端队列（Chase-Lev deque）：fjFork 将子任务压入自己队列的底部，
+ *                  fjJoin 等待子任务完成——子任务仍在队列底部时直接弹出并在当前线程执行（最常见的情况，几乎没有开销），
+ *                  已被其他线程取走时，一边等待一边窃取并执行其他任务。
+ *               2. 空闲的线程随机选择一个线程，从其队列的顶部窃取任务。顶部的任务是最早压入的，即分治树中靠近根的大任务，
+ *                  因此窃取次数很少，各线程大部分时间在处理自己的子树。
+ *               3. 队列的所有者只在底部操作，窃取者只在顶部操作，只有队列中剩一个任务时两者才需要 CAS 竞争，无需加锁。
+ *               4. fjRun 由调用线程作为 0 号工作线程执行根任务；没有任务时其余线程在条件变量上休眠。
+ *               5. 队列已满时（如退化为链的分治树，每层都 fork）fjFork 直接在当前线程执行子任务，不会越界。
+ *               任务函数的第一个参数为当前的工作线程，fork 与 join 都须在该线程上调用，且按后进先出的顺序 join 。
+ */
+
+#ifndef FORK_JOIN_H
+#define FORK_JOIN_H
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 每个工作线程的队列容量（须为 2 的幂；同时未 join 的任务数量不超过递归深度，超过容量的 fork 就地执行）
+#define FJ_DEQUE_SIZE 4096
+
+struct FjWorker;
+
+/* 任务函数 */
+typedef void (*FjFunc)(struct FjWorker *w, void *arg);
+
+/* 任务 */
+typedef struct {
+    FjFunc func;
+    void *arg;
+    int done; // 是否已执行完毕
+} FjTask;
+
+/* 工作线程 */
+typedef struct FjWorker {
+    struct FjPool *pool;
+    int id;
+    long long top;              // 窃取端（由窃取者修改）
+    char padding1[48];
+    long long bottom;           // 所有者端（只由所有者修改）
+    char padding2[56];
+    unsigned long long seed;    // 选择窃取对象的随机数种子
+    long long steals;           // 成功窃取的次数
+    FjTask *deque[FJ_DEQUE_SIZE];
+} __attribute__((aligned(64))) FjWorker;
+
+/* 线程池 */
+typedef struct FjPool {
+    int threadNum;
+    FjWorker *workers;
+    pthread_t *tids;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int active;   // 是否有根任务正在执行
+    int shutdown; // 是否正在销毁
+} FjPool;
+
+/* 压入队列底部（所有者） */
+void fjPush(FjWorker *w, FjTask *task) {
+    long long b = __atomic_load_n(&w->bottom, __ATOMIC_RELAXED);
+    assert(b - __atomic_load_n(&w->top, __ATOMIC_ACQUIRE) < FJ_DEQUE_SIZE);
+    __atomic_store_n(&w->deque[b & (FJ_DEQUE_SIZE - 1)], task, __ATOMIC_RELAXED);
+    __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELEASE);
+}
+
+/* 从队列底部弹出（所有者），队列为空或最后一个任务被窃取时返回 NULL */
+FjTask *fjPop(FjWorker *w) {
+    long long b = __atomic_load_n(&w->bottom, __ATOMIC_RELAXED) - 1;
+    __atomic_store_n(&w->bottom, b, __ATOMIC_SEQ_CST);
+    long long t = __atomic_load_n(&w->top, __ATOMIC_SEQ_CST);
+    if (t > b) {
+        __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    FjTask *task = __atomic_load_n(&w->deque[b & (FJ_DEQUE_SIZE - 1)], __ATOMIC_RELAXED);
+    if (t == b) {
+        // 只剩一个任务，与窃取者竞争
+        if (!__atomic_compare_exchange_n(&w->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            task = NULL;
+        }
+        __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+/* 从队列顶部窃取（其他线程），失败时返回 NULL */
+FjTask *fjSteal(FjWorker *v) {
+    long long t = __atomic_load_n(&v->top, __ATOMIC_SEQ_CST);
+    long long b = __atomic_load_n(&v->bottom, __ATOMIC_SEQ_CST);
+    if (t >= b) {
+        return NULL;
+    }
+    FjTask *task = __atomic_load_n(&v->deque[t & (FJ_DEQUE_SIZE - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&v->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+    return task;
+}
+
+/* 执行任务并标记完成 */
+void fjExecute(FjWorker *w, FjTask *task) {
+    task->func(w, task->arg);
+    __atomic_store_n(&task->done, 1, __ATOMIC_RELEASE);
+}
+
+/* 随机选择一个其他线程尝试窃取 */
+FjTask *fjStealAny(FjWorker *w) {
+    int n = w->pool->threadNum;
+    if (n <= 1) {
+        return NULL;
+    }
+    w->seed ^= w->seed << 13;
+    w->seed ^= w->seed >> 7;
+    w->seed ^= w->seed << 17;
+    int victim = (int)((w->seed >> 32) % (n - 1));
+    victim += victim >= w->id;
+    FjTask *task = fjSteal(&w->pool->workers[victim]);
+    if (task != NULL) {
+        w->steals++;
+    }
+    return task;
+}
+
+/* fork ：子任务交给运行时，可能由其他线程执行；队列已满时直接执行，之后的 fjJoin 立即返回 */
+void fjFork(FjWorker *w, FjTask *task, FjFunc func, void *arg) {
+    task->func = func;
+    task->arg = arg;
+    task->done = 0;
+    // top 只会被窃取者增大，此处的判断偏保守，不会误判为未满
+    if (__atomic_load_n(&w->bottom, __ATOMIC_RELAXED) - __atomic_load_n(&w->top, __ATOMIC_ACQUIRE) >= FJ_DEQUE_SIZE) {
+        fjExecute(w, task);
+        return;
+    }
+    fjPush(w, task);
+}
+
+/* join ：等待子任务完成 */
+void fjJoin(FjWorker *w, FjTask *task) {
+    if (!__atomic_load_n(&task->done, __ATOMIC_ACQUIRE)) {
+        FjTask *own = fjPop(w);
+        if (own != NULL) {
+            // 后进先出：弹出的一定是 task 本身
+            assert(own == task);
+            fjExecute(w, own);
+            return;
+        }
+    }
+    // 已被窃取：等待期间帮助执行其他任务
+    int idle = 0;
+    while (!__atomic_load_n(&task->done, __ATOMIC_ACQUIRE)) {
+        FjTask *other = fjStealAny(w);
+        if (other != NULL) {
+            fjExecute(w, other);
+            idle = 0;
+        } else if (++idle > 16) {
+            sched_yield();
+        }
+    }
+}
+
+/* 工作线程主循环 */
+void *fjWorkerLoop(void *arg) {
+    FjWorker *w = (FjWorker *)arg;
+    FjPool *pool = w->pool;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!__atomic_load_n(&pool->active, __ATOMIC_ACQUIRE) && !pool->shutdown) {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        }
+        int shutdown = pool->shutdown;
+        pthread_mutex_unlock(&pool->lock);
+        if (shutdown) {
+            return NULL;
+        }
+        int idle = 0;
+        while (__atomic_load_n(&pool->active, __ATOMIC_ACQUIRE)) {
+            FjTask *task = fjStealAny(w);
+            if (task != NULL) {
+                fjExecute(w, task);
+                idle = 0;
+            } else if (++idle > 16) {
+                sched_yield();
+            }
+        }
+    }
+}
+
+/* 构造函数：threadNum 个工作线程（含调用 fjRun 的线程） */
+FjPool *newFjPool(int threadNum) {
+    FjPool *pool = (FjPool *)malloc(sizeof(FjPool));
+    pool->threadNum = threadNum;
+    pool->workers = (FjWorker *)aligned_alloc(64, sizeof(FjWorker) * threadNum);
+    pool->tids = (pthread_t *)malloc(sizeof(pthread_t) * threadNum);
+    pool->active = 0;
+    pool->shutdown = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->cond, NULL);
+    for (int i = 0; i < threadNum; i++) {
+        FjWorker *w = &pool->workers[i];
+        w->pool = pool;
+        w->id = i;
+        w->top = w->bottom = 0;
+        w->seed = 0x9E3779B97F4A7C15ULL * (i + 1);
+        w->steals = 0;
+    }
+    for (int i = 1; i < threadNum; i++) {
+        pthread_create(&pool->tids[i], NULL, fjWorkerLoop, &pool->workers[i]);
+    }
+    return pool;
+}
+
+/* 析构函数 */
+void delFjPool(FjPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 1; i < pool->threadNum; i++) {
+        pthread_join(pool->tids[i], NULL);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->cond);
+    free(pool->workers);
+    free(pool->tids);
+    free(pool);
+}
+
+/* 执行根任务，返回时所有 fork 出的任务都已完成 */
+void fjRun(FjPool *pool, FjFunc func, void *arg) {
+    pthread_mutex_lock(&pool->lock);
+    __atomic_store_n(&pool->active, 1, __ATOMIC_RELEASE);
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
+    func(&pool->workers[0], arg);
+    __atomic_store_n(&pool->active, 0, __ATOMIC_RELEASE);
+}
+
+/* 并行 for 的参数 */
+typedef struct {
+    long long lo, hi, grain;
+    void (*body)(long long lo, long long hi, void *arg);
+    void *arg;
+} FjForArgs;
+
+/* 并行 for ：区间长度超过 grain 时对半拆分，否则顺序执行 body(lo, hi, arg) */
+void fjParallelFor(FjWorker *w, void *arg) {
+    FjForArgs *a = (FjForArgs *)arg;
+    if (a->hi - a->lo <= a->grain) {
+        a->body(a->lo, a->hi, a->arg);
+        return;
+    }
+    long long mid = a->lo + (a->hi - a->lo) / 2;
+    FjForArgs left = {a->lo, mid, a->grain, a->body, a->arg}, right = {mid, a->hi, a->grain, a->body, a->arg};
+    FjTask task;
+    fjFork(w, &task, fjParallelFor, &right);
+    fjParallelFor(w, &left);
+    fjJoin(w, &task);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FORK_JOIN_H
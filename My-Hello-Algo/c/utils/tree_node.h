@@ -6,6 +6,8 @@
  * @Brief       :树结构定义
  * @Description :二叉树节点结构体、构造函数、将列表反序列化为二叉树：递归、将列表反序列化为二叉树
  *               将二叉树序列化为列表：递归、将二叉树序列化为列表、释放二叉树内存
+ *               节点内存池：按块批量申请节点，O(1) 分配与回收，销毁内存池时整块释放，合并两个内存池
+ *               节点中的子树大小 size 与子树节点值之和 sum 仅由 AVL 树维护（见 avl_tree.c 的 updateAug）
  */
 
 #ifndef TREE_NODE_H
@@ -23,6 +25,8 @@ extern "C" {
 typedef struct TreeNode {
     int val;                // 节点值
     int height;             // 节点高度
+    int size;               // 子树节点数量（AVL 树维护，用于排名查询）
+    long long sum;          // 子树节点值之和（AVL 树维护，用于区间求和）
     struct TreeNode *left;  // 左子节点指针
     struct TreeNode *right; // 右子节点指针
 } TreeNode;
@@ -34,6 +38,8 @@ TreeNode *newTreeNode(int val) {
     node = (TreeNode *)malloc(sizeof(TreeNode));
     node->val = val;
     node->height = 0;
+    node->size = 1;
+    node->sum = val;
     node->left = NULL;
     node->right = NULL;
     return node;
@@ -73,16 +79,18 @@ TreeNode *arrayToTree(int *arr, int size) {
 }
 
 /* 将二叉树序列化为列表：递归 */
-void treeToArrayDFS(TreeNode *root, int i, int *res, int *size) {
+// res 扩容时地址可能改变，因此传入指针的地址
+void treeToArrayDFS(TreeNode *root, int i, int **res, int *size) {
     if (root == NULL) {
         return;
     }
-    while (i >= *size) {
-        res = realloc(res, (*size + 1) * sizeof(int));
-        res[*size] = INT_MAX;
-        (*size)++;
+    if (i >= *size) {
+        *res = realloc(*res, (i + 1) * sizeof(int));
+        while (*size <= i) {
+            (*res)[(*size)++] = INT_MAX;
+        }
     }
-    res[i] = root->val;
+    (*res)[i] = root->val;
     treeToArrayDFS(root->left, 2 * i + 1, res, size);
     treeToArrayDFS(root->right, 2 * i + 2, res, size);
 }
@@ -92,17 +100,160 @@ int *treeToArray(TreeNode *root, int *size) {
     int *res = (int *)malloc(sizeof(int) * *size);
     *size = 0;
     // int *res = NULL;
-    treeToArrayDFS(root, 0, res, size);
+    treeToArrayDFS(root, 0, &res, size);
     return res;
 }
 
 /* 释放二叉树内存 */
+// 不使用递归：有左子节点时右旋，把左子树逐步转到右侧，否则释放根节点并转向右子树，
+// O(1) 额外空间，很深（如退化为链表）的树也不会栈溢出
 void freeMemoryTree(TreeNode *root) {
-    if (root == NULL)
+    while (root != NULL) {
+        if (root->left != NULL) {
+            TreeNode *left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            TreeNode *right = root->right;
+            free(root);
+            root = right;
+        }
+    }
+}
+
+/* 节点内存池 */
+// 每次 malloc 一个节点有分配器的元数据开销，节点散落在堆中，逐个 free 也较慢。
+// 内存池按块（slab）批量申请节点，块的大小从 TREE_POOL_MIN_SLAB 开始倍增至 TREE_POOL_MAX_SLAB ；
+// 回收的节点通过 left 指针串成空闲链表，分配时优先复用；销毁内存池时只需释放各个块。
+#define TREE_POOL_MIN_SLAB 64
+#define TREE_POOL_MAX_SLAB 65536
+
+/* 内存块，节点数组紧随其后 */
+typedef struct TreeNodeSlab {
+    struct TreeNodeSlab *next; // 下一个块
+    long long capacity;        // 块中的节点数量
+} TreeNodeSlab;
+
+/* 节点内存池结构体 */
+typedef struct {
+    TreeNodeSlab *slabs; // 已申请的块，最新的块在链表头部
+    long long used;      // 最新的块中已分配的节点数量
+    TreeNode *freeList;  // 空闲节点链表
+    long long live;      // 正在使用的节点数量
+    long long capacity;  // 所有块的节点总数
+} TreeNodePool;
+
+/* 构造函数 */
+TreeNodePool *newTreeNodePool() {
+    TreeNodePool *pool = (TreeNodePool *)malloc(sizeof(TreeNodePool));
+    pool->slabs = NULL;
+    pool->used = 0;
+    pool->freeList = NULL;
+    pool->live = 0;
+    pool->capacity = 0;
+    return pool;
+}
+
+/* 析构函数：整块释放所有节点 */
+void delTreeNodePool(TreeNodePool *pool) {
+    while (pool->slabs != NULL) {
+        TreeNodeSlab *next = pool->slabs->next;
+        free(pool->slabs);
+        pool->slabs = next;
+    }
+    free(pool);
+}
+
+/* 从内存池分配节点，pool 为 NULL 时等同于 newTreeNode */
+TreeNode *treeNodeAlloc(TreeNodePool *pool, int val) {
+    if (pool == NULL) {
+        return newTreeNode(val);
+    }
+    TreeNode *node = pool->freeList;
+    if (node != NULL) {
+        pool->freeList = node->left;
+    } else {
+        if (pool->slabs == NULL || pool->used == pool->slabs->capacity) {
+            // 当前块已用完，申请一个更大的块
+            long long cap = pool->slabs == NULL ? TREE_POOL_MIN_SLAB : pool->slabs->capacity * 2;
+            if (cap > TREE_POOL_MAX_SLAB) {
+                cap = TREE_POOL_MAX_SLAB;
+            }
+            TreeNodeSlab *slab = (TreeNodeSlab *)malloc(sizeof(TreeNodeSlab) + sizeof(TreeNode) * cap);
+            slab->next = pool->slabs;
+            slab->capacity = cap;
+            pool->slabs = slab;
+            pool->used = 0;
+            pool->capacity += cap;
+        }
+        node = (TreeNode *)(pool->slabs + 1) + pool->used++;
+    }
+    pool->live++;
+    node->val = val;
+    node->height = 0;
+    node->size = 1;
+    node->sum = val;
+    node->left = NULL;
+    node->right = NULL;
+    return node;
+}
+
+/* 将节点归还内存池，pool 为 NULL 时直接 free */
+void treeNodeFree(TreeNodePool *pool, TreeNode *node) {
+    if (pool == NULL) {
+        free(node);
         return;
-    freeMemoryTree(root->left);
-    freeMemoryTree(root->right);
-    free(root);
+    }
+    node->left = pool->freeList;
+    pool->freeList = node;
+    pool->live--;
+}
+
+/* 将 src 的所有块与空闲节点并入 dst 并释放 src ，用于合并两棵使用内存池的树 */
+void treeNodePoolMerge(TreeNodePool *dst, TreeNodePool *src) {
+    if (src->slabs != NULL) {
+        // src 的块接在 dst 最新的块之后，dst 继续从自己最新的块分配；src 最新块中未分配的节点不再使用
+        TreeNodeSlab *tail = src->slabs;
+        while (tail->next != NULL) {
+            tail = tail->next;
+        }
+        if (dst->slabs == NULL) {
+            tail->next = NULL;
+            dst->slabs = src->slabs;
+            dst->used = src->used;
+        } else {
+            tail->next = dst->slabs->next;
+            dst->slabs->next = src->slabs;
+        }
+    }
+    if (src->freeList != NULL) {
+        TreeNode *tail = src->freeList;
+        while (tail->left != NULL) {
+            tail = tail->left;
+        }
+        tail->left = dst->freeList;
+        dst->freeList = src->freeList;
+    }
+    dst->live += src->live;
+    dst->capacity += src->capacity;
+    free(src);
+}
+
+/* 将列表反序列化为二叉树：递归，节点从内存池分配 */
+TreeNode *arrayToTreePoolDFS(TreeNodePool *pool, int *arr, int size, int i) {
+    if (i < 0 || i >= size || arr[i] == INT_MAX) {
+        return NULL;
+    }
+    TreeNode *root = treeNodeAlloc(pool, arr[i]);
+    root->left = arrayToTreePoolDFS(pool, arr, size, 2 * i + 1);
+    root->right = arrayToTreePoolDFS(pool, arr, size, 2 * i + 2);
+    return root;
+}
+
+/* 将列表反序列化为二叉树，节点从内存池分配，销毁内存池即释放整棵树 */
+TreeNode *arrayToTreePool(TreeNodePool *pool, int *arr, int size) {
+    return arrayToTreePoolDFS(pool, arr, size, 0);
 }
 
 #ifdef __cplusplus